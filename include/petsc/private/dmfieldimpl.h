@@ -20,6 +20,7 @@ struct _DMFieldOps {
   PetscErrorCode (*createDefaultQuadrature)(DMField, IS, PetscQuadrature *);
   PetscErrorCode (*createDefaultFaceQuadrature)(DMField, IS, PetscQuadrature *);
   PetscErrorCode (*computeFaceData)(DMField, IS, PetscQuadrature, PetscFEGeom *);
+  PetscErrorCode (*getValuesState)(DMField, PetscObjectId *, PetscObjectState *);
 };
 struct _p_DMField {
   PETSCHEADER(struct _DMFieldOps);
@@ -31,3 +32,4 @@ struct _p_DMField {
 
 PETSC_INTERN PetscErrorCode DMFieldCreate(DM, PetscInt, DMFieldContinuity, DMField *);
 PETSC_INTERN PetscErrorCode DMFieldGetFVQuadrature_Internal(DMField, IS, PetscQuadrature *);
+PETSC_INTERN PetscErrorCode DMFieldGetValuesState_Internal(DMField, PetscObjectId *, PetscObjectState *);
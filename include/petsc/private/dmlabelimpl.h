@@ -35,8 +35,9 @@ struct _p_DMLabel {
   PetscHMapI  hmap; /* Hash map for fast strata search */
   PetscHSetI *ht;   /* Hash set for fast insertion */
   /* Index for fast search */
-  PetscInt pStart, pEnd; /* Bounds for index lookup */
-  PetscBT  bt;           /* A bit-wise index */
+  PetscInt   pStart, pEnd; /* Bounds for index lookup */
+  PetscBT    bt;           /* A bit-wise index */
+  PetscHMapI pointMap;     /* Map from each point to the first stratum containing it, built lazily by DMLabelGetValue() */
   /* Propagation */
   PetscInt *propArray; /* Array of values for propagation */
 };
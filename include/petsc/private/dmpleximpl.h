@@ -239,6 +239,7 @@ typedef struct {
   /* FEM */
   PetscBool useCeed;      /* This should convert to a registration system when there are more FEM backends */
   PetscBool useMatClPerm; /* Use the closure permutation when assembling matrices */
+  PetscInt  femThreads;   /* Number of threads sharing the cell integration loop in residual and Jacobian assembly */
 
   /* CAD */
   PetscBool ignoreModel; /* If TRUE, Plex refinement will skip Snap-To-Geometry feature ignoring attached CAD geometry information */
@@ -327,6 +327,14 @@ typedef struct {
   char     pending;
 } MatStashFrame;
 
+typedef struct _n_MatStashChunk *MatStashChunk;
+struct _n_MatStashChunk {
+  char         *buffer; /* Of type blocktype, entries sent progressively to one or more ranks */
+  PetscMPIInt   nreqs;
+  MPI_Request  *reqs;
+  MatStashChunk next;
+};
+
 typedef struct _MatStash MatStash;
 struct _MatStash {
   PetscInt           nmax;              /* maximum stash size */
@@ -385,10 +393,27 @@ struct _MatStash {
   MPI_Datatype    blocktype;
   size_t          blocktype_size;
   InsertMode     *insertmode; /* Pointer to check mat->insertmode and set upon message arrival in case no local values have been set. */
+
+  /* The following variables are used for progressive assembly, see MatStashProgressSend_Private() */
+  PetscInt      progress_size;      /* Send the stashed entries once this many are stashed, 0 to only send them in MatAssemblyBegin() */
+  PetscBool     progress_busy;      /* Do not send or receive progressively, the entries are being inserted or assembled */
+  PetscInt      progress_calls;     /* Number of calls to MatSetValues() since the last check for progressive messages */
+  PetscMPIInt   progress_tag[2];    /* Tags alternate between assemblies, a rank may start the next assembly while others finish this one */
+  PetscMPIInt   progress_round;     /* Index into progress_tag[] */
+  PetscMPIInt  *progress_nsent;     /* Number of progressive messages sent to each rank */
+  PetscMPIInt   progress_nrecv;     /* Number of progressive messages received so far */
+  PetscMPIInt   progress_nexpected; /* Number of progressive messages to receive, known after MatAssemblyBegin() */
+  MatStashChunk progress_sends;     /* Progressive messages that may not be sent yet */
+  char         *progress_buffer;    /* Progressive message being inserted */
+  PetscMPIInt   progress_count;     /* Number of blocks in progress_buffer */
+  PetscMPIInt   progress_i;         /* Index of block within progress_buffer */
 };
 
 #if !defined(PETSC_HAVE_MPIUNI)
 PETSC_INTERN PetscErrorCode MatStashScatterDestroy_BTS(MatStash *);
+PETSC_INTERN PetscErrorCode MatStashProgressSend_Private(MatStash *, PetscInt *);
+PETSC_INTERN PetscErrorCode MatStashProgressGetMesg_Private(MatStash *, PetscBool, PetscInt **, PetscInt **, PetscScalar **, PetscInt *);
+PETSC_INTERN PetscErrorCode MatStashProgressCount_Private(MatStash *);
 #endif
 PETSC_INTERN PetscErrorCode MatStashCreate_Private(MPI_Comm, PetscInt, MatStash *);
 PETSC_INTERN PetscErrorCode MatStashDestroy_Private(MatStash *);
@@ -642,29 +667,33 @@ typedef struct {
 
 struct _p_MatFDColoring {
   PETSCHEADER(int);
-  PetscInt         M, N, m;                       /* total rows, columns; local rows */
-  PetscInt         rstart;                        /* first row owned by local processor */
-  PetscInt         ncolors;                       /* number of colors */
-  PetscInt        *ncolumns;                      /* number of local columns for a color */
-  PetscInt       **columns;                       /* lists the local columns of each color (using global column numbering) */
-  IS              *isa;                           /* these are the IS that contain the column values given in columns */
-  PetscInt        *nrows;                         /* number of local rows for each color */
-  MatEntry        *matentry;                      /* holds (row, column, address of value) for Jacobian matrix entry */
-  MatEntry2       *matentry2;                     /* holds (row, address of value) for Jacobian matrix entry */
-  PetscScalar     *dy;                            /* store a block of F(x+dx)-F(x) when J is in BAIJ format */
-  PetscReal        error_rel;                     /* square root of relative error in computing function */
-  PetscReal        umin;                          /* minimum allowable u'dx value */
-  Vec              w1, w2, w3;                    /* work vectors used in computing Jacobian */
-  PetscBool        fset;                          /* indicates that the initial function value F(X) is set */
-  MatFDColoringFn *f;                             /* function that defines Jacobian */
-  void            *fctx;                          /* optional user-defined context for use by the function f */
-  Vec              vscale;                        /* holds FD scaling, i.e. 1/dx for each perturbed column */
-  PetscInt         currentcolor;                  /* color for which function evaluation is being done now */
-  const char      *htype;                         /* "wp" or "ds" */
-  ISColoringType   ctype;                         /* IS_COLORING_GLOBAL or IS_COLORING_LOCAL */
-  PetscInt         brows, bcols;                  /* number of block rows or columns for speedup inserting the dense matrix into sparse Jacobian */
-  PetscBool        setupcalled;                   /* true if setup has been called */
-  PetscBool        viewed;                        /* true if the -mat_fd_coloring_view has been triggered already */
+  PetscInt              M, N, m;                  /* total rows, columns; local rows */
+  PetscInt              rstart;                   /* first row owned by local processor */
+  PetscInt              ncolors;                  /* number of colors */
+  PetscInt             *ncolumns;                 /* number of local columns for a color */
+  PetscInt            **columns;                  /* lists the local columns of each color (using global column numbering) */
+  IS                   *isa;                      /* these are the IS that contain the column values given in columns */
+  PetscInt             *nrows;                    /* number of local rows for each color */
+  MatEntry             *matentry;                 /* holds (row, column, address of value) for Jacobian matrix entry */
+  MatEntry2            *matentry2;                /* holds (row, address of value) for Jacobian matrix entry */
+  PetscScalar          *dy;                       /* store a block of F(x+dx)-F(x) when J is in BAIJ format */
+  PetscReal             error_rel;                /* square root of relative error in computing function */
+  PetscReal             umin;                     /* minimum allowable u'dx value */
+  Vec                   w1, w2, w3;               /* work vectors used in computing Jacobian */
+  PetscBool             fset;                     /* indicates that the initial function value F(X) is set */
+  MatFDColoringFn      *f;                        /* function that defines Jacobian */
+  void                 *fctx;                     /* optional user-defined context for use by the function f */
+  MatFDColoringBatchFn *fbatch;                   /* optional function that evaluates f at the perturbations of a block of bcols colors at once */
+  void                 *fbatchctx;                /* optional user-defined context for use by the function fbatch */
+  PetscInt              nbatch;                   /* number of vectors in xbatch and ybatch */
+  Vec                  *xbatch, *ybatch;          /* work vectors of fbatch, the arrays of ybatch are placed on dy */
+  Vec                   vscale;                   /* holds FD scaling, i.e. 1/dx for each perturbed column */
+  PetscInt              currentcolor;             /* color for which function evaluation is being done now */
+  const char           *htype;                    /* "wp" or "ds" */
+  ISColoringType        ctype;                    /* IS_COLORING_GLOBAL or IS_COLORING_LOCAL */
+  PetscInt              brows, bcols;             /* number of block rows or columns for speedup inserting the dense matrix into sparse Jacobian */
+  PetscBool             setupcalled;              /* true if setup has been called */
+  PetscBool             viewed;                   /* true if the -mat_fd_coloring_view has been triggered already */
   void (*ftn_func_pointer)(void), *ftn_func_cntx; /* serve the same purpose as *fortran_func_pointers in PETSc objects */
   PetscObjectId matid;                            /* matrix this object was created with, must always be the same */
 };
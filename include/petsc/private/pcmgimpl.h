@@ -41,6 +41,7 @@ typedef struct {
   Mat           restrct;          /* restrict is a reserved word in C99 and on Cray */
   Mat           inject;           /* Used for moving state if provided. */
   Vec           rscale;           /* scaling of restriction matrix */
+  PetscObjectId autotuneid;       /* operator the number of smoothing steps was last tuned for */
   PetscLogEvent eventsmoothsetup; /* if logging times for each level */
   PetscLogEvent eventsmoothsolve;
   PetscLogEvent eventresidual;
@@ -69,6 +70,7 @@ typedef struct {
   PC_MG_Levels **levels;
   PetscInt       default_smoothu;          /* number of smooths per level if not over-ridden */
   PetscInt       default_smoothd;          /*  with calls to KSPSetTolerances() */
+  PetscInt       autotunesmooth;           /* if positive, pick the degree of Chebyshev smoothers up to this value from their measured smoothing rate */
   PetscReal      rtol, abstol, dtol, ttol; /* tolerances for when running with PCApplyRichardson_MG */
 
   void         *innerctx; /* optional data for preconditioner, like PCEXOTIC that inherits off of PCMG */
@@ -106,6 +106,7 @@ struct _p_PetscSF {
   PetscBool      unknown_input_stream; /* If true, SF does not know which streams root/leafdata is on. Default is false, since we only use PETSc default stream */
   PetscBool      use_gpu_aware_mpi;    /* If true, SF assumes it can pass GPU pointers to MPI */
   PetscBool      use_stream_aware_mpi; /* If true, SF assumes the underlying MPI is cuda-stream aware and we won't sync streams for send/recv buffers passed to MPI */
+  PetscBool      reduced_precision;    /* If true, SFBASIC sends double precision real or complex data to other ranks as single precision */
   PetscInt       maxResidentThreadsPerGPU;
   PetscBool      allow_multi_leaves;
   PetscSFBackend backend; /* The device backend (if any) SF will use */
@@ -118,6 +118,16 @@ struct _p_SNES {
 
   PetscBool vec_func_init_set; /* the initial function has been set */
 
+  PetscBool      lagjac_adaptive; /* SNESSetLagJacobianAdaptive() */
+  PetscBool      lagpre_adaptive; /* SNESSetLagPreconditionerAdaptive() */
+  PetscBool      lag_rebuilt;     /* the last adaptive lag decision was a rebuild */
+  PetscLogDouble lag_cost;        /* time of the last rebuild, negative before the first one */
+  PetscLogDouble lag_extra;       /* time of the linear iterations beyond the baseline since the last rebuild */
+  PetscInt       lag_base_its;    /* linear iterations right after the last rebuild */
+  PetscInt       lag_its;         /* total linear iterations at the last decision */
+  PetscReal      lag_fnorm;       /* residual norm at the last decision */
+  PetscLogDouble lag_time[3];     /* Jacobian evaluation, PCSetUp(), and KSPSolve() times at the last decision */
+
   SNESNormSchedule normschedule; /* Norm computation type for SNES instance */
   SNESFunctionType functype;     /* Function type for the SNES instance */
 
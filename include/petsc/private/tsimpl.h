@@ -495,6 +495,9 @@ struct _n_TSEvent {
   PetscInt    iterctr;                                                                      /* iteration counter: used both for reporting and as a status indicator */
   PetscBool   processing;                                                                   /* this flag shows if the event-resolving iterations are in progress, or the post-event dt handling is in progress */
   PetscBool   revisit_right;                                                                /* [sync] "revisit the bracket's right end", if true, then fvalue(s) are not calculated, but are taken from fvalue_right(s) */
+  PetscBool   interpolate;                                                                  /* locate the zero-crossings inside the accepted step from the dense output of the integrator, instead of re-stepping */
+  Vec         work;                                                                         /* interpolated solution at the points visited when locating the zero-crossings by interpolation */
+  PetscReal   ptime_left_interp;                                                            /* left end-point of the last bracket refined by interpolation, only for reporting; PETSC_MIN_REAL otherwise */
   PetscViewer monitor;
   /* Struct to record the events */
   struct {
@@ -477,6 +477,8 @@ PETSC_EXTERN PetscErrorCode DMPlexGetUseCeed(DM, PetscBool *);
 PETSC_EXTERN PetscErrorCode DMPlexSetUseCeed(DM, PetscBool);
 PETSC_EXTERN PetscErrorCode DMPlexGetUseMatClosurePermutation(DM, PetscBool *);
 PETSC_EXTERN PetscErrorCode DMPlexSetUseMatClosurePermutation(DM, PetscBool);
+PETSC_EXTERN PetscErrorCode DMPlexGetFEMNumThreads(DM, PetscInt *);
+PETSC_EXTERN PetscErrorCode DMPlexSetFEMNumThreads(DM, PetscInt);
 
 /* anchors */
 PETSC_EXTERN PetscErrorCode DMPlexGetAnchors(DM, PetscSection *, IS *);
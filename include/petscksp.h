@@ -319,6 +319,7 @@ PETSC_EXTERN PetscErrorCode KSPRichardsonSetSelfScale(KSP, PetscBool);
 PETSC_EXTERN PetscErrorCode KSPChebyshevSetEigenvalues(KSP, PetscReal, PetscReal);
 PETSC_EXTERN PetscErrorCode KSPChebyshevEstEigSet(KSP, PetscReal, PetscReal, PetscReal, PetscReal);
 PETSC_EXTERN PetscErrorCode KSPChebyshevEstEigSetUseNoisy(KSP, PetscBool);
+PETSC_EXTERN PetscErrorCode KSPChebyshevEstEigSetRefresh(KSP, PetscInt);
 PETSC_EXTERN PetscErrorCode KSPChebyshevSetKind(KSP, KSPChebyshevKind);
 PETSC_EXTERN PetscErrorCode KSPChebyshevGetKind(KSP, KSPChebyshevKind *);
 PETSC_EXTERN PetscErrorCode KSPChebyshevEstEigGetKSP(KSP, KSP *);
@@ -1201,6 +1202,13 @@ PETSC_EXTERN PetscErrorCode MatLMVMSymBroydenSetDelta(Mat, PetscScalar);
 
   Level: advanced
 
+  Note:
+  With the recursive formulas each of the `m` updates in the history requires its own global reduction. The compact forms
+  apply the updates with products against the stored bases, and the dense formulas of `MATLMVMBFGS`, `MATLMVMDFP`,
+  `MATLMVMSYMBROYDEN`, and `MATLMVMBROYDEN` compute both products of their input with a single reduction, so the number of
+  reductions of a product or solve does not grow with `m`. This also applies to the matrices used by `SNESQN` and `TAOBLMVM`,
+  for example with `-qn_mat_lmvm_mult_algorithm compact_dense` and `-tao_blmvm_mat_lmvm_mult_algorithm compact_dense`.
+
   Options Database Keys:
 . -mat_lmvm_mult_algorithm  - the algorithm to use for multiplication (recursive, dense, compact_dense)
 
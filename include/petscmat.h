@@ -111,6 +111,7 @@ typedef const char *MatType;
 #define MATHYPRE                     "hypre"
 #define MATHYPRESTRUCT               "hyprestruct"
 #define MATHYPRESSTRUCT              "hypresstruct"
+#define MATSTENCIL                   "stencil"
 #define MATSUBMATRIX                 "submatrix"
 #define MATLOCALREF                  "localref"
 #define MATNEST                      "nest"
@@ -1730,11 +1731,29 @@ typedef struct _p_MatFDColoring *MatFDColoring;
 S*/
 PETSC_EXTERN_TYPEDEF typedef PetscErrorCode(MatFDColoringFn)(void *snes, Vec x, Vec y, void *fctx);
 
+/*S
+  MatFDColoringBatchFn - Function provided to `MatFDColoringSetBatchFunction()` that computes the function being differenced at several points at once
+
+  Level: advanced
+
+  Calling Sequence:
++ snes - either a `SNES` object if used within `SNES` otherwise an unused parameter
+. n    - the number of points
+. in   - the `n` points at which to evaluate the function, each perturbed along the columns of one color
+. out  - the `n` locations to put the computed function values
+- fctx - the function context passed into `MatFDColoringSetBatchFunction()`
+
+.seealso: [](ch_matrices), `Mat`, `MatFDColoringFn`, `MatFDColoringSetBatchFunction()`, `MatFDColoringSetFunction()`
+S*/
+PETSC_EXTERN_TYPEDEF typedef PetscErrorCode(MatFDColoringBatchFn)(void *snes, PetscInt n, Vec in[], Vec out[], void *fctx);
+
 PETSC_EXTERN PetscErrorCode MatFDColoringCreate(Mat, ISColoring, MatFDColoring *);
 PETSC_EXTERN PetscErrorCode MatFDColoringDestroy(MatFDColoring *);
 PETSC_EXTERN PetscErrorCode MatFDColoringView(MatFDColoring, PetscViewer);
 PETSC_EXTERN PetscErrorCode MatFDColoringSetFunction(MatFDColoring, MatFDColoringFn *, void *);
 PETSC_EXTERN PetscErrorCode MatFDColoringGetFunction(MatFDColoring, MatFDColoringFn **, void **);
+PETSC_EXTERN PetscErrorCode MatFDColoringSetBatchFunction(MatFDColoring, MatFDColoringBatchFn *, void *);
+PETSC_EXTERN PetscErrorCode MatFDColoringGetBatchFunction(MatFDColoring, MatFDColoringBatchFn **, void **);
 PETSC_EXTERN PetscErrorCode MatFDColoringSetParameters(MatFDColoring, PetscReal, PetscReal);
 PETSC_EXTERN PetscErrorCode MatFDColoringSetFromOptions(MatFDColoring);
 PETSC_EXTERN PetscErrorCode MatFDColoringApply(Mat, MatFDColoring, Vec, void *);
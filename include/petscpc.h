@@ -175,6 +175,8 @@ PETSC_EXTERN PetscErrorCode PCBJacobiSetTotalBlocks(PC, PetscInt, const PetscInt
 PETSC_EXTERN PetscErrorCode PCBJacobiGetTotalBlocks(PC, PetscInt *, const PetscInt *[]);
 PETSC_EXTERN PetscErrorCode PCBJacobiSetLocalBlocks(PC, PetscInt, const PetscInt[]);
 PETSC_EXTERN PetscErrorCode PCBJacobiGetLocalBlocks(PC, PetscInt *, const PetscInt *[]);
+PETSC_EXTERN PetscErrorCode PCBJacobiSetBatched(PC, PetscBool);
+PETSC_EXTERN PetscErrorCode PCBJacobiGetBatched(PC, PetscBool *);
 
 PETSC_EXTERN PetscErrorCode PCShellSetApply(PC, PetscErrorCode (*)(PC, Vec, Vec));
 PETSC_EXTERN PetscErrorCode PCShellSetMatApply(PC, PetscErrorCode (*)(PC, Mat, Mat));
@@ -308,6 +310,8 @@ PETSC_EXTERN PetscErrorCode PCFieldSplitGetISByIndex(PC, PetscInt, IS *);
 PETSC_EXTERN PetscErrorCode PCFieldSplitRestrictIS(PC, IS);
 PETSC_EXTERN PetscErrorCode PCFieldSplitSetDMSplits(PC, PetscBool);
 PETSC_EXTERN PetscErrorCode PCFieldSplitGetDMSplits(PC, PetscBool *);
+PETSC_EXTERN PetscErrorCode PCFieldSplitSetSubcomm(PC, PetscBool);
+PETSC_EXTERN PetscErrorCode PCFieldSplitGetSubcomm(PC, PetscBool *);
 PETSC_EXTERN PetscErrorCode PCFieldSplitSetDiagUseAmat(PC, PetscBool);
 PETSC_EXTERN PetscErrorCode PCFieldSplitGetDiagUseAmat(PC, PetscBool *);
 PETSC_EXTERN PetscErrorCode PCFieldSplitSetOffDiagUseAmat(PC, PetscBool);
@@ -422,6 +426,8 @@ PETSC_EXTERN PetscErrorCode PCMGGetLevels(PC, PetscInt *);
 
 PETSC_EXTERN PetscErrorCode PCMGSetDistinctSmoothUp(PC);
 PETSC_EXTERN PetscErrorCode PCMGSetNumberSmooth(PC, PetscInt);
+PETSC_EXTERN PetscErrorCode PCMGSetNumberSmoothAutotune(PC, PetscInt);
+PETSC_EXTERN PetscErrorCode PCMGGetNumberSmoothAutotune(PC, PetscInt *);
 PETSC_EXTERN PetscErrorCode PCMGSetCycleType(PC, PCMGCycleType);
 PETSC_EXTERN PetscErrorCode PCMGSetCycleTypeOnLevel(PC, PetscInt, PCMGCycleType);
 PETSC_DEPRECATED_FUNCTION(3, 5, 0, "PCMGSetCycleTypeOnLevel()", ) static inline PetscErrorCode PCMGSetCyclesOnLevel(PC pc, PetscInt l, PetscInt t)
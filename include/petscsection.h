@@ -60,6 +60,10 @@ PETSC_EXTERN PetscErrorCode PetscSectionSetOffset(PetscSection, PetscInt, PetscI
 PETSC_EXTERN PetscErrorCode PetscSectionGetFieldOffset(PetscSection, PetscInt, PetscInt, PetscInt *);
 PETSC_EXTERN PetscErrorCode PetscSectionSetFieldOffset(PetscSection, PetscInt, PetscInt, PetscInt);
 PETSC_EXTERN PetscErrorCode PetscSectionGetFieldPointOffset(PetscSection, PetscInt, PetscInt, PetscInt *);
+PETSC_EXTERN PetscErrorCode PetscSectionGetDofs(PetscSection, PetscInt, const PetscInt[], PetscInt[]);
+PETSC_EXTERN PetscErrorCode PetscSectionGetOffsets(PetscSection, PetscInt, const PetscInt[], PetscInt[]);
+PETSC_EXTERN PetscErrorCode PetscSectionGetFieldDofs(PetscSection, PetscInt, const PetscInt[], PetscInt[]);
+PETSC_EXTERN PetscErrorCode PetscSectionGetFieldOffsets(PetscSection, PetscInt, const PetscInt[], PetscInt[]);
 PETSC_EXTERN PetscErrorCode PetscSectionGetOffsetRange(PetscSection, PetscInt *, PetscInt *);
 PETSC_EXTERN PetscErrorCode PetscSectionView(PetscSection, PetscViewer);
 PETSC_EXTERN PetscErrorCode PetscSectionViewFromOptions(PetscSection, PetscObject, const char[]);
@@ -133,6 +133,8 @@ PETSC_EXTERN PetscErrorCode PetscSFWindowGetFlavorType(PetscSF, PetscSFWindowFla
 PETSC_EXTERN PetscErrorCode PetscSFWindowSetInfo(PetscSF, MPI_Info);
 PETSC_EXTERN PetscErrorCode PetscSFWindowGetInfo(PetscSF, MPI_Info *);
 PETSC_EXTERN PetscErrorCode PetscSFSetRankOrder(PetscSF, PetscBool);
+PETSC_EXTERN PetscErrorCode PetscSFSetReducedPrecision(PetscSF, PetscBool);
+PETSC_EXTERN PetscErrorCode PetscSFGetReducedPrecision(PetscSF, PetscBool *);
 PETSC_EXTERN PetscErrorCode PetscSFSetGraph(PetscSF, PetscInt, PetscInt, PetscInt[], PetscCopyMode, PetscSFNode[], PetscCopyMode);
 PETSC_EXTERN PetscErrorCode PetscSFSetGraphWithPattern(PetscSF, PetscLayout, PetscSFPattern);
 PETSC_EXTERN PetscErrorCode PetscSFGetGraph(PetscSF, PetscInt *, PetscInt *, const PetscInt *[], const PetscSFNode *[]);
@@ -32,6 +32,7 @@ typedef const char *PetscSFType;
 #define PETSCSFGATHER     "gather"
 #define PETSCSFALLTOALL   "alltoall"
 #define PETSCSFWINDOW     "window"
+#define PETSCSFNODE       "node"
 
 /*S
    PetscSFNode - specifier of owner and index
@@ -220,6 +220,9 @@ PETSC_EXTERN PetscErrorCode SNESSetLagJacobian(SNES, PetscInt);
 PETSC_EXTERN PetscErrorCode SNESGetLagJacobian(SNES, PetscInt *);
 PETSC_EXTERN PetscErrorCode SNESSetLagPreconditionerPersists(SNES, PetscBool);
 PETSC_EXTERN PetscErrorCode SNESSetLagJacobianPersists(SNES, PetscBool);
+PETSC_EXTERN PetscErrorCode SNESSetLagJacobianAdaptive(SNES, PetscBool);
+PETSC_EXTERN PetscErrorCode SNESSetLagPreconditionerAdaptive(SNES, PetscBool);
+PETSC_EXTERN PetscErrorCode SNESResetLagAdaptive(SNES);
 PETSC_EXTERN PetscErrorCode SNESSetGridSequence(SNES, PetscInt);
 PETSC_EXTERN PetscErrorCode SNESGetGridSequence(SNES, PetscInt *);
 
@@ -982,13 +985,16 @@ PETSC_EXTERN PetscErrorCode DMCopyDMSNES(DM, DM);
 PETSC_EXTERN_TYPEDEF typedef PetscErrorCode DMDASNESFunctionFn(DMDALocalInfo *, void *, void *, void *);
 PETSC_EXTERN_TYPEDEF typedef PetscErrorCode DMDASNESJacobianFn(DMDALocalInfo *, void *, Mat, Mat, void *);
 PETSC_EXTERN_TYPEDEF typedef PetscErrorCode DMDASNESObjectiveFn(DMDALocalInfo *, void *, PetscReal *, void *);
+PETSC_EXTERN_TYPEDEF typedef PetscErrorCode DMDASNESTangentFn(DMDALocalInfo *, PetscInt, void *, void *, void *, void *);
 
 PETSC_EXTERN_TYPEDEF typedef PetscErrorCode DMDASNESFunctionVecFn(DMDALocalInfo *, Vec, Vec, void *);
 PETSC_EXTERN_TYPEDEF typedef PetscErrorCode DMDASNESJacobianVecFn(DMDALocalInfo *, Vec, Mat, Mat, void *);
 PETSC_EXTERN_TYPEDEF typedef PetscErrorCode DMDASNESObjectiveVecFn(DMDALocalInfo *, Vec, PetscReal *, void *);
 
 PETSC_EXTERN PetscErrorCode DMDASNESSetFunctionLocal(DM, InsertMode, DMDASNESFunctionFn *, void *);
+PETSC_EXTERN PetscErrorCode DMDASNESSetFunctionLocalSplit(DM, DMDASNESFunctionFn *, DMDASNESFunctionFn *, void *);
 PETSC_EXTERN PetscErrorCode DMDASNESSetJacobianLocal(DM, DMDASNESJacobianFn *, void *);
+PETSC_EXTERN PetscErrorCode DMDASNESSetJacobianLocalTangent(DM, DMDASNESTangentFn *, void *);
 PETSC_EXTERN PetscErrorCode DMDASNESSetObjectiveLocal(DM, DMDASNESObjectiveFn *, void *);
 PETSC_EXTERN PetscErrorCode DMDASNESSetPicardLocal(DM, InsertMode, DMDASNESFunctionFn *, DMDASNESJacobianFn, void *);
 
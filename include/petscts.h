@@ -55,6 +55,7 @@ typedef const char *TSType;
 #define TSDISCGRAD        "discgrad"
 #define TSIRK             "irk"
 #define TSDIRK            "dirk"
+#define TSEXPRB           "exprb"
 
 /*E
    TSProblemType - Determines the type of problem this `TS` object is to be used to solve
@@ -1080,6 +1081,7 @@ PETSC_DEPRECATED_FUNCTION(3, 21, 0, "TSSetPostEventSecondStep()", ) static inlin
   return TSSetPostEventSecondStep(ts, dt);
 }
 PETSC_EXTERN PetscErrorCode TSSetEventTolerances(TS, PetscReal, PetscReal[]);
+PETSC_EXTERN PetscErrorCode TSSetEventInterpolation(TS, PetscBool);
 PETSC_EXTERN PetscErrorCode TSGetNumEvents(TS, PetscInt *);
 
 /*J
@@ -1286,6 +1288,8 @@ typedef const char *TSRKType;
 #define TSRK6VR "6vr"
 #define TSRK7VR "7vr"
 #define TSRK8VR "8vr"
+#define TSRK3LS "3ls"
+#define TSRK4LS "4ls"
 
 PETSC_EXTERN PetscErrorCode TSRKGetOrder(TS, PetscInt *);
 PETSC_EXTERN PetscErrorCode TSRKGetType(TS, TSRKType *);
@@ -1293,7 +1297,44 @@ PETSC_EXTERN PetscErrorCode TSRKSetType(TS, TSRKType);
 PETSC_EXTERN PetscErrorCode TSRKGetTableau(TS, PetscInt *, const PetscReal **, const PetscReal **, const PetscReal **, const PetscReal **, PetscInt *, const PetscReal **, PetscBool *);
 PETSC_EXTERN PetscErrorCode TSRKSetMultirate(TS, PetscBool);
 PETSC_EXTERN PetscErrorCode TSRKGetMultirate(TS, PetscBool *);
+
+/*S
+  TSRKLocalTimeStepFn - A prototype of a function that computes the largest stable time step of each degree of freedom, passed to `TSRKSetLocalTimeStepping()`
+
+  Calling Sequence:
++ ts  - the `TS` context
+. t   - current time
+. U   - current solution
+. dt  - output vector with the largest stable time step for each degree of freedom, e.g. from a local CFL condition
+- ctx - [optional] user-defined context
+
+  Level: advanced
+
+.seealso: [](ch_ts), `TS`, `TSRK`, `TSRKSetLocalTimeStepping()`, `TSRKLocalRHSFunctionFn`
+S*/
+PETSC_EXTERN_TYPEDEF typedef PetscErrorCode(TSRKLocalTimeStepFn)(TS ts, PetscReal t, Vec U, Vec dt, void *ctx);
+
+/*S
+  TSRKLocalRHSFunctionFn - A prototype of a right-hand side function that only computes a subset of the rows, passed to `TSRKSetLocalTimeStepping()`
+
+  Calling Sequence:
++ ts   - the `TS` context
+. t    - current time
+. U    - input vector, all the entries are valid
+. rows - the rows of `F` to compute, a subset of the locally owned rows in global numbering
+. F    - function vector, only the entries in `rows` are used
+- ctx  - [optional] user-defined context
+
+  Level: advanced
+
+.seealso: [](ch_ts), `TS`, `TSRK`, `TSRKSetLocalTimeStepping()`, `TSRKLocalTimeStepFn`, `TSRHSFunctionFn`
+S*/
+PETSC_EXTERN_TYPEDEF typedef PetscErrorCode(TSRKLocalRHSFunctionFn)(TS ts, PetscReal t, Vec U, IS rows, Vec F, void *ctx);
+
+PETSC_EXTERN PetscErrorCode TSRKSetLocalTimeStepping(TS, TSRKLocalTimeStepFn *, TSRKLocalRHSFunctionFn *, void *);
+PETSC_EXTERN PetscErrorCode TSRKGetLocalTimeSteppingLevels(TS, PetscInt *, const PetscInt *[]);
 PETSC_EXTERN PetscErrorCode TSRKRegister(TSRKType, PetscInt, PetscInt, const PetscReal[], const PetscReal[], const PetscReal[], const PetscReal[], PetscInt, const PetscReal[]);
+PETSC_EXTERN PetscErrorCode TSRKRegisterLowStorage(TSRKType, PetscInt, PetscInt, const PetscReal[], const PetscReal[]);
 PETSC_EXTERN PetscErrorCode TSRKInitializePackage(void);
 PETSC_EXTERN PetscErrorCode TSRKFinalizePackage(void);
 PETSC_EXTERN PetscErrorCode TSRKRegisterDestroy(void);
@@ -1434,6 +1475,20 @@ PETSC_EXTERN PetscErrorCode TSDIRKGetType(TS, TSDIRKType *);
 PETSC_EXTERN PetscErrorCode TSDIRKSetType(TS, TSDIRKType);
 PETSC_EXTERN PetscErrorCode TSDIRKRegister(TSDIRKType, PetscInt, PetscInt, const PetscReal[], const PetscReal[], const PetscReal[], const PetscReal[], PetscInt, const PetscReal[]);
 
+/*J
+   TSExpRBType - String with the name of an exponential Rosenbrock `TSEXPRB` type
+
+   Level: beginner
+
+.seealso: [](ch_ts), `TSExpRBSetType()`, `TS`, `TSEXPRB`
+J*/
+typedef const char *TSExpRBType;
+#define TSEXPRBEULER "euler"
+#define TSEXPRB32    "32"
+
+PETSC_EXTERN PetscErrorCode TSExpRBGetType(TS, TSExpRBType *);
+PETSC_EXTERN PetscErrorCode TSExpRBSetType(TS, TSExpRBType);
+
 /*J
    TSRosWType - String with the name of a Rosenbrock-W `TSROSW` type
 
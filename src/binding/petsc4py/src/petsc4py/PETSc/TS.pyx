@@ -27,6 +27,7 @@ class TSType(object):
     RADAU5          = S_(TSRADAU5)
     MPRK            = S_(TSMPRK)
     DISCGRAD        = S_(TSDISCGRAD)
+    EXPRB           = S_(TSEXPRB)
     # aliases
     FE = EULER
     BE = BEULER
@@ -49,6 +50,8 @@ class TSRKType(object):
     RK6VR = S_(TSRK6VR)
     RK7VR = S_(TSRK7VR)
     RK8VR = S_(TSRK8VR)
+    RK3LS = S_(TSRK3LS)
+    RK4LS = S_(TSRK4LS)
 
 
 class TSARKIMEXType(object):
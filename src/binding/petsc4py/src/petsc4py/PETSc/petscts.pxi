@@ -24,6 +24,7 @@ cdef extern from * nogil:
     PetscTSType TSRADAU5
     PetscTSType TSMPRK
     PetscTSType TSDISCGRAD
+    PetscTSType TSEXPRB
 
     ctypedef enum PetscTSProblemType "TSProblemType":
         TS_LINEAR
@@ -295,6 +296,8 @@ cdef extern from * nogil:
     PetscTSRKType TSRK6VR
     PetscTSRKType TSRK7VR
     PetscTSRKType TSRK8VR
+    PetscTSRKType TSRK3LS
+    PetscTSRKType TSRK4LS
 
     PetscErrorCode TSRKGetType(PetscTS, PetscTSRKType*)
     PetscErrorCode TSRKSetType(PetscTS, PetscTSRKType)
@@ -1131,6 +1131,22 @@ static PetscErrorCode DMFieldComputeFaceData_DS(DMField field, IS pointIS, Petsc
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode DMFieldGetValuesState_DS(DMField field, PetscObjectId *id, PetscObjectState *state)
+{
+  DMField_DS *dsfield = (DMField_DS *)field->data;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectGetId((PetscObject)dsfield->vec, id));
+  PetscCall(PetscObjectStateGet((PetscObject)dsfield->vec, state));
+  if (dsfield->vecDG) {
+    PetscObjectState stateDG;
+
+    PetscCall(PetscObjectStateGet((PetscObject)dsfield->vecDG, &stateDG));
+    *state += stateDG;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode DMFieldInitialize_DS(DMField field)
 {
   PetscFunctionBegin;
@@ -1143,6 +1159,7 @@ static PetscErrorCode DMFieldInitialize_DS(DMField field)
   field->ops->createDefaultFaceQuadrature = DMFieldCreateDefaultFaceQuadrature_DS;
   field->ops->view                        = DMFieldView_DS;
   field->ops->computeFaceData             = DMFieldComputeFaceData_DS;
+  field->ops->getValuesState              = DMFieldGetValuesState_DS;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -358,6 +358,24 @@ PetscErrorCode DMFieldGetDegree(DMField field, IS cellIS, PeOp PetscInt *minDegr
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+  DMFieldGetValuesState_Internal - Get an id and state that change whenever the values of the field change, so that quantities computed
+  from the field, such as the geometry from a coordinate field, can be cached. Types without values of their own use the field itself.
+*/
+PetscErrorCode DMFieldGetValuesState_Internal(DMField field, PetscObjectId *id, PetscObjectState *state)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(field, DMFIELD_CLASSID, 1);
+  PetscAssertPointer(id, 2);
+  PetscAssertPointer(state, 3);
+  if (field->ops->getValuesState) PetscUseTypeMethod(field, getValuesState, id, state);
+  else {
+    PetscCall(PetscObjectGetId((PetscObject)field, id));
+    PetscCall(PetscObjectStateGet((PetscObject)field, state));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
   DMFieldCreateDefaultQuadrature - Creates a quadrature sufficient to integrate the field on the selected
   points via pullback onto the reference element
@@ -0,0 +1,500 @@
+#include <petsc/private/dmdaimpl.h> /*I "petscdmda.h" I*/
+#include <petsc/private/matimpl.h>
+
+/*
+   Coefficients are stored stencil entry major: for stencil entry s and owned point p (in the natural x-fastest
+   ordering of the owned box) the dof x dof block is vals[((s * n) + p) * dof * dof]. Thus for each stencil entry the
+   coefficients along an x-line of the grid are contiguous, as are the values they multiply in the ghosted local vector.
+*/
+typedef struct {
+  DM           da;
+  PetscInt     dim, dof, sw, swy, swz;
+  PetscInt     xs, ys, zs, nx, ny, nz, n; /* owned box, relative to the ghosted box */
+  PetscInt     gnx, gny;                  /* x and y extent of the ghosted box */
+  PetscInt     ns, center;                /* number of stencil entries and the index of the diagonal entry */
+  PetscInt    *entry;                     /* entry[] maps a relative position in the (2 sw + 1)^dim box to a stencil entry, or -1 */
+  PetscInt    *offset;                    /* offset of each stencil entry in the ghosted local vector, in grid points */
+  PetscInt    *range;                     /* owned points [lo, hi) in each direction whose neighbor for each stencil entry lies in the ghosted box */
+  PetscScalar *vals;
+} Mat_Stencil;
+
+/*MC
+   MATSTENCIL - MATSTENCIL = "stencil" - A matrix type for operators defined on a `DMDA` that stores only the stencil
+   coefficients of each locally owned grid point
+
+   Level: intermediate
+
+   Notes:
+   The matrix needs a `DMDA` associated with it by either a call to `MatSetDM()` or if the matrix is obtained from `DMCreateMatrix()`,
+   for example with `-dm_mat_type stencil`. Storage is one dof x dof block per owned grid point and stencil entry of the `DMDA`,
+   no column indices are stored.
+
+   Values may only be set with `MatSetValuesStencil()` or `MatSetValuesLocal()`, for locally owned rows and for columns inside the
+   stencil of the `DMDA`.
+
+   `MatMult()` communicates the ghost values with `DMGlobalToLocalBegin()` and `DMGlobalToLocalEnd()` and then applies the stencil one
+   x-line of the grid at a time, so the loop over a line is contiguous in both the coefficients and the input values and the lines
+   it reads stay in cache.
+
+   `MatSOR()` performs pointwise (processor local, in parallel) sweeps in which ghost points, including periodic images of owned
+   points, keep the values they had at the start of the sweep. With it the matrix can be used for smoothing in `PCMG` when the
+   coarse operators are obtained from the `DMDA` hierarchy, for example through `KSPSetComputeOperators()`. Use `MatConvert()` to
+   obtain an assembled matrix for Galerkin coarse operators or direct solvers.
+
+.seealso: [](ch_matrices), `Mat`, `DMDA`, `MatCreate()`, `MatSetDM()`, `DMCreateMatrix()`, `MatSetValuesStencil()`, `MATHYPRESTRUCT`
+M*/
+
+static PetscErrorCode MatSetValuesLocal_Stencil(Mat mat, PetscInt nrow, const PetscInt irow[], PetscInt ncol, const PetscInt icol[], const PetscScalar y[], InsertMode addv)
+{
+  Mat_Stencil   *ex  = (Mat_Stencil *)mat->data;
+  const PetscInt dof = ex->dof, bs2 = dof * dof, gnx = ex->gnx, gnxgny = ex->gnx * ex->gny;
+  const PetscInt wx = 2 * ex->sw + 1, wy = 2 * ex->swy + 1;
+
+  PetscFunctionBegin;
+  for (PetscInt r = 0; r < nrow; ++r) {
+    PetscInt pt, c, gi, gj, gk, p;
+
+    if (irow[r] < 0) continue;
+    pt = irow[r] / dof;
+    c  = irow[r] % dof;
+    gi = pt % gnx;
+    gj = (pt / gnx) % ex->gny;
+    gk = pt / gnxgny;
+    PetscCheck(gi >= ex->xs && gi < ex->xs + ex->nx && gj >= ex->ys && gj < ex->ys + ex->ny && gk >= ex->zs && gk < ex->zs + ex->nz, PETSC_COMM_SELF, PETSC_ERR_SUP, "Local row %" PetscInt_FMT " is not owned by this process, only owned rows may be set", irow[r]);
+    p = ((gk - ex->zs) * ex->ny + gj - ex->ys) * ex->nx + gi - ex->xs;
+    for (PetscInt cc = 0; cc < ncol; ++cc) {
+      PetscInt     cpt, di, dj, dk, s;
+      PetscScalar *v;
+
+      if (icol[cc] < 0) continue;
+      cpt = icol[cc] / dof;
+      di  = cpt % gnx - gi;
+      dj  = (cpt / gnx) % ex->gny - gj;
+      dk  = cpt / gnxgny - gk;
+      s   = (PetscAbsInt(di) > ex->sw || PetscAbsInt(dj) > ex->swy || PetscAbsInt(dk) > ex->swz) ? -1 : ex->entry[((dk + ex->swz) * wy + dj + ex->swy) * wx + di + ex->sw];
+      PetscCheck(s >= 0, PETSC_COMM_SELF, PETSC_ERR_ARG_OUTOFRANGE, "Local column %" PetscInt_FMT " is outside the stencil of local row %" PetscInt_FMT, icol[cc], irow[r]);
+      v = &ex->vals[(s * ex->n + p) * bs2 + c * dof + icol[cc] % dof];
+      if (addv == INSERT_VALUES) *v = y[r * ncol + cc];
+      else *v += y[r * ncol + cc];
+    }
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/* yy += A xx, where xx is the ghosted local array */
+static PetscErrorCode MatStencilApply_Private(Mat_Stencil *ex, const PetscScalar xx[], PetscScalar yy[])
+{
+  const PetscInt dof = ex->dof, bs2 = dof * dof;
+
+  PetscFunctionBegin;
+  for (PetscInt k = 0; k < ex->nz; ++k) {
+    for (PetscInt j = 0; j < ex->ny; ++j) {
+      const PetscInt p0 = (k * ex->ny + j) * ex->nx;
+      const PetscInt l0 = ((k + ex->zs) * ex->gny + j + ex->ys) * ex->gnx + ex->xs;
+      PetscScalar   *yp = yy + p0 * dof;
+
+      for (PetscInt s = 0; s < ex->ns; ++s) {
+        const PetscInt    *rg = &ex->range[6 * s];
+        const PetscScalar *a  = ex->vals + (s * ex->n + p0) * bs2;
+        const PetscScalar *xp = xx + (l0 + ex->offset[s]) * dof;
+
+        if (j < rg[2] || j >= rg[3] || k < rg[4] || k >= rg[5]) continue;
+        if (dof == 1) {
+          PetscPragmaSIMD
+          for (PetscInt i = rg[0]; i < rg[1]; ++i) yp[i] += a[i] * xp[i];
+        } else {
+          for (PetscInt i = rg[0]; i < rg[1]; ++i) {
+            for (PetscInt c = 0; c < dof; ++c) {
+              PetscScalar sum = 0.0;
+
+              for (PetscInt d = 0; d < dof; ++d) sum += a[i * bs2 + c * dof + d] * xp[i * dof + d];
+              yp[i * dof + c] += sum;
+            }
+          }
+        }
+      }
+    }
+  }
+  PetscCall(PetscLogFlops(2.0 * ex->ns * ex->n * bs2));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MatMultAdd_Stencil(Mat A, Vec x, Vec y, Vec z)
+{
+  Mat_Stencil       *ex = (Mat_Stencil *)A->data;
+  Vec                xl;
+  const PetscScalar *xx;
+  PetscScalar       *zz;
+
+  PetscFunctionBegin;
+  PetscCall(DMGetLocalVector(ex->da, &xl));
+  PetscCall(DMGlobalToLocalBegin(ex->da, x, INSERT_VALUES, xl));
+  if (y != z) PetscCall(VecCopy(y, z));
+  PetscCall(DMGlobalToLocalEnd(ex->da, x, INSERT_VALUES, xl));
+  PetscCall(VecGetArrayRead(xl, &xx));
+  PetscCall(VecGetArray(z, &zz));
+  PetscCall(MatStencilApply_Private(ex, xx, zz));
+  PetscCall(VecRestoreArray(z, &zz));
+  PetscCall(VecRestoreArrayRead(xl, &xx));
+  PetscCall(DMRestoreLocalVector(ex->da, &xl));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MatMult_Stencil(Mat A, Vec x, Vec y)
+{
+  Mat_Stencil       *ex = (Mat_Stencil *)A->data;
+  Vec                xl;
+  const PetscScalar *xx;
+  PetscScalar       *yy;
+
+  PetscFunctionBegin;
+  PetscCall(DMGetLocalVector(ex->da, &xl));
+  PetscCall(DMGlobalToLocalBegin(ex->da, x, INSERT_VALUES, xl));
+  PetscCall(DMGlobalToLocalEnd(ex->da, x, INSERT_VALUES, xl));
+  PetscCall(VecGetArrayRead(xl, &xx));
+  PetscCall(VecGetArrayWrite(y, &yy));
+  PetscCall(PetscArrayzero(yy, ex->n * ex->dof));
+  PetscCall(MatStencilApply_Private(ex, xx, yy));
+  PetscCall(VecRestoreArrayWrite(y, &yy));
+  PetscCall(VecRestoreArrayRead(xl, &xx));
+  PetscCall(DMRestoreLocalVector(ex->da, &xl));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MatGetDiagonal_Stencil(Mat A, Vec v)
+{
+  Mat_Stencil       *ex  = (Mat_Stencil *)A->data;
+  const PetscInt     dof = ex->dof;
+  const PetscScalar *a   = ex->vals + ex->center * ex->n * dof * dof;
+  PetscScalar       *vv;
+
+  PetscFunctionBegin;
+  PetscCall(VecGetArrayWrite(v, &vv));
+  for (PetscInt p = 0; p < ex->n; ++p)
+    for (PetscInt c = 0; c < dof; ++c) vv[p * dof + c] = a[(p * dof + c) * dof + c];
+  PetscCall(VecRestoreArrayWrite(v, &vv));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MatShift_Stencil(Mat A, PetscScalar alpha)
+{
+  Mat_Stencil   *ex  = (Mat_Stencil *)A->data;
+  const PetscInt dof = ex->dof;
+  PetscScalar   *a   = ex->vals + ex->center * ex->n * dof * dof;
+
+  PetscFunctionBegin;
+  for (PetscInt p = 0; p < ex->n; ++p)
+    for (PetscInt c = 0; c < dof; ++c) a[(p * dof + c) * dof + c] += alpha;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MatScale_Stencil(Mat A, PetscScalar alpha)
+{
+  Mat_Stencil   *ex = (Mat_Stencil *)A->data;
+  const PetscInt N  = ex->ns * ex->n * ex->dof * ex->dof;
+
+  PetscFunctionBegin;
+  for (PetscInt i = 0; i < N; ++i) ex->vals[i] *= alpha;
+  PetscCall(PetscLogFlops(N));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MatZeroEntries_Stencil(Mat A)
+{
+  Mat_Stencil *ex = (Mat_Stencil *)A->data;
+
+  PetscFunctionBegin;
+  PetscCall(PetscArrayzero(ex->vals, ex->ns * ex->n * ex->dof * ex->dof));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/* One pointwise Gauss-Seidel/SOR sweep over the owned points, updating the ghosted local array xx in place */
+static PetscErrorCode MatStencilSweep_Private(Mat_Stencil *ex, const PetscScalar bb[], PetscReal omega, PetscReal fshift, PetscBool forward, PetscScalar xx[])
+{
+  const PetscInt dof = ex->dof, bs2 = dof * dof;
+
+  PetscFunctionBegin;
+  for (PetscInt q = 0; q < ex->n; ++q) {
+    const PetscInt p = forward ? q : ex->n - 1 - q;
+    const PetscInt i = p % ex->nx, j = (p / ex->nx) % ex->ny, k = p / (ex->nx * ex->ny);
+    const PetscInt l = ((k + ex->zs) * ex->gny + j + ex->ys) * ex->gnx + i + ex->xs;
+
+    for (PetscInt cc = 0; cc < dof; ++cc) {
+      const PetscInt    c    = forward ? cc : dof - 1 - cc;
+      const PetscScalar diag = ex->vals[(ex->center * ex->n + p) * bs2 + c * dof + c];
+      PetscScalar       sum  = bb[p * dof + c] + diag * xx[l * dof + c];
+
+      for (PetscInt s = 0; s < ex->ns; ++s) {
+        const PetscInt    *rg = &ex->range[6 * s];
+        const PetscScalar *a  = ex->vals + (s * ex->n + p) * bs2 + c * dof;
+        const PetscScalar *xp = xx + (l + ex->offset[s]) * dof;
+
+        if (i < rg[0] || i >= rg[1] || j < rg[2] || j >= rg[3] || k < rg[4] || k >= rg[5]) continue;
+        for (PetscInt d = 0; d < dof; ++d) sum -= a[d] * xp[d];
+      }
+      xx[l * dof + c] = (1.0 - omega) * xx[l * dof + c] + omega * sum / (diag + fshift);
+    }
+  }
+  PetscCall(PetscLogFlops(2.0 * ex->ns * ex->n * bs2));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MatSOR_Stencil(Mat A, Vec b, PetscReal omega, MatSORType flag, PetscReal fshift, PetscInt its, PetscInt lits, Vec x)
+{
+  Mat_Stencil       *ex = (Mat_Stencil *)A->data;
+  Vec                xl;
+  const PetscScalar *bb;
+  PetscScalar       *xx;
+  PetscMPIInt        size;
+
+  PetscFunctionBegin;
+  PetscCheck(!(flag & (SOR_EISENSTAT | SOR_APPLY_UPPER | SOR_APPLY_LOWER)), PetscObjectComm((PetscObject)A), PETSC_ERR_SUP, "SOR type %d not supported by matrix type %s", (int)flag, MATSTENCIL);
+  PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)A), &size));
+  PetscCheck(size == 1 || !(flag & (SOR_FORWARD_SWEEP | SOR_BACKWARD_SWEEP)), PetscObjectComm((PetscObject)A), PETSC_ERR_SUP, "Parallel SOR not supported, use a local sweep");
+  if (flag & SOR_ZERO_INITIAL_GUESS) PetscCall(VecSet(x, 0.0));
+  PetscCall(DMGetLocalVector(ex->da, &xl));
+  PetscCall(VecGetArrayRead(b, &bb));
+  for (PetscInt it = 0; it < its; ++it) {
+    PetscCall(DMGlobalToLocalBegin(ex->da, x, INSERT_VALUES, xl));
+    PetscCall(DMGlobalToLocalEnd(ex->da, x, INSERT_VALUES, xl));
+    PetscCall(VecGetArray(xl, &xx));
+    for (PetscInt lit = 0; lit < lits; ++lit) {
+      if (flag & (SOR_FORWARD_SWEEP | SOR_LOCAL_FORWARD_SWEEP)) PetscCall(MatStencilSweep_Private(ex, bb, omega, fshift, PETSC_TRUE, xx));
+      if (flag & (SOR_BACKWARD_SWEEP | SOR_LOCAL_BACKWARD_SWEEP)) PetscCall(MatStencilSweep_Private(ex, bb, omega, fshift, PETSC_FALSE, xx));
+    }
+    PetscCall(VecRestoreArray(xl, &xx));
+    PetscCall(DMLocalToGlobalBegin(ex->da, xl, INSERT_VALUES, x));
+    PetscCall(DMLocalToGlobalEnd(ex->da, xl, INSERT_VALUES, x));
+  }
+  PetscCall(VecRestoreArrayRead(b, &bb));
+  PetscCall(DMRestoreLocalVector(ex->da, &xl));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MatConvert_Stencil(Mat A, MatType newtype, MatReuse reuse, Mat *newmat)
+{
+  Mat_Stencil           *ex  = (Mat_Stencil *)A->data;
+  const PetscInt         dof = ex->dof, bs2 = dof * dof, nnz = ex->ns * dof;
+  ISLocalToGlobalMapping ltog;
+  PetscInt              *cols;
+  PetscScalar           *v;
+  Mat                    B;
+
+  PetscFunctionBegin;
+  if (reuse == MAT_REUSE_MATRIX) {
+    B = *newmat;
+    PetscCall(MatZeroEntries(B));
+  } else {
+    PetscCall(MatCreate(PetscObjectComm((PetscObject)A), &B));
+    PetscCall(MatSetSizes(B, A->rmap->n, A->cmap->n, A->rmap->N, A->cmap->N));
+    PetscCall(MatSetType(B, newtype));
+    PetscCall(MatSetBlockSize(B, dof));
+    PetscCall(MatSeqAIJSetPreallocation(B, nnz, NULL));
+    PetscCall(MatMPIAIJSetPreallocation(B, nnz, NULL, nnz, NULL));
+    PetscCall(DMGetLocalToGlobalMapping(ex->da, &ltog));
+    PetscCall(MatSetLocalToGlobalMapping(B, ltog, ltog));
+    PetscCall(MatSetDM(B, ex->da));
+  }
+  PetscCall(PetscMalloc2(nnz, &cols, nnz, &v));
+  for (PetscInt p = 0; p < ex->n; ++p) {
+    const PetscInt i = p % ex->nx, j = (p / ex->nx) % ex->ny, k = p / (ex->nx * ex->ny);
+    const PetscInt l = ((k + ex->zs) * ex->gny + j + ex->ys) * ex->gnx + i + ex->xs;
+
+    for (PetscInt c = 0; c < dof; ++c) {
+      const PetscInt row = l * dof + c;
+      PetscInt       nc  = 0;
+
+      for (PetscInt s = 0; s < ex->ns; ++s) {
+        const PetscInt *rg = &ex->range[6 * s];
+
+        if (i < rg[0] || i >= rg[1] || j < rg[2] || j >= rg[3] || k < rg[4] || k >= rg[5]) continue;
+        for (PetscInt d = 0; d < dof; ++d) {
+          cols[nc] = (l + ex->offset[s]) * dof + d;
+          v[nc++]  = ex->vals[(s * ex->n + p) * bs2 + c * dof + d];
+        }
+      }
+      PetscCall(MatSetValuesLocal(B, 1, &row, nc, cols, v, INSERT_VALUES));
+    }
+  }
+  PetscCall(PetscFree2(cols, v));
+  PetscCall(MatAssemblyBegin(B, MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(B, MAT_FINAL_ASSEMBLY));
+  if (reuse == MAT_INPLACE_MATRIX) PetscCall(MatHeaderReplace(A, &B));
+  else *newmat = B;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MatDuplicate_Stencil(Mat A, MatDuplicateOption op, Mat *M)
+{
+  Mat_Stencil *ex = (Mat_Stencil *)A->data;
+
+  PetscFunctionBegin;
+  PetscCall(MatCreate(PetscObjectComm((PetscObject)A), M));
+  PetscCall(MatSetSizes(*M, A->rmap->n, A->cmap->n, A->rmap->N, A->cmap->N));
+  PetscCall(MatSetBlockSizesFromMats(*M, A, A));
+  PetscCall(MatSetType(*M, MATSTENCIL));
+  PetscCall(MatSetDM(*M, ex->da));
+  PetscCall(MatSetUp(*M));
+  if (A->rmap->mapping) PetscCall(MatSetLocalToGlobalMapping(*M, A->rmap->mapping, A->cmap->mapping));
+  (*M)->stencil = A->stencil;
+  if (op == MAT_COPY_VALUES) {
+    Mat_Stencil *mx = (Mat_Stencil *)(*M)->data;
+
+    PetscCall(PetscArraycpy(mx->vals, ex->vals, ex->ns * ex->n * ex->dof * ex->dof));
+    PetscCall(MatAssemblyBegin(*M, MAT_FINAL_ASSEMBLY));
+    PetscCall(MatAssemblyEnd(*M, MAT_FINAL_ASSEMBLY));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MatCopy_Stencil(Mat A, Mat B, MatStructure str)
+{
+  Mat_Stencil *ex = (Mat_Stencil *)A->data, *bx = (Mat_Stencil *)B->data;
+  PetscBool    same;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectTypeCompare((PetscObject)B, MATSTENCIL, &same));
+  if (same) same = (PetscBool)(ex->da == bx->da && ex->ns == bx->ns && ex->n == bx->n && ex->dof == bx->dof);
+  if (!same) {
+    PetscCall(MatConvert_Stencil(A, NULL, MAT_REUSE_MATRIX, &B));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  PetscCall(PetscArraycpy(bx->vals, ex->vals, ex->ns * ex->n * ex->dof * ex->dof));
+  PetscCall(MatAssemblyBegin(B, MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(B, MAT_FINAL_ASSEMBLY));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/* Only the storage is described for info formats, otherwise the matrix is viewed through an assembled copy */
+static PetscErrorCode MatView_Stencil(Mat A, PetscViewer viewer)
+{
+  Mat_Stencil      *ex = (Mat_Stencil *)A->data;
+  const char       *prefix;
+  PetscViewerFormat format;
+  PetscBool         isascii;
+  Mat               B;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectTypeCompare((PetscObject)viewer, PETSCVIEWERASCII, &isascii));
+  PetscCall(PetscViewerGetFormat(viewer, &format));
+  if (isascii && (format == PETSC_VIEWER_ASCII_INFO || format == PETSC_VIEWER_ASCII_INFO_DETAIL)) {
+    PetscCall(PetscViewerASCIIPrintf(viewer, "%" PetscInt_FMT " stencil entries of %" PetscInt_FMT " x %" PetscInt_FMT " blocks per grid point\n", ex->ns, ex->dof, ex->dof));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  PetscCall(MatConvert(A, MATAIJ, MAT_INITIAL_MATRIX, &B));
+  PetscCall(PetscObjectGetOptionsPrefix((PetscObject)A, &prefix));
+  PetscCall(PetscObjectSetOptionsPrefix((PetscObject)B, prefix));
+  PetscCall(PetscObjectSetName((PetscObject)B, ((PetscObject)A)->name));
+  ((PetscObject)B)->donotPetscObjectPrintClassNamePrefixType = PETSC_TRUE;
+  PetscCall(MatView(B, viewer));
+  ((PetscObject)B)->donotPetscObjectPrintClassNamePrefixType = PETSC_FALSE;
+  PetscCall(MatDestroy(&B));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MatDestroy_Stencil(Mat mat)
+{
+  Mat_Stencil *ex = (Mat_Stencil *)mat->data;
+
+  PetscFunctionBegin;
+  PetscCall(PetscFree4(ex->entry, ex->offset, ex->range, ex->vals));
+  PetscCall(DMDestroy(&ex->da));
+  PetscCall(PetscFree(mat->data));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MatSetUp_Stencil(Mat mat)
+{
+  Mat_Stencil    *ex = (Mat_Stencil *)mat->data;
+  DM              da;
+  DMDAStencilType st;
+  PetscInt        xs, ys, zs, gxs, gys, gzs, gnz, wx, wy, wz, s = 0;
+  PetscBool       isda;
+
+  PetscFunctionBegin;
+  PetscCall(MatGetDM(mat, &da));
+  PetscCheck(da, PetscObjectComm((PetscObject)mat), PETSC_ERR_ARG_WRONGSTATE, "Matrix type %s requires a DMDA, use MatSetDM() or DMCreateMatrix()", MATSTENCIL);
+  PetscCall(PetscObjectTypeCompare((PetscObject)da, DMDA, &isda));
+  PetscCheck(isda, PetscObjectComm((PetscObject)mat), PETSC_ERR_ARG_WRONG, "Matrix type %s requires a DMDA, not a %s", MATSTENCIL, ((PetscObject)da)->type_name);
+  PetscCall(PetscObjectReference((PetscObject)da));
+  PetscCall(DMDestroy(&ex->da));
+  PetscCall(PetscFree4(ex->entry, ex->offset, ex->range, ex->vals));
+  ex->da = da;
+
+  PetscCall(DMDAGetInfo(da, &ex->dim, NULL, NULL, NULL, NULL, NULL, NULL, &ex->dof, &ex->sw, NULL, NULL, NULL, &st));
+  PetscCall(DMDAGetCorners(da, &xs, &ys, &zs, &ex->nx, &ex->ny, &ex->nz));
+  PetscCall(DMDAGetGhostCorners(da, &gxs, &gys, &gzs, &ex->gnx, &ex->gny, &gnz));
+  ex->xs  = xs - gxs;
+  ex->ys  = ys - gys;
+  ex->zs  = zs - gzs;
+  ex->n   = ex->nx * ex->ny * ex->nz;
+  ex->swy = ex->dim > 1 ? ex->sw : 0;
+  ex->swz = ex->dim > 2 ? ex->sw : 0;
+  wx      = 2 * ex->sw + 1;
+  wy      = 2 * ex->swy + 1;
+  wz      = 2 * ex->swz + 1;
+  ex->ns  = st == DMDA_STENCIL_BOX ? wx * wy * wz : 1 + 2 * ex->dim * ex->sw;
+
+  PetscCall(PetscMalloc4(wx * wy * wz, &ex->entry, ex->ns, &ex->offset, 6 * ex->ns, &ex->range, ex->ns * ex->n * ex->dof * ex->dof, &ex->vals));
+  PetscCall(PetscArrayzero(ex->vals, ex->ns * ex->n * ex->dof * ex->dof));
+  for (PetscInt dk = -ex->swz; dk <= ex->swz; ++dk) {
+    for (PetscInt dj = -ex->swy; dj <= ex->swy; ++dj) {
+      for (PetscInt di = -ex->sw; di <= ex->sw; ++di) {
+        PetscInt *e = &ex->entry[((dk + ex->swz) * wy + dj + ex->swy) * wx + di + ex->sw];
+
+        if (st == DMDA_STENCIL_STAR && (di != 0) + (dj != 0) + (dk != 0) > 1) {
+          *e = -1;
+          continue;
+        }
+        if (!di && !dj && !dk) ex->center = s;
+        ex->offset[s]        = (dk * ex->gny + dj) * ex->gnx + di;
+        ex->range[6 * s + 0] = PetscMax(0, -(ex->xs + di));
+        ex->range[6 * s + 1] = PetscMin(ex->nx, ex->gnx - ex->xs - di);
+        ex->range[6 * s + 2] = PetscMax(0, -(ex->ys + dj));
+        ex->range[6 * s + 3] = PetscMin(ex->ny, ex->gny - ex->ys - dj);
+        ex->range[6 * s + 4] = PetscMax(0, -(ex->zs + dk));
+        ex->range[6 * s + 5] = PetscMin(ex->nz, gnz - ex->zs - dk);
+        *e                   = s++;
+      }
+    }
+  }
+
+  if (mat->rmap->n < 0) PetscCall(MatSetSizes(mat, ex->dof * ex->n, ex->dof * ex->n, PETSC_DETERMINE, PETSC_DETERMINE));
+  PetscCall(PetscLayoutSetBlockSize(mat->rmap, ex->dof));
+  PetscCall(PetscLayoutSetBlockSize(mat->cmap, ex->dof));
+  PetscCall(PetscLayoutSetUp(mat->rmap));
+  PetscCall(PetscLayoutSetUp(mat->cmap));
+  PetscCheck(mat->rmap->n == ex->dof * ex->n && mat->cmap->n == ex->dof * ex->n, PETSC_COMM_SELF, PETSC_ERR_ARG_SIZ, "Local matrix sizes %" PetscInt_FMT " x %" PetscInt_FMT " do not match the DMDA local size %" PetscInt_FMT, mat->rmap->n, mat->cmap->n, ex->dof * ex->n);
+  mat->preallocated = PETSC_TRUE;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PETSC_EXTERN PetscErrorCode MatCreate_Stencil(Mat B)
+{
+  Mat_Stencil *ex;
+
+  PetscFunctionBegin;
+  PetscCall(PetscNew(&ex));
+  B->data      = (void *)ex;
+  B->assembled = PETSC_FALSE;
+
+  B->insertmode = NOT_SET_VALUES;
+
+  B->ops->setup          = MatSetUp_Stencil;
+  B->ops->setvalueslocal = MatSetValuesLocal_Stencil;
+  B->ops->mult           = MatMult_Stencil;
+  B->ops->multadd        = MatMultAdd_Stencil;
+  B->ops->getdiagonal    = MatGetDiagonal_Stencil;
+  B->ops->shift          = MatShift_Stencil;
+  B->ops->scale          = MatScale_Stencil;
+  B->ops->sor            = MatSOR_Stencil;
+  B->ops->zeroentries    = MatZeroEntries_Stencil;
+  B->ops->convert        = MatConvert_Stencil;
+  B->ops->duplicate      = MatDuplicate_Stencil;
+  B->ops->copy           = MatCopy_Stencil;
+  B->ops->view           = MatView_Stencil;
+  B->ops->destroy        = MatDestroy_Stencil;
+
+  PetscCall(PetscObjectChangeTypeName((PetscObject)B, MATSTENCIL));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
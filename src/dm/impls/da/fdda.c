@@ -550,6 +550,7 @@ static PetscErrorCode MatView_MPI_DA(Mat A, PetscViewer viewer)
 
   /* call viewer on natural ordering */
   PetscCall(PetscObjectBaseTypeCompare((PetscObject)A, MATMPISELL, &flag));
+  if (!flag) PetscCall(PetscObjectTypeCompare((PetscObject)A, MATSTENCIL, &flag));
   if (flag) {
     PetscCall(MatConvert(A, MATAIJ, MAT_INITIAL_MATRIX, &AA));
     A = AA;
@@ -1935,13 +1935,172 @@ PetscErrorCode DMPlexLabelsLoad_HDF5_Internal(DM dm, PetscViewer viewer, PetscSF
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/* Merge the saved parts [rank * distSize / size, (rank + 1) * distSize / size), read by this process as contiguous chunks, into a single part.
+   If distSize < size, each process reads at most one saved part and only the owners are renumbered */
+static PetscErrorCode DMPlexDistributionMerge_HDF5_Private(DM dm, PetscSF sf, PetscInt distSize, IS *chartSizesIS, IS *ownersIS, IS *gpointsIS)
+{
+  MPI_Comm        comm;
+  PetscMPIInt     size, rank;
+  PetscInt        depth, d, pStart, pEnd, p, q, n, m, lsize;
+  PetscInt       *partOwner, *perm, *leafDepth, *rootDepth, *strata, *offsets, *order, *chartSize, *mowners, *mgpoints;
+  const PetscInt *owners, *gpoints;
+  PetscLayout     layout;
+  PetscSF         tmpsf;
+  PetscBT         unique;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectGetComm((PetscObject)dm, &comm));
+  PetscCallMPI(MPI_Comm_size(comm, &size));
+  PetscCallMPI(MPI_Comm_rank(comm, &rank));
+  PetscCall(ISGetLocalSize(*ownersIS, &n));
+  PetscCall(ISGetIndices(*ownersIS, &owners));
+  PetscCall(ISGetIndices(*gpointsIS, &gpoints));
+  /* Saved rank -> loading rank */
+  PetscCall(PetscMalloc1(distSize, &partOwner));
+  for (q = 0; q < size; ++q) {
+    for (p = (q * distSize) / size; p < ((q + 1) * distSize) / size; ++p) partOwner[p] = q;
+  }
+  /* Keep the first occurrence of each point shared by the merged parts */
+  PetscCall(PetscBTCreate(n, &unique));
+  PetscCall(PetscMalloc1(n, &perm));
+  for (p = 0; p < n; ++p) perm[p] = p;
+  PetscCall(PetscSortIntWithPermutation(n, gpoints, perm));
+  for (p = 0; p < n;) {
+    PetscInt first = perm[p];
+
+    for (q = p + 1; q < n && gpoints[perm[q]] == gpoints[perm[p]]; ++q) first = PetscMin(first, perm[q]);
+    PetscCall(PetscBTSet(unique, first));
+    p = q;
+  }
+  /* Fetch the depth of each point from the loaded topology */
+  PetscCall(DMPlexGetDepth(dm, &depth));
+  PetscCallMPI(MPIU_Allreduce(MPI_IN_PLACE, &depth, 1, MPIU_INT, MPI_MAX, comm));
+  PetscCall(DMPlexGetChart(dm, &pStart, &pEnd));
+  PetscCall(PetscSFGetGraph(sf, &lsize, NULL, NULL, NULL));
+  PetscCall(PetscMalloc3(pEnd - pStart, &leafDepth, lsize, &rootDepth, n, &strata));
+  for (d = 0; d <= depth; ++d) {
+    PetscInt sStart, sEnd;
+
+    PetscCall(DMPlexGetDepthStratum(dm, d, &sStart, &sEnd));
+    for (p = sStart; p < sEnd; ++p) leafDepth[p - pStart] = d;
+  }
+  for (p = 0; p < lsize; ++p) rootDepth[p] = -1;
+  PetscCall(PetscSFReduceBegin(sf, MPIU_INT, leafDepth, rootDepth, MPI_MAX));
+  PetscCall(PetscSFReduceEnd(sf, MPIU_INT, leafDepth, rootDepth, MPI_MAX));
+  PetscCall(PetscLayoutCreate(comm, &layout));
+  PetscCall(PetscLayoutSetLocalSize(layout, lsize));
+  PetscCall(PetscLayoutSetBlockSize(layout, 1));
+  PetscCall(PetscLayoutSetUp(layout));
+  PetscCall(PetscSFCreate(comm, &tmpsf));
+  PetscCall(PetscSFSetGraphLayout(tmpsf, layout, n, NULL, PETSC_OWN_POINTER, gpoints));
+  PetscCall(PetscLayoutDestroy(&layout));
+  PetscCall(PetscSFBcastBegin(tmpsf, MPIU_INT, rootDepth, strata, MPI_REPLACE));
+  PetscCall(PetscSFBcastEnd(tmpsf, MPIU_INT, rootDepth, strata, MPI_REPLACE));
+  PetscCall(PetscSFDestroy(&tmpsf));
+  /* Strata must stay contiguous; order them as in the saved global numbering, see RenumberGlobalPointNumbersPerStratum_Private() */
+  PetscCall(PetscMalloc2(depth + 1, &offsets, depth + 1, &order));
+  for (d = 0; d <= depth; ++d) {
+    offsets[d] = PETSC_INT_MAX;
+    order[d]   = d;
+  }
+  for (p = 0; p < n; ++p) offsets[strata[p]] = PetscMin(offsets[strata[p]], gpoints[p]);
+  PetscCallMPI(MPIU_Allreduce(MPI_IN_PLACE, offsets, depth + 1, MPIU_INT, MPI_MIN, comm));
+  PetscCall(PetscSortIntWithPermutation(depth + 1, offsets, order));
+  for (p = 0, m = 0; p < n; ++p)
+    if (PetscBTLookup(unique, p)) ++m;
+  PetscCall(PetscMalloc1(1, &chartSize));
+  PetscCall(PetscMalloc1(m, &mowners));
+  PetscCall(PetscMalloc1(m, &mgpoints));
+  *chartSize = m;
+  for (d = 0, q = 0; d <= depth; ++d) {
+    for (p = 0; p < n; ++p) {
+      if (strata[p] != order[d] || !PetscBTLookup(unique, p)) continue;
+      mowners[q]  = partOwner[owners[p]];
+      mgpoints[q] = gpoints[p];
+      ++q;
+    }
+  }
+  PetscCheck(q == m, PETSC_COMM_SELF, PETSC_ERR_PLIB, "Mismatching merged chart sizes: %" PetscInt_FMT " != %" PetscInt_FMT, q, m);
+  PetscCall(PetscFree2(offsets, order));
+  PetscCall(PetscFree3(leafDepth, rootDepth, strata));
+  PetscCall(PetscFree(perm));
+  PetscCall(PetscFree(partOwner));
+  PetscCall(PetscBTDestroy(&unique));
+  PetscCall(ISRestoreIndices(*ownersIS, &owners));
+  PetscCall(ISRestoreIndices(*gpointsIS, &gpoints));
+  PetscCall(ISDestroy(chartSizesIS));
+  PetscCall(ISDestroy(ownersIS));
+  PetscCall(ISDestroy(gpointsIS));
+  PetscCall(ISCreateGeneral(comm, 1, chartSize, PETSC_OWN_POINTER, chartSizesIS));
+  PetscCall(ISCreateGeneral(comm, m, mowners, PETSC_OWN_POINTER, ownersIS));
+  PetscCall(ISCreateGeneral(comm, m, mgpoints, PETSC_OWN_POINTER, gpointsIS));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/* Split the saved part held by this process, if any, among the processes q of its group, q * distSize / size == part, with a shell
+   partition of its owned cells in their saved order, and compose the migration into distsf */
+static PetscErrorCode DMPlexDistributionSplit_HDF5_Private(PetscInt distSize, PetscSF *distsf, DM *distdm)
+{
+  MPI_Comm         comm;
+  PetscMPIInt      size, rank;
+  PetscInt         part, cStart, cEnd, pStart, pEnd, c, l, q, q0, ngroup, nleaves, nowned, *sizes, *points;
+  const PetscInt  *ilocal;
+  const char      *distribution_name;
+  PetscSF          pointSF, migrationSF, sf;
+  PetscPartitioner partitioner;
+  PetscBT          leaves;
+  DM               splitdm;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectGetComm((PetscObject)*distdm, &comm));
+  PetscCallMPI(MPI_Comm_size(comm, &size));
+  PetscCallMPI(MPI_Comm_rank(comm, &rank));
+  PetscCall(DMPlexGetChart(*distdm, &pStart, &pEnd));
+  PetscCall(DMPlexGetHeightStratum(*distdm, 0, &cStart, &cEnd));
+  PetscCall(DMGetPointSF(*distdm, &pointSF));
+  PetscCall(PetscSFGetGraph(pointSF, NULL, &nleaves, &ilocal, NULL));
+  PetscCall(PetscBTCreate(pEnd - pStart, &leaves));
+  for (l = 0; l < nleaves; ++l) PetscCall(PetscBTSet(leaves, (ilocal ? ilocal[l] : l) - pStart));
+  for (c = cStart, nowned = 0; c < cEnd; ++c)
+    if (!PetscBTLookup(leaves, c - pStart)) ++nowned;
+  PetscCall(PetscBTDestroy(&leaves));
+  PetscCall(PetscCalloc2(size, &sizes, nowned, &points));
+  if (nowned) {
+    part = (rank * distSize) / size;
+    for (q = 0, q0 = -1, ngroup = 0; q < size; ++q) {
+      if ((q * distSize) / size != part) continue;
+      if (q0 < 0) q0 = q;
+      ++ngroup;
+    }
+    for (q = 0; q < ngroup; ++q) sizes[q0 + q] = nowned / ngroup + (q < nowned % ngroup ? 1 : 0);
+    for (c = 0; c < nowned; ++c) points[c] = c;
+  }
+  PetscCall(PetscPartitionerCreate(comm, &partitioner));
+  PetscCall(PetscPartitionerSetType(partitioner, PETSCPARTITIONERSHELL));
+  PetscCall(PetscPartitionerShellSetPartition(partitioner, size, sizes, points));
+  PetscCall(PetscFree2(sizes, points));
+  PetscCall(DMPlexSetPartitioner(*distdm, partitioner));
+  PetscCall(PetscPartitionerDestroy(&partitioner));
+  PetscCall(DMPlexDistribute(*distdm, 0, &migrationSF, &splitdm));
+  PetscCall(PetscSFCompose(*distsf, migrationSF, &sf));
+  PetscCall(PetscSFDestroy(&migrationSF));
+  PetscCall(PetscSFDestroy(distsf));
+  *distsf = sf;
+  PetscCall(PetscObjectSetName((PetscObject)splitdm, ((PetscObject)*distdm)->name));
+  PetscCall(DMPlexDistributionGetName(*distdm, &distribution_name));
+  PetscCall(DMPlexDistributionSetName(splitdm, distribution_name));
+  PetscCall(DMDestroy(distdm));
+  *distdm = splitdm;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode DMPlexDistributionLoad_HDF5_Private(DM dm, PetscViewer viewer, PetscSF sf, PetscSF *distsf, DM *distdm)
 {
   MPI_Comm        comm;
   PetscMPIInt     size, rank;
   PetscInt        dist_size;
   const char     *distribution_name;
-  PetscInt        p, lsize;
+  PetscInt        p, lsize, nparts;
   IS              chartSizesIS, ownersIS, gpointsIS;
   const PetscInt *chartSize, *owners, *gpoints;
   PetscLayout     layout;
@@ -1964,20 +2123,28 @@ static PetscErrorCode DMPlexDistributionLoad_HDF5_Private(DM dm, PetscViewer vie
     PetscCheck(has, PETSC_COMM_SELF, PETSC_ERR_ARG_WRONG, "Distribution %s cannot be found: HDF5 group %s not found in file", distribution_name, full_group);
   }
   PetscCall(PetscViewerHDF5ReadAttribute(viewer, NULL, "comm_size", PETSC_INT, NULL, (void *)&dist_size));
-  PetscCheck(dist_size == (PetscInt)size, PETSC_COMM_SELF, PETSC_ERR_ARG_SIZ, "Mismatching comm sizes: comm size of this session (%d) != comm size used for %s (%" PetscInt_FMT ")", size, distribution_name, dist_size);
+  /* Each process reads the contiguous chunks of the saved parts it is assigned; more than one if dist_size > size, at most one otherwise */
+  nparts = ((rank + 1) * dist_size) / size - (rank * dist_size) / size;
   PetscCall(ISCreate(comm, &chartSizesIS));
   PetscCall(PetscObjectSetName((PetscObject)chartSizesIS, "chart_sizes"));
   PetscCall(ISCreate(comm, &ownersIS));
   PetscCall(PetscObjectSetName((PetscObject)ownersIS, "owners"));
   PetscCall(ISCreate(comm, &gpointsIS));
   PetscCall(PetscObjectSetName((PetscObject)gpointsIS, "global_point_numbers"));
-  PetscCall(PetscLayoutSetLocalSize(chartSizesIS->map, 1));
+  PetscCall(PetscLayoutSetLocalSize(chartSizesIS->map, nparts));
   PetscCall(ISLoad(chartSizesIS, viewer));
   PetscCall(ISGetIndices(chartSizesIS, &chartSize));
-  PetscCall(PetscLayoutSetLocalSize(ownersIS->map, *chartSize));
-  PetscCall(PetscLayoutSetLocalSize(gpointsIS->map, *chartSize));
+  for (p = 0, lsize = 0; p < nparts; ++p) lsize += chartSize[p];
+  PetscCall(ISRestoreIndices(chartSizesIS, &chartSize));
+  PetscCall(PetscLayoutSetLocalSize(ownersIS->map, lsize));
+  PetscCall(PetscLayoutSetLocalSize(gpointsIS->map, lsize));
   PetscCall(ISLoad(ownersIS, viewer));
   PetscCall(ISLoad(gpointsIS, viewer));
+  if (dist_size != (PetscInt)size) {
+    PetscCall(PetscInfo(dm, "%s %" PetscInt_FMT " saved parts of distribution %s onto %d processes\n", dist_size > (PetscInt)size ? "Merging" : "Splitting", dist_size, distribution_name, size));
+    PetscCall(DMPlexDistributionMerge_HDF5_Private(dm, sf, dist_size, &chartSizesIS, &ownersIS, &gpointsIS));
+  }
+  PetscCall(ISGetIndices(chartSizesIS, &chartSize));
   PetscCall(ISGetIndices(ownersIS, &owners));
   PetscCall(ISGetIndices(gpointsIS, &gpoints));
   PetscCall(PetscSFCreate(comm, distsf));
@@ -2097,6 +2264,7 @@ static PetscErrorCode DMPlexDistributionLoad_HDF5_Private(DM dm, PetscViewer vie
   PetscCall(ISDestroy(&chartSizesIS));
   PetscCall(ISDestroy(&ownersIS));
   PetscCall(ISDestroy(&gpointsIS));
+  if (dist_size < (PetscInt)size) PetscCall(DMPlexDistributionSplit_HDF5_Private(dist_size, distsf, distdm));
   /* Record that overlap has been manually created.               */
   /* This is to pass `DMPlexCheckPointSF()`, which checks that    */
   /* pointSF does not contain cells in the leaves if overlap = 0. */
@@ -2365,6 +2365,13 @@ PetscErrorCode DMPlexIsDistributed(DM dm, PetscBool *distributed)
   this name. Conversely, if distribution name is set when loading, `DMPlexTopologyLoad()`
   loads the parallel distribution stored in file under this name.
 
+  The distribution can be loaded on any number of processes. On fewer processes than it was saved on,
+  each process reads and merges a contiguous range of the saved parts. On more processes, each saved
+  part is read by one process and its owned cells are split, in their saved order, among a contiguous
+  group of processes with `DMPlexDistribute()`. The resulting layout only depends on the saved
+  distribution and the number of loading processes, not on a partitioner, but the overlap of the saved
+  distribution is only kept when loading on as many or fewer processes.
+
 .seealso: `DMPLEX`, `DMPlexDistributionGetName()`, `DMPlexTopologyView()`, `DMPlexTopologyLoad()`
 @*/
 PetscErrorCode DMPlexDistributionSetName(DM dm, const char name[])
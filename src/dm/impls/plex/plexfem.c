@@ -5,6 +5,7 @@
 #include <petsc/private/hashsetij.h>
 #include <petsc/private/petscfeimpl.h>
 #include <petsc/private/petscfvimpl.h>
+#include <petsc/private/dmfieldimpl.h>
 
 PetscBool  Clementcite       = PETSC_FALSE;
 const char ClementCitation[] = "@article{clement1975approximation,\n"
@@ -47,42 +48,126 @@ static PetscErrorCode DMPlexConvertPlex(DM dm, DM *plex, PetscBool copy)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
-static PetscErrorCode PetscContainerCtxDestroy_PetscFEGeom(void **ctx)
+typedef struct {
+  PetscQuadrature  quad;        /* Quadrature the geometry was computed for */
+  PetscFEGeom     *geom;        /* The cached geometry */
+  PetscInt         nout;        /* Number of DMPlexGetFEGeom() calls not yet restored */
+  PetscObjectId    valuesId;    /* Coordinate values the geometry was computed from */
+  PetscObjectState valuesState; /* and their state at that time */
+  PetscObjectState pointState;  /* State of the point IS at that time */
+} DMPlexFEGeomCacheEntry;
+
+typedef struct {
+  PetscInt                n;
+  DMPlexFEGeomCacheEntry *entries;
+} DMPlexFEGeomCache;
+
+static PetscErrorCode PetscContainerCtxDestroy_DMPlexFEGeomCache(void **ctx)
 {
-  PetscFEGeom *geom = (PetscFEGeom *)*ctx;
+  DMPlexFEGeomCache *cache = (DMPlexFEGeomCache *)*ctx;
 
   PetscFunctionBegin;
-  PetscCall(PetscFEGeomDestroy(&geom));
+  for (PetscInt e = 0; e < cache->n; ++e) {
+    PetscCall(PetscQuadratureDestroy(&cache->entries[e].quad));
+    PetscCall(PetscFEGeomDestroy(&cache->entries[e].geom));
+  }
+  PetscCall(PetscFree(cache->entries));
+  PetscCall(PetscFree(cache));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
-static PetscErrorCode DMPlexGetFEGeom(DMField coordField, IS pointIS, PetscQuadrature quad, PetscFEGeomMode mode, PetscFEGeom **geom)
+/* Find the cache entry on pointIS for this mode and quadrature, creating the cache if requested */
+static PetscErrorCode DMPlexFEGeomCacheFind_Private(IS pointIS, PetscQuadrature quad, PetscFEGeomMode mode, PetscBool create, DMPlexFEGeomCache **cache, DMPlexFEGeomCacheEntry **entry)
 {
-  char           composeStr[33] = {0};
-  PetscObjectId  id;
+  char           composeStr[32] = {0};
   PetscContainer container;
 
   PetscFunctionBegin;
-  PetscCall(PetscObjectGetId((PetscObject)quad, &id));
-  PetscCall(PetscSNPrintf(composeStr, 32, "DMPlexGetFEGeom_%" PetscInt64_FMT "\n", id));
+  *cache = NULL;
+  *entry = NULL;
+  PetscCall(PetscSNPrintf(composeStr, sizeof(composeStr), "DMPlexGetFEGeom_%d", (int)mode));
   PetscCall(PetscObjectQuery((PetscObject)pointIS, composeStr, (PetscObject *)&container));
-  if (container) {
-    PetscCall(PetscContainerGetPointer(container, (void **)geom));
-  } else {
-    PetscCall(DMFieldCreateFEGeom(coordField, pointIS, quad, mode, geom));
+  if (container) PetscCall(PetscContainerGetPointer(container, (void **)cache));
+  else if (create) {
+    PetscCall(PetscNew(cache));
     PetscCall(PetscContainerCreate(PETSC_COMM_SELF, &container));
-    PetscCall(PetscContainerSetPointer(container, (void *)*geom));
-    PetscCall(PetscContainerSetCtxDestroy(container, PetscContainerCtxDestroy_PetscFEGeom));
+    PetscCall(PetscContainerSetPointer(container, (void *)*cache));
+    PetscCall(PetscContainerSetCtxDestroy(container, PetscContainerCtxDestroy_DMPlexFEGeomCache));
     PetscCall(PetscObjectCompose((PetscObject)pointIS, composeStr, (PetscObject)container));
     PetscCall(PetscContainerDestroy(&container));
   }
+  if (!*cache) PetscFunctionReturn(PETSC_SUCCESS);
+  for (PetscInt e = 0; e < (*cache)->n; ++e) {
+    PetscBool equal = (*cache)->entries[e].quad == quad ? PETSC_TRUE : PETSC_FALSE;
+
+    if (!equal) PetscCall(PetscQuadratureEqual((*cache)->entries[e].quad, quad, &equal));
+    if (equal) {
+      *entry = &(*cache)->entries[e];
+      break;
+    }
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+  The geometry is cached on pointIS, keyed by mode and quadrature contents, so it lives as long as the IS does. Cell and face sets used for
+  assembly come from label strata or ISIntersect_Caching_Internal(), which persist with the mesh, so residual, Jacobian, boundary and integral
+  routines all share one copy. The cached geometry is recomputed whenever the values of the coordinate field or the points of the IS have changed.
+  If it is still in use by an earlier call, a private copy is computed instead and released by DMPlexRestoreFEGeom().
+*/
+static PetscErrorCode DMPlexGetFEGeom(DMField coordField, IS pointIS, PetscQuadrature quad, PetscFEGeomMode mode, PetscFEGeom **geom)
+{
+  PetscObjectId           valuesId;
+  PetscObjectState        valuesState, pointState;
+  DMPlexFEGeomCache      *cache;
+  DMPlexFEGeomCacheEntry *entry;
+
+  PetscFunctionBegin;
+  PetscCall(DMFieldGetValuesState_Internal(coordField, &valuesId, &valuesState));
+  PetscCall(PetscObjectStateGet((PetscObject)pointIS, &pointState));
+  PetscCall(DMPlexFEGeomCacheFind_Private(pointIS, quad, mode, PETSC_TRUE, &cache, &entry));
+  if (entry && (entry->valuesId != valuesId || entry->valuesState != valuesState || entry->pointState != pointState)) {
+    if (entry->nout) {
+      PetscCall(DMFieldCreateFEGeom(coordField, pointIS, quad, mode, geom));
+      PetscFunctionReturn(PETSC_SUCCESS);
+    }
+    PetscCall(PetscFEGeomDestroy(&entry->geom));
+  }
+  if (!entry) {
+    DMPlexFEGeomCacheEntry *entries;
+
+    PetscCall(PetscMalloc1(cache->n + 1, &entries));
+    PetscCall(PetscArraycpy(entries, cache->entries, cache->n));
+    PetscCall(PetscFree(cache->entries));
+    cache->entries = entries;
+    entry          = &cache->entries[cache->n++];
+    PetscCall(PetscMemzero(entry, sizeof(*entry)));
+    PetscCall(PetscObjectReference((PetscObject)quad));
+    entry->quad = quad;
+  }
+  if (!entry->geom) {
+    PetscCall(DMFieldCreateFEGeom(coordField, pointIS, quad, mode, &entry->geom));
+    entry->valuesId    = valuesId;
+    entry->valuesState = valuesState;
+    entry->pointState  = pointState;
+  }
+  ++entry->nout;
+  *geom = entry->geom;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
 static PetscErrorCode DMPlexRestoreFEGeom(DMField coordField, IS pointIS, PetscQuadrature quad, PetscFEGeomMode mode, PetscFEGeom **geom)
 {
+  DMPlexFEGeomCache      *cache;
+  DMPlexFEGeomCacheEntry *entry;
+
   PetscFunctionBegin;
-  *geom = NULL;
+  if (!*geom) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(DMPlexFEGeomCacheFind_Private(pointIS, quad, mode, PETSC_FALSE, &cache, &entry));
+  if (entry && entry->geom == *geom) {
+    --entry->nout;
+    *geom = NULL;
+  } else PetscCall(PetscFEGeomDestroy(geom));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -251,6 +336,67 @@ PetscErrorCode DMPlexSetUseMatClosurePermutation(DM dm, PetscBool useClPerm)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+  DMPlexGetFEMNumThreads - Get the number of threads sharing the cell integration loop in FEM residual and Jacobian assembly
+
+  Not collective
+
+  Input Parameter:
+. dm - The `DM`
+
+  Output Parameter:
+. numThreads - The number of threads
+
+  Level: intermediate
+
+.seealso: `DMPlexSetFEMNumThreads()`, `DMPlexComputeResidualByKey()`, `DMPlexComputeJacobianByKey()`
+@*/
+PetscErrorCode DMPlexGetFEMNumThreads(DM dm, PetscInt *numThreads)
+{
+  DM_Plex *mesh = (DM_Plex *)dm->data;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(dm, DM_CLASSID, 1);
+  PetscAssertPointer(numThreads, 2);
+  *numThreads = mesh->femThreads;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+  DMPlexSetFEMNumThreads - Set the number of threads sharing the cell integration loop in FEM residual and Jacobian assembly
+
+  Logically collective
+
+  Input Parameters:
++ dm         - The `DM`
+- numThreads - The number of threads
+
+  Options Database Key:
+. -dm_plex_fem_num_threads <n> - The number of threads
+
+  Level: intermediate
+
+  Notes:
+  The cells of each batch-aligned chunk are split into contiguous ranges, one per thread, and each thread integrates its range into its own slice of the element
+  vectors or matrices using a private copy of the `PetscDS`. The element contributions are then added to the local `Vec` or `Mat` serially, so no two threads
+  ever write the same closure. The pointwise functions must therefore be thread-safe.
+
+  The loop runs on OpenMP threads only when PETSc is configured with OpenMP and thread safety, otherwise the ranges are integrated one after another.
+
+.seealso: `DMPlexGetFEMNumThreads()`, `DMPlexComputeResidualByKey()`, `DMPlexComputeJacobianByKey()`
+@*/
+PetscErrorCode DMPlexSetFEMNumThreads(DM dm, PetscInt numThreads)
+{
+  DM_Plex *mesh = (DM_Plex *)dm->data;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(dm, DM_CLASSID, 1);
+  PetscValidLogicalCollectiveInt(dm, numThreads, 2);
+  PetscCheck(numThreads > 0, PetscObjectComm((PetscObject)dm), PETSC_ERR_ARG_OUTOFRANGE, "Number of threads %" PetscInt_FMT " must be positive", numThreads);
+  mesh->femThreads = numThreads;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode DMPlexProjectRigidBody_Private(PetscInt dim, PetscReal t, const PetscReal X[], PetscInt Nc, PetscScalar *mode, void *ctx)
 {
   const PetscInt eps[3][3][3] = {
@@ -2428,7 +2574,17 @@ PetscErrorCode DMPlexComputeIntegral_Internal(DM dm, Vec locX, PetscInt cStart,
   PetscCall(PetscDSGetTotalDimension(prob, &totDim));
   PetscCall(PetscDSGetComponentOffsets(prob, &uOff));
   PetscCall(PetscDSGetComponentDerivativeOffsets(prob, &uOff_x));
-  PetscCall(ISCreateStride(PETSC_COMM_SELF, numCells, cStart, 1, &cellIS));
+  /* Use the persistent cell IS when possible, so that cached geometry is reused across calls */
+  PetscCall(DMPlexGetAllCells_Internal(dm, &cellIS));
+  if (cellIS) {
+    PetscInt        sStart, sEnd;
+    const PetscInt *points;
+
+    PetscCall(ISGetPointRange(cellIS, &sStart, &sEnd, &points));
+    PetscCall(ISRestorePointRange(cellIS, &sStart, &sEnd, &points));
+    if (points || sStart != cStart || sEnd != cEnd) PetscCall(ISDestroy(&cellIS));
+  }
+  if (!cellIS) PetscCall(ISCreateStride(PETSC_COMM_SELF, numCells, cStart, 1, &cellIS));
   PetscCall(PetscDSGetConstants(prob, &numConstants, &constants));
   /* Read Auxiliary DS information */
   PetscCall(DMGetAuxiliaryVec(dm, NULL, 0, 0, &locA));
@@ -2449,7 +2605,7 @@ PetscErrorCode DMPlexComputeIntegral_Internal(DM dm, Vec locX, PetscInt cStart,
   PetscCall(DMFieldGetDegree(coordField, cellIS, NULL, &maxDegree));
   if (maxDegree <= 1) {
     PetscCall(DMFieldCreateDefaultQuadrature(coordField, cellIS, &affineQuad));
-    if (affineQuad) PetscCall(DMFieldCreateFEGeom(coordField, cellIS, affineQuad, PETSC_FEGEOM_BASIC, &cgeomFEM));
+    if (affineQuad) PetscCall(DMPlexGetFEGeom(coordField, cellIS, affineQuad, PETSC_FEGEOM_BASIC, &cgeomFEM));
   }
   if (useFVM) {
     PetscFV   fv = NULL;
@@ -2526,13 +2682,13 @@ PetscErrorCode DMPlexComputeIntegral_Internal(DM dm, Vec locX, PetscInt cStart,
       Ne        = numChunks * numBatches * batchSize;
       Nr        = numCells % (numBatches * batchSize);
       offset    = numCells - Nr;
-      if (!affineQuad) PetscCall(DMFieldCreateFEGeom(coordField, cellIS, q, PETSC_FEGEOM_BASIC, &cgeomFEM));
+      if (!affineQuad) PetscCall(DMPlexGetFEGeom(coordField, cellIS, q, PETSC_FEGEOM_BASIC, &cgeomFEM));
       PetscCall(PetscFEGeomGetChunk(cgeomFEM, 0, offset, &chunkGeom));
       PetscCall(PetscFEIntegrate(prob, f, Ne, chunkGeom, u, probAux, a, cintegral));
       PetscCall(PetscFEGeomGetChunk(cgeomFEM, offset, numCells, &chunkGeom));
       PetscCall(PetscFEIntegrate(prob, f, Nr, chunkGeom, &u[offset * totDim], probAux, PetscSafePointerPlusOffset(a, offset * totDimAux), &cintegral[offset * Nf]));
       PetscCall(PetscFEGeomRestoreChunk(cgeomFEM, offset, numCells, &chunkGeom));
-      if (!affineQuad) PetscCall(PetscFEGeomDestroy(&cgeomFEM));
+      if (!affineQuad) PetscCall(DMPlexRestoreFEGeom(coordField, cellIS, q, PETSC_FEGEOM_BASIC, &cgeomFEM));
     } else if (id == PETSCFV_CLASSID) {
       PetscInt      foff;
       PetscPointFn *obj_func;
@@ -2564,7 +2720,7 @@ PetscErrorCode DMPlexComputeIntegral_Internal(DM dm, Vec locX, PetscInt cStart,
   PetscCall(DMDestroy(&plexA));
   PetscCall(PetscFree(u));
   /* Cleanup */
-  if (affineQuad) PetscCall(PetscFEGeomDestroy(&cgeomFEM));
+  if (affineQuad) PetscCall(DMPlexRestoreFEGeom(coordField, cellIS, affineQuad, PETSC_FEGEOM_BASIC, &cgeomFEM));
   PetscCall(PetscQuadratureDestroy(&affineQuad));
   PetscCall(ISDestroy(&cellIS));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -4347,31 +4503,15 @@ PetscErrorCode DMPlexRestoreFaceGeometry(DM dm, PetscInt fStart, PetscInt fEnd,
 
 PetscErrorCode DMSNESGetFEGeom(DMField coordField, IS pointIS, PetscQuadrature quad, PetscFEGeomMode mode, PetscFEGeom **geom)
 {
-  char           composeStr[33] = {0};
-  PetscObjectId  id;
-  PetscContainer container;
-
   PetscFunctionBegin;
-  PetscCall(PetscObjectGetId((PetscObject)quad, &id));
-  PetscCall(PetscSNPrintf(composeStr, 32, "DMSNESGetFEGeom_%" PetscInt64_FMT "\n", id));
-  PetscCall(PetscObjectQuery((PetscObject)pointIS, composeStr, (PetscObject *)&container));
-  if (container) {
-    PetscCall(PetscContainerGetPointer(container, (void **)geom));
-  } else {
-    PetscCall(DMFieldCreateFEGeom(coordField, pointIS, quad, mode, geom));
-    PetscCall(PetscContainerCreate(PETSC_COMM_SELF, &container));
-    PetscCall(PetscContainerSetPointer(container, (void *)*geom));
-    PetscCall(PetscContainerSetCtxDestroy(container, PetscContainerCtxDestroy_PetscFEGeom));
-    PetscCall(PetscObjectCompose((PetscObject)pointIS, composeStr, (PetscObject)container));
-    PetscCall(PetscContainerDestroy(&container));
-  }
+  PetscCall(DMPlexGetFEGeom(coordField, pointIS, quad, mode, geom));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
 PetscErrorCode DMSNESRestoreFEGeom(DMField coordField, IS pointIS, PetscQuadrature quad, PetscBool faceData, PetscFEGeom **geom)
 {
   PetscFunctionBegin;
-  *geom = NULL;
+  PetscCall(DMPlexRestoreFEGeom(coordField, pointIS, quad, faceData ? PETSC_FEGEOM_BOUNDARY : PETSC_FEGEOM_BASIC, geom));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -4429,7 +4569,7 @@ PetscErrorCode DMPlexComputeResidual_Patch_Internal(DM dm, PetscSection section,
     PetscCall(DMFieldGetDegree(coordField, cellIS, NULL, &maxDegree));
     if (maxDegree <= 1) {
       PetscCall(DMFieldCreateDefaultQuadrature(coordField, cellIS, &affineQuad));
-      if (affineQuad) PetscCall(DMSNESGetFEGeom(coordField, cellIS, affineQuad, PETSC_FEGEOM_BASIC, &affineGeom));
+      if (affineQuad) PetscCall(DMPlexGetFEGeom(coordField, cellIS, affineQuad, PETSC_FEGEOM_BASIC, &affineGeom));
     } else {
       PetscCall(PetscCalloc2(Nf, &quads, Nf, &geoms));
       for (f = 0; f < Nf; ++f) {
@@ -4446,7 +4586,7 @@ PetscErrorCode DMPlexComputeResidual_Patch_Internal(DM dm, PetscSection section,
 
           PetscCall(PetscFEGetQuadrature(fe, &quads[f]));
           PetscCall(PetscObjectReference((PetscObject)quads[f]));
-          PetscCall(DMSNESGetFEGeom(coordField, cellIS, quads[f], PETSC_FEGEOM_BASIC, &geoms[f]));
+          PetscCall(DMPlexGetFEGeom(coordField, cellIS, quads[f], PETSC_FEGEOM_BASIC, &geoms[f]));
         }
       }
     }
@@ -4699,7 +4839,7 @@ PetscErrorCode DMPlexComputeJacobian_Patch_Internal(DM dm, PetscSection section,
     PetscCall(PetscFEGetQuadrature(fe, &qGeom));
     PetscCall(PetscObjectReference((PetscObject)qGeom));
   }
-  PetscCall(DMSNESGetFEGeom(coordField, cellIS, qGeom, PETSC_FEGEOM_BASIC, &cgeomFEM));
+  PetscCall(DMPlexGetFEGeom(coordField, cellIS, qGeom, PETSC_FEGEOM_BASIC, &cgeomFEM));
   /* Compute volume integrals */
   if (assembleJac) PetscCall(MatZeroEntries(J));
   PetscCall(MatZeroEntries(JP));
@@ -4963,7 +5103,7 @@ PetscErrorCode DMPlexComputeBdResidualSingleByKey(DM dm, PetscWeakForm wf, Petsc
       PetscCall(PetscObjectReference((PetscObject)qGeom));
     }
     PetscCall(PetscQuadratureGetData(qGeom, NULL, NULL, &Nq, NULL, NULL));
-    PetscCall(DMSNESGetFEGeom(coordField, pointIS, qGeom, PETSC_FEGEOM_BOUNDARY, &fgeom));
+    PetscCall(DMPlexGetFEGeom(coordField, pointIS, qGeom, PETSC_FEGEOM_BOUNDARY, &fgeom));
     for (face = 0; face < numFaces; ++face) {
       const PetscInt point = points[face], *support;
       PetscScalar   *x     = NULL;
@@ -5139,6 +5279,171 @@ static PetscErrorCode DMPlexComputeBdResidual_Internal(DM dm, Vec locX, Vec locX
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+typedef struct {
+  PetscInt Nt;  /* Number of thread copies, including the original */
+  PetscDS *tds; /* The copies, tds[0] is the original */
+} DMPlexFEMThreadDS;
+
+static PetscErrorCode PetscContainerCtxDestroy_DMPlexFEMThreadDS(void **ctx)
+{
+  DMPlexFEMThreadDS *cache = (DMPlexFEMThreadDS *)*ctx;
+
+  PetscFunctionBegin;
+  for (PetscInt th = 1; th < cache->Nt; ++th) PetscCall(PetscDSDestroy(&cache->tds[th]));
+  PetscCall(PetscFree(cache->tds));
+  PetscCall(PetscFree(cache));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+  The integration kernels use the evaluation arrays and workspace stored in the PetscDS, so each thread gets its own copy. Thread 0 uses the
+  original. The copies are cached on ds, so they are dropped with it when the DM gets a new DS, and rebuilt if its discretizations change.
+  They share the weak form of ds, and its constants and contexts are copied on every call since they may change between evaluations.
+*/
+static PetscErrorCode DMPlexGetFEMThreadDS_Private(DM dm, PetscInt Nt, PetscDS ds, PetscDS *tds[])
+{
+  DMPlexFEMThreadDS *cache = NULL;
+  PetscContainer     container;
+  PetscWeakForm      wf;
+  PetscInt           Nf;
+  PetscBool          valid;
+
+  PetscFunctionBegin;
+  *tds = NULL;
+  if (!ds) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(PetscDSGetNumFields(ds, &Nf));
+  PetscCall(PetscObjectQuery((PetscObject)ds, "DMPlexFEMThreadDS", (PetscObject *)&container));
+  if (container) PetscCall(PetscContainerGetPointer(container, (void **)&cache));
+  valid = cache && cache->Nt >= Nt ? PETSC_TRUE : PETSC_FALSE;
+  for (PetscInt th = 1; valid && th < Nt; ++th) {
+    PetscInt Nft;
+
+    PetscCall(PetscDSGetNumFields(cache->tds[th], &Nft));
+    if (Nft != Nf) valid = PETSC_FALSE;
+    for (PetscInt f = 0; valid && f < Nf; ++f) {
+      PetscObject disc, disct;
+
+      PetscCall(PetscDSGetDiscretization(ds, f, &disc));
+      PetscCall(PetscDSGetDiscretization(cache->tds[th], f, &disct));
+      if (disc != disct) valid = PETSC_FALSE;
+    }
+  }
+  if (!valid) {
+    PetscCall(PetscNew(&cache));
+    cache->Nt = Nt;
+    PetscCall(PetscCalloc1(Nt, &cache->tds));
+    cache->tds[0] = ds;
+    for (PetscInt th = 1; th < Nt; ++th) {
+      PetscCall(PetscDSCreate(PETSC_COMM_SELF, &cache->tds[th]));
+      PetscCall(PetscDSCopy(ds, PETSC_DETERMINE, PETSC_DETERMINE, dm, cache->tds[th]));
+      PetscCall(PetscDSSetUp(cache->tds[th]));
+    }
+    PetscCall(PetscContainerCreate(PETSC_COMM_SELF, &container));
+    PetscCall(PetscContainerSetPointer(container, (void *)cache));
+    PetscCall(PetscContainerSetCtxDestroy(container, PetscContainerCtxDestroy_DMPlexFEMThreadDS));
+    PetscCall(PetscObjectCompose((PetscObject)ds, "DMPlexFEMThreadDS", (PetscObject)container));
+    PetscCall(PetscContainerDestroy(&container));
+  }
+  PetscCall(PetscDSGetWeakForm(ds, &wf));
+  for (PetscInt th = 1; th < Nt; ++th) {
+    PetscWeakForm wft;
+
+    PetscCall(PetscDSGetWeakForm(cache->tds[th], &wft));
+    if (wft != wf) PetscCall(PetscDSSetWeakForm(cache->tds[th], wf));
+    PetscCall(PetscDSCopyConstants(ds, cache->tds[th]));
+    for (PetscInt f = 0; f < Nf; ++f) {
+      void *ctx;
+
+      PetscCall(PetscDSGetContext(ds, f, &ctx));
+      PetscCall(PetscDSSetContext(cache->tds[th], f, ctx));
+    }
+  }
+  *tds = cache->tds;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/* Split the first Ne cells of geom, where Ne is a multiple of chunkSize, into contiguous ranges of whole chunks, one per thread */
+static PetscErrorCode DMPlexFEGetThreadChunks_Private(PetscInt Nt, PetscInt Ne, PetscInt chunkSize, PetscFEGeom *geom, PetscInt *cS[], PetscFEGeom **chunkGeoms[])
+{
+  const PetscInt numChunks = chunkSize > 0 ? Ne / chunkSize : 0;
+
+  PetscFunctionBegin;
+  PetscCall(PetscCalloc2(Nt, chunkGeoms, Nt + 1, cS));
+  for (PetscInt th = 0; th <= Nt; ++th) (*cS)[th] = ((th * numChunks) / Nt) * chunkSize;
+  for (PetscInt th = 0; th < Nt; ++th) PetscCall(PetscFEGeomGetChunk(geom, (*cS)[th], (*cS)[th + 1], &(*chunkGeoms)[th]));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode DMPlexFERestoreThreadChunks_Private(PetscInt Nt, PetscFEGeom *geom, PetscInt *cS[], PetscFEGeom **chunkGeoms[])
+{
+  PetscFunctionBegin;
+  for (PetscInt th = 0; th < Nt; ++th) PetscCall(PetscFEGeomRestoreChunk(geom, (*cS)[th], (*cS)[th + 1], &(*chunkGeoms)[th]));
+  PetscCall(PetscFree2(*chunkGeoms, *cS));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/* Integrate the residual over the first Ne cells of geom on Nt threads, each writing only its own slice of elemVec */
+static PetscErrorCode DMPlexFEIntegrateResidualThreaded_Private(PetscInt Nt, PetscDS tds[], PetscDS tdsAux[], PetscFormKey key, PetscInt Ne, PetscInt chunkSize, PetscFEGeom *geom, const PetscScalar u[], const PetscScalar u_t[], const PetscScalar a[], PetscReal t, PetscScalar elemVec[])
+{
+  PetscFEGeom  **chunkGeoms;
+  PetscInt      *cS, totDim, totDimAux = 0;
+  PetscErrorCode ierr = PETSC_SUCCESS;
+
+  PetscFunctionBegin;
+  if (!Ne) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(PetscDSGetTotalDimension(tds[0], &totDim));
+  if (tdsAux) PetscCall(PetscDSGetTotalDimension(tdsAux[0], &totDimAux));
+  PetscCall(DMPlexFEGetThreadChunks_Private(Nt, Ne, chunkSize, geom, &cS, &chunkGeoms));
+#if defined(PETSC_HAVE_OPENMP) && defined(PETSC_HAVE_THREADSAFETY)
+  PetscPragmaOMP(parallel for schedule(static))
+#endif
+  for (PetscInt th = 0; th < Nt; ++th) {
+    const PetscInt s = cS[th], n = cS[th + 1] - cS[th];
+    PetscErrorCode ierr_th;
+
+    if (!n) continue;
+    ierr_th = PetscFEIntegrateResidual(tds[th], key, n, chunkGeoms[th], &u[s * totDim], PetscSafePointerPlusOffset(u_t, s * totDim), tdsAux ? tdsAux[th] : NULL, PetscSafePointerPlusOffset(a, s * totDimAux), t, &elemVec[s * totDim]);
+    if (ierr_th) {
+      PetscPragmaOMP(atomic write)
+      ierr = ierr_th;
+    }
+  }
+  PetscCall(DMPlexFERestoreThreadChunks_Private(Nt, geom, &cS, &chunkGeoms));
+  PetscCheck(!ierr, PETSC_COMM_SELF, ierr, "Error in residual integration on a thread");
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/* Integrate the Jacobian of type jtype over the first Ne cells of geom on Nt threads, each writing only its own slice of elemMat */
+static PetscErrorCode DMPlexFEIntegrateJacobianThreaded_Private(PetscInt Nt, PetscDS tds[], PetscDS tdsAux[], PetscFEJacobianType jtype, PetscFormKey key, PetscInt Ne, PetscInt chunkSize, PetscFEGeom *geom, const PetscScalar u[], const PetscScalar u_t[], const PetscScalar a[], PetscReal t, PetscReal X_tShift, PetscScalar elemMat[])
+{
+  PetscFEGeom  **chunkGeoms;
+  PetscInt      *cS, totDim, totDimAux = 0;
+  PetscErrorCode ierr = PETSC_SUCCESS;
+
+  PetscFunctionBegin;
+  if (!Ne) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(PetscDSGetTotalDimension(tds[0], &totDim));
+  if (tdsAux) PetscCall(PetscDSGetTotalDimension(tdsAux[0], &totDimAux));
+  PetscCall(DMPlexFEGetThreadChunks_Private(Nt, Ne, chunkSize, geom, &cS, &chunkGeoms));
+#if defined(PETSC_HAVE_OPENMP) && defined(PETSC_HAVE_THREADSAFETY)
+  PetscPragmaOMP(parallel for schedule(static))
+#endif
+  for (PetscInt th = 0; th < Nt; ++th) {
+    const PetscInt s = cS[th], n = cS[th + 1] - cS[th];
+    PetscErrorCode ierr_th;
+
+    if (!n) continue;
+    ierr_th = PetscFEIntegrateJacobian(tds[th], jtype, key, n, chunkGeoms[th], &u[s * totDim], PetscSafePointerPlusOffset(u_t, s * totDim), tdsAux ? tdsAux[th] : NULL, PetscSafePointerPlusOffset(a, s * totDimAux), t, X_tShift, &elemMat[s * totDim * totDim]);
+    if (ierr_th) {
+      PetscPragmaOMP(atomic write)
+      ierr = ierr_th;
+    }
+  }
+  PetscCall(DMPlexFERestoreThreadChunks_Private(Nt, geom, &cS, &chunkGeoms));
+  PetscCheck(!ierr, PETSC_COMM_SELF, ierr, "Error in Jacobian integration on a thread");
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
   DMPlexComputeResidualByKey - Compute the local residual for terms matching the input key
 
@@ -5185,6 +5490,8 @@ PetscErrorCode DMPlexComputeResidualByKey(DM dm, PetscFormKey key, IS cellIS, Pe
   PetscInt        maxDegree  = PETSC_INT_MAX;
   PetscQuadrature affineQuad = NULL, *quads = NULL;
   PetscFEGeom    *affineGeom = NULL, **geoms = NULL;
+  PetscDS        *tds = NULL, *tdsAux = NULL;
+  PetscInt        Nt  = mesh->femThreads;
 
   PetscFunctionBegin;
   PetscCall(PetscLogEventBegin(DMPLEX_ResidualFEM, dm, 0, 0, 0));
@@ -5230,7 +5537,7 @@ PetscErrorCode DMPlexComputeResidualByKey(DM dm, PetscFormKey key, IS cellIS, Pe
     PetscCall(DMFieldGetDegree(coordField, cellIS, NULL, &maxDegree));
     if (maxDegree <= 1) {
       PetscCall(DMFieldCreateDefaultQuadrature(coordField, cellIS, &affineQuad));
-      if (affineQuad) PetscCall(DMSNESGetFEGeom(coordField, cellIS, affineQuad, PETSC_FEGEOM_BASIC, &affineGeom));
+      if (affineQuad) PetscCall(DMPlexGetFEGeom(coordField, cellIS, affineQuad, PETSC_FEGEOM_BASIC, &affineGeom));
     } else {
       PetscCall(PetscCalloc2(Nf, &quads, Nf, &geoms));
       for (f = 0; f < Nf; ++f) {
@@ -5247,7 +5554,7 @@ PetscErrorCode DMPlexComputeResidualByKey(DM dm, PetscFormKey key, IS cellIS, Pe
 
           PetscCall(PetscFEGetQuadrature(fe, &quads[f]));
           PetscCall(PetscObjectReference((PetscObject)quads[f]));
-          PetscCall(DMSNESGetFEGeom(coordField, cellIS, quads[f], PETSC_FEGEOM_BASIC, &geoms[f]));
+          PetscCall(DMPlexGetFEGeom(coordField, cellIS, quads[f], PETSC_FEGEOM_BASIC, &geoms[f]));
         }
       }
     }
@@ -5260,6 +5567,10 @@ PetscErrorCode DMPlexComputeResidualByKey(DM dm, PetscFormKey key, IS cellIS, Pe
   }
   /* Loop over chunks */
   if (useFEM) PetscCall(ISCreate(PETSC_COMM_SELF, &chunkIS));
+  if (useFEM && Nt > 1) {
+    PetscCall(DMPlexGetFEMThreadDS_Private(dm, Nt, ds, &tds));
+    PetscCall(DMPlexGetFEMThreadDS_Private(dm, Nt, dsAux, &tdsAux));
+  }
   numCells      = cEnd - cStart;
   numChunks     = 1;
   cellChunkSize = numCells / numChunks;
@@ -5319,8 +5630,11 @@ PetscErrorCode DMPlexComputeResidualByKey(DM dm, PetscFormKey key, IS cellIS, Pe
         offset    = numCells - Nr;
         /* Integrate FE residual to get elemVec (need fields at quadrature points) */
         /*   For FV, I think we use a P0 basis and the cell coefficients (for subdivided cells, we can tweak the basis tabulation to be the indicator function) */
-        PetscCall(PetscFEGeomGetChunk(geom, 0, offset, &chunkGeom));
-        PetscCall(PetscFEIntegrateResidual(ds, key, Ne, chunkGeom, u, u_t, dsAux, a, t, elemVec));
+        if (Nt > 1) PetscCall(DMPlexFEIntegrateResidualThreaded_Private(Nt, tds, tdsAux, key, Ne, numBatches * batchSize, geom, u, u_t, a, t, elemVec));
+        else {
+          PetscCall(PetscFEGeomGetChunk(geom, 0, offset, &chunkGeom));
+          PetscCall(PetscFEIntegrateResidual(ds, key, Ne, chunkGeom, u, u_t, dsAux, a, t, elemVec));
+        }
         PetscCall(PetscFEGeomGetChunk(geom, offset, numCells, &chunkGeom));
         PetscCall(PetscFEIntegrateResidual(ds, key, Nr, chunkGeom, &u[offset * totDim], PetscSafePointerPlusOffset(u_t, offset * totDim), dsAux, PetscSafePointerPlusOffset(a, offset * totDimAux), t, &elemVec[offset * totDim]));
         PetscCall(PetscFEGeomRestoreChunk(geom, offset, numCells, &chunkGeom));
@@ -5725,18 +6039,18 @@ PetscErrorCode DMPlexComputeResidualHybridByKey(DM dm, PetscFormKey key[], IS ce
     /* Get geometric data */
     if (maxDegree <= 1) {
       if (!affineQuadF) PetscCall(DMFieldCreateDefaultQuadrature(coordField, chunkISF, &affineQuadF));
-      if (affineQuadF) PetscCall(DMSNESGetFEGeom(coordField, chunkISF, affineQuadF, PETSC_FEGEOM_COHESIVE, &affineGeomF));
+      if (affineQuadF) PetscCall(DMPlexGetFEGeom(coordField, chunkISF, affineQuadF, PETSC_FEGEOM_COHESIVE, &affineGeomF));
       if (!affineQuadN) {
         PetscInt dim;
         PetscCall(PetscQuadratureGetData(affineQuadF, &dim, NULL, NULL, NULL, NULL));
         PetscCall(DMFieldCreateDefaultFaceQuadrature(coordField, chunkISN, &affineQuadN));
         PetscCall(PetscQuadratureSetData(affineQuadN, dim + 1, PETSC_DECIDE, PETSC_DECIDE, NULL, NULL));
       }
-      if (affineQuadN) PetscCall(DMSNESGetFEGeom(coordField, chunkISN, affineQuadN, PETSC_FEGEOM_BASIC, &affineGeomN));
+      if (affineQuadN) PetscCall(DMPlexGetFEGeom(coordField, chunkISN, affineQuadN, PETSC_FEGEOM_BASIC, &affineGeomN));
     } else {
       for (f = 0; f < Nf; ++f) {
-        if (quadsF[f]) PetscCall(DMSNESGetFEGeom(coordField, chunkISF, quadsF[f], PETSC_FEGEOM_COHESIVE, &geomsF[f]));
-        if (quadsN[f]) PetscCall(DMSNESGetFEGeom(coordField, chunkISN, quadsN[f], PETSC_FEGEOM_BASIC, &geomsN[f]));
+        if (quadsF[f]) PetscCall(DMPlexGetFEGeom(coordField, chunkISF, quadsF[f], PETSC_FEGEOM_COHESIVE, &geomsF[f]));
+        if (quadsN[f]) PetscCall(DMPlexGetFEGeom(coordField, chunkISN, quadsN[f], PETSC_FEGEOM_BASIC, &geomsN[f]));
       }
     }
     /* Loop over fields */
@@ -5828,23 +6142,23 @@ PetscErrorCode DMPlexComputeResidualHybridByKey(DM dm, PetscFormKey key[], IS ce
   PetscCall(DMRestoreWorkArray(dm, numCells * totDim, MPIU_SCALAR, &elemVecPos));
   PetscCall(DMRestoreWorkArray(dm, numCells * totDim, MPIU_SCALAR, &elemVecCoh));
   PetscCall(PetscFree2(faces, neighbors));
-  PetscCall(ISDestroy(&chunkISF));
-  PetscCall(ISDestroy(&chunkISN));
-  PetscCall(ISRestorePointRange(cellIS, &cStart, &cEnd, &cells));
   if (maxDegree <= 1) {
-    PetscCall(DMSNESRestoreFEGeom(coordField, cellIS, affineQuadF, PETSC_FALSE, &affineGeomF));
+    PetscCall(DMPlexRestoreFEGeom(coordField, chunkISF, affineQuadF, PETSC_FEGEOM_COHESIVE, &affineGeomF));
     PetscCall(PetscQuadratureDestroy(&affineQuadF));
-    PetscCall(DMSNESRestoreFEGeom(coordField, cellIS, affineQuadN, PETSC_FALSE, &affineGeomN));
+    PetscCall(DMPlexRestoreFEGeom(coordField, chunkISN, affineQuadN, PETSC_FEGEOM_BASIC, &affineGeomN));
     PetscCall(PetscQuadratureDestroy(&affineQuadN));
   } else {
     for (f = 0; f < Nf; ++f) {
-      if (geomsF) PetscCall(DMSNESRestoreFEGeom(coordField, cellIS, quadsF[f], PETSC_FALSE, &geomsF[f]));
+      if (geomsF) PetscCall(DMPlexRestoreFEGeom(coordField, chunkISF, quadsF[f], PETSC_FEGEOM_COHESIVE, &geomsF[f]));
       if (quadsF) PetscCall(PetscQuadratureDestroy(&quadsF[f]));
-      if (geomsN) PetscCall(DMSNESRestoreFEGeom(coordField, cellIS, quadsN[f], PETSC_FALSE, &geomsN[f]));
+      if (geomsN) PetscCall(DMPlexRestoreFEGeom(coordField, chunkISN, quadsN[f], PETSC_FEGEOM_BASIC, &geomsN[f]));
       if (quadsN) PetscCall(PetscQuadratureDestroy(&quadsN[f]));
     }
     PetscCall(PetscFree4(quadsF, geomsF, quadsN, geomsN));
   }
+  PetscCall(ISDestroy(&chunkISF));
+  PetscCall(ISDestroy(&chunkISN));
+  PetscCall(ISRestorePointRange(cellIS, &cStart, &cEnd, &cells));
   if (mesh->printFEM) {
     Vec          locFbc;
     PetscInt     pStart, pEnd, p, maxDof;
@@ -5966,7 +6280,7 @@ PetscErrorCode DMPlexComputeBdJacobianSingleByLabel(DM dm, PetscWeakForm wf, DML
       PetscCall(PetscObjectReference((PetscObject)qGeom));
     }
     PetscCall(PetscQuadratureGetData(qGeom, NULL, NULL, &Nq, NULL, NULL));
-    PetscCall(DMSNESGetFEGeom(coordField, pointIS, qGeom, PETSC_FEGEOM_BOUNDARY, &fgeom));
+    PetscCall(DMPlexGetFEGeom(coordField, pointIS, qGeom, PETSC_FEGEOM_BOUNDARY, &fgeom));
     for (face = 0; face < numFaces; ++face) {
       const PetscInt point = points[face], *support;
       PetscScalar   *x     = NULL;
@@ -6173,6 +6487,8 @@ PetscErrorCode DMPlexComputeJacobianByKey(DM dm, PetscFormKey key, IS cellIS, Pe
   PetscInt        Nf, fieldI, fieldJ;
   PetscInt        totDim, totDimAux = 0, cStart, cEnd, numCells, c;
   PetscBool       hasJac = PETSC_FALSE, hasPrec = PETSC_FALSE, hasDyn, hasFV = PETSC_FALSE, transform;
+  PetscDS        *tds = NULL, *tdsAux = NULL;
+  PetscInt        Nt  = mesh->femThreads;
 
   PetscFunctionBegin;
   PetscCall(PetscLogEventBegin(DMPLEX_JacobianFEM, dm, 0, 0, 0));
@@ -6232,6 +6548,10 @@ PetscErrorCode DMPlexComputeJacobianByKey(DM dm, PetscFormKey key, IS cellIS, Pe
   if (hasJac) PetscCall(PetscArrayzero(elemMat, numCells * totDim * totDim));
   if (hasPrec) PetscCall(PetscArrayzero(elemMatP, numCells * totDim * totDim));
   if (hasDyn) PetscCall(PetscArrayzero(elemMatD, numCells * totDim * totDim));
+  if (Nt > 1) {
+    PetscCall(DMPlexGetFEMThreadDS_Private(dm, Nt, prob, &tds));
+    PetscCall(DMPlexGetFEMThreadDS_Private(dm, Nt, probAux, &tdsAux));
+  }
   for (fieldI = 0; fieldI < Nf; ++fieldI) {
     PetscClassId    id;
     PetscFE         fe;
@@ -6259,7 +6579,7 @@ PetscErrorCode DMPlexComputeJacobianByKey(DM dm, PetscFormKey key, IS cellIS, Pe
       PetscCall(PetscObjectReference((PetscObject)qGeom));
     }
     PetscCall(PetscQuadratureGetData(qGeom, NULL, NULL, &Nq, NULL, NULL));
-    PetscCall(DMSNESGetFEGeom(coordField, cellIS, qGeom, PETSC_FEGEOM_BASIC, &cgeomFEM));
+    PetscCall(DMPlexGetFEGeom(coordField, cellIS, qGeom, PETSC_FEGEOM_BASIC, &cgeomFEM));
     blockSize = Nb;
     batchSize = numBlocks * blockSize;
     PetscCall(PetscFESetTileSizes(fe, blockSize, numBlocks, batchSize, numBatches));
@@ -6272,15 +6592,18 @@ PetscErrorCode DMPlexComputeJacobianByKey(DM dm, PetscFormKey key, IS cellIS, Pe
     for (fieldJ = 0; fieldJ < Nf; ++fieldJ) {
       key.field = fieldI * Nf + fieldJ;
       if (hasJac) {
-        PetscCall(PetscFEIntegrateJacobian(prob, PETSCFE_JACOBIAN, key, Ne, chunkGeom, u, u_t, probAux, a, t, X_tShift, elemMat));
+        if (Nt > 1) PetscCall(DMPlexFEIntegrateJacobianThreaded_Private(Nt, tds, tdsAux, PETSCFE_JACOBIAN, key, Ne, numBatches * batchSize, cgeomFEM, u, u_t, a, t, X_tShift, elemMat));
+        else PetscCall(PetscFEIntegrateJacobian(prob, PETSCFE_JACOBIAN, key, Ne, chunkGeom, u, u_t, probAux, a, t, X_tShift, elemMat));
         PetscCall(PetscFEIntegrateJacobian(prob, PETSCFE_JACOBIAN, key, Nr, remGeom, &u[offset * totDim], PetscSafePointerPlusOffset(u_t, offset * totDim), probAux, PetscSafePointerPlusOffset(a, offset * totDimAux), t, X_tShift, &elemMat[offset * totDim * totDim]));
       }
       if (hasPrec) {
-        PetscCall(PetscFEIntegrateJacobian(prob, PETSCFE_JACOBIAN_PRE, key, Ne, chunkGeom, u, u_t, probAux, a, t, X_tShift, elemMatP));
+        if (Nt > 1) PetscCall(DMPlexFEIntegrateJacobianThreaded_Private(Nt, tds, tdsAux, PETSCFE_JACOBIAN_PRE, key, Ne, numBatches * batchSize, cgeomFEM, u, u_t, a, t, X_tShift, elemMatP));
+        else PetscCall(PetscFEIntegrateJacobian(prob, PETSCFE_JACOBIAN_PRE, key, Ne, chunkGeom, u, u_t, probAux, a, t, X_tShift, elemMatP));
         PetscCall(PetscFEIntegrateJacobian(prob, PETSCFE_JACOBIAN_PRE, key, Nr, remGeom, &u[offset * totDim], PetscSafePointerPlusOffset(u_t, offset * totDim), probAux, PetscSafePointerPlusOffset(a, offset * totDimAux), t, X_tShift, &elemMatP[offset * totDim * totDim]));
       }
       if (hasDyn) {
-        PetscCall(PetscFEIntegrateJacobian(prob, PETSCFE_JACOBIAN_DYN, key, Ne, chunkGeom, u, u_t, probAux, a, t, X_tShift, elemMatD));
+        if (Nt > 1) PetscCall(DMPlexFEIntegrateJacobianThreaded_Private(Nt, tds, tdsAux, PETSCFE_JACOBIAN_DYN, key, Ne, numBatches * batchSize, cgeomFEM, u, u_t, a, t, X_tShift, elemMatD));
+        else PetscCall(PetscFEIntegrateJacobian(prob, PETSCFE_JACOBIAN_DYN, key, Ne, chunkGeom, u, u_t, probAux, a, t, X_tShift, elemMatD));
         PetscCall(PetscFEIntegrateJacobian(prob, PETSCFE_JACOBIAN_DYN, key, Nr, remGeom, &u[offset * totDim], PetscSafePointerPlusOffset(u_t, offset * totDim), probAux, PetscSafePointerPlusOffset(a, offset * totDimAux), t, X_tShift, &elemMatD[offset * totDim * totDim]));
       }
     }
@@ -6582,18 +6905,18 @@ PetscErrorCode DMPlexComputeJacobianHybridByKey(DM dm, PetscFormKey key[], IS ce
     PetscCall(ISGeneralSetIndices(chunkISN, 2 * cellChunkSize, neighbors, PETSC_USE_POINTER));
     if (maxDegree <= 1) {
       if (!affineQuadF) PetscCall(DMFieldCreateDefaultQuadrature(coordField, chunkISF, &affineQuadF));
-      if (affineQuadF) PetscCall(DMSNESGetFEGeom(coordField, chunkISF, affineQuadF, PETSC_FEGEOM_COHESIVE, &affineGeomF));
+      if (affineQuadF) PetscCall(DMPlexGetFEGeom(coordField, chunkISF, affineQuadF, PETSC_FEGEOM_COHESIVE, &affineGeomF));
       if (!affineQuadN) {
         PetscInt dim;
         PetscCall(PetscQuadratureGetData(affineQuadF, &dim, NULL, NULL, NULL, NULL));
         PetscCall(DMFieldCreateDefaultFaceQuadrature(coordField, chunkISN, &affineQuadN));
         PetscCall(PetscQuadratureSetData(affineQuadN, dim + 1, PETSC_DECIDE, PETSC_DECIDE, NULL, NULL));
       }
-      if (affineQuadN) PetscCall(DMSNESGetFEGeom(coordField, chunkISN, affineQuadN, PETSC_FEGEOM_BASIC, &affineGeomN));
+      if (affineQuadN) PetscCall(DMPlexGetFEGeom(coordField, chunkISN, affineQuadN, PETSC_FEGEOM_BASIC, &affineGeomN));
     } else {
       PetscInt f;
       for (f = 0; f < Nf; ++f) {
-        if (quadsF[f]) PetscCall(DMSNESGetFEGeom(coordField, chunkISF, quadsF[f], PETSC_FEGEOM_COHESIVE, &geomsF[f]));
+        if (quadsF[f]) PetscCall(DMPlexGetFEGeom(coordField, chunkISF, quadsF[f], PETSC_FEGEOM_COHESIVE, &geomsF[f]));
       }
     }
 
@@ -6719,22 +7042,22 @@ PetscErrorCode DMPlexComputeJacobianHybridByKey(DM dm, PetscFormKey key[], IS ce
   PetscCall(DMRestoreWorkArray(dm, hasBdPrec ? cellChunkSize * totDim * totDim : 0, MPIU_SCALAR, &elemMatPosP));
   PetscCall(DMRestoreWorkArray(dm, hasBdPrec ? cellChunkSize * totDim * totDim : 0, MPIU_SCALAR, &elemMatCohP));
   PetscCall(PetscFree2(faces, neighbors));
-  PetscCall(ISDestroy(&chunkISF));
-  PetscCall(ISDestroy(&chunkISN));
-  PetscCall(ISRestorePointRange(cellIS, &cStart, &cEnd, &cells));
   if (maxDegree <= 1) {
-    PetscCall(DMSNESRestoreFEGeom(coordField, cellIS, affineQuadF, PETSC_FALSE, &affineGeomF));
+    PetscCall(DMPlexRestoreFEGeom(coordField, chunkISF, affineQuadF, PETSC_FEGEOM_COHESIVE, &affineGeomF));
     PetscCall(PetscQuadratureDestroy(&affineQuadF));
-    PetscCall(DMSNESRestoreFEGeom(coordField, cellIS, affineQuadN, PETSC_FALSE, &affineGeomN));
+    PetscCall(DMPlexRestoreFEGeom(coordField, chunkISN, affineQuadN, PETSC_FEGEOM_BASIC, &affineGeomN));
     PetscCall(PetscQuadratureDestroy(&affineQuadN));
   } else {
     PetscInt f;
     for (f = 0; f < Nf; ++f) {
-      if (geomsF) PetscCall(DMSNESRestoreFEGeom(coordField, cellIS, quadsF[f], PETSC_FALSE, &geomsF[f]));
+      if (geomsF) PetscCall(DMPlexRestoreFEGeom(coordField, chunkISF, quadsF[f], PETSC_FEGEOM_COHESIVE, &geomsF[f]));
       if (quadsF) PetscCall(PetscQuadratureDestroy(&quadsF[f]));
     }
     PetscCall(PetscFree2(quadsF, geomsF));
   }
+  PetscCall(ISDestroy(&chunkISF));
+  PetscCall(ISDestroy(&chunkISN));
+  PetscCall(ISRestorePointRange(cellIS, &cStart, &cEnd, &cells));
   if (dmAux[2]) PetscCall(DMDestroy(&plexA));
   PetscCall(DMDestroy(&plex));
 end:
@@ -6856,7 +7179,7 @@ PetscErrorCode DMPlexComputeJacobianActionByKey(DM dm, PetscFormKey key, IS cell
       PetscCall(PetscObjectReference((PetscObject)qGeom));
     }
     PetscCall(PetscQuadratureGetData(qGeom, NULL, NULL, &Nq, NULL, NULL));
-    PetscCall(DMSNESGetFEGeom(coordField, cellIS, qGeom, PETSC_FEGEOM_BASIC, &cgeomFEM));
+    PetscCall(DMPlexGetFEGeom(coordField, cellIS, qGeom, PETSC_FEGEOM_BASIC, &cgeomFEM));
     blockSize = Nb;
     batchSize = numBlocks * blockSize;
     PetscCall(PetscFESetTileSizes(fe, blockSize, numBlocks, batchSize, numBatches));
@@ -0,0 +1,96 @@
+static char help[] = "Tests that the FE geometry cached for Plex residuals and integrals follows coordinate changes.\n\n";
+
+#include <petscdmplex.h>
+#include <petscds.h>
+
+static void f0_one(PetscInt dim, PetscInt Nf, PetscInt NfAux, const PetscInt uOff[], const PetscInt uOff_x[], const PetscScalar u[], const PetscScalar u_t[], const PetscScalar u_x[], const PetscInt aOff[], const PetscInt aOff_x[], const PetscScalar a[], const PetscScalar a_t[], const PetscScalar a_x[], PetscReal t, const PetscReal x[], PetscInt numConstants, const PetscScalar constants[], PetscScalar f0[])
+{
+  f0[0] = 1.0;
+}
+
+static void one(PetscInt dim, PetscInt Nf, PetscInt NfAux, const PetscInt uOff[], const PetscInt uOff_x[], const PetscScalar u[], const PetscScalar u_t[], const PetscScalar u_x[], const PetscInt aOff[], const PetscInt aOff_x[], const PetscScalar a[], const PetscScalar a_t[], const PetscScalar a_x[], PetscReal t, const PetscReal x[], PetscInt numConstants, const PetscScalar constants[], PetscScalar value[])
+{
+  value[0] = 1.0;
+}
+
+/* Since the basis is a partition of unity, the residual of f0 = 1 sums to the volume of the domain */
+static PetscErrorCode CheckVolume(DM dm, const char stage[])
+{
+  Vec         locX, locF, F;
+  PetscScalar integral, sum;
+
+  PetscFunctionBeginUser;
+  PetscCall(DMGetLocalVector(dm, &locX));
+  PetscCall(DMGetLocalVector(dm, &locF));
+  PetscCall(DMGetGlobalVector(dm, &F));
+  PetscCall(VecSet(locX, 0.0));
+  PetscCall(VecSet(locF, 0.0));
+  PetscCall(DMPlexSNESComputeResidualFEM(dm, locX, locF, NULL));
+  PetscCall(VecSet(F, 0.0));
+  PetscCall(DMLocalToGlobal(dm, locF, ADD_VALUES, F));
+  PetscCall(VecSum(F, &sum));
+  PetscCall(DMRestoreGlobalVector(dm, &F));
+  PetscCall(DMRestoreLocalVector(dm, &locF));
+  PetscCall(DMRestoreLocalVector(dm, &locX));
+  PetscCall(DMGetGlobalVector(dm, &F));
+  PetscCall(DMPlexComputeIntegralFEM(dm, F, &integral, NULL));
+  PetscCall(DMRestoreGlobalVector(dm, &F));
+  PetscCall(PetscPrintf(PetscObjectComm((PetscObject)dm), "%s: residual sum %g integral %g\n", stage, (double)PetscRealPart(sum), (double)PetscRealPart(integral)));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+int main(int argc, char **argv)
+{
+  DM        dm;
+  PetscFE   fe;
+  PetscDS   ds;
+  Vec       coordinates;
+  PetscInt  dim;
+  PetscBool simplex;
+
+  PetscFunctionBeginUser;
+  PetscCall(PetscInitialize(&argc, &argv, NULL, help));
+  PetscCall(DMCreate(PETSC_COMM_WORLD, &dm));
+  PetscCall(DMSetType(dm, DMPLEX));
+  PetscCall(DMSetFromOptions(dm));
+  PetscCall(DMViewFromOptions(dm, NULL, "-dm_view"));
+  PetscCall(DMGetDimension(dm, &dim));
+  PetscCall(DMPlexIsSimplex(dm, &simplex));
+  PetscCall(PetscFECreateDefault(PETSC_COMM_SELF, dim, 1, simplex, NULL, PETSC_DETERMINE, &fe));
+  PetscCall(DMAddField(dm, NULL, (PetscObject)fe));
+  PetscCall(PetscFEDestroy(&fe));
+  PetscCall(DMCreateDS(dm));
+  PetscCall(DMGetDS(dm, &ds));
+  PetscCall(PetscDSSetResidual(ds, 0, f0_one, NULL));
+  PetscCall(PetscDSSetObjective(ds, 0, one));
+
+  /* The second evaluation reuses the cached geometry */
+  PetscCall(CheckVolume(dm, "Initial"));
+  PetscCall(CheckVolume(dm, "Repeated"));
+  /* Stretch the mesh in place, which must invalidate the cached geometry */
+  PetscCall(DMGetCoordinatesLocal(dm, &coordinates));
+  PetscCall(VecScale(coordinates, 2.0));
+  PetscCall(DMSetCoordinatesLocal(dm, coordinates));
+  PetscCall(CheckVolume(dm, "Stretched"));
+  PetscCall(DMDestroy(&dm));
+  PetscCall(PetscFinalize());
+  return 0;
+}
+
+/*TEST
+
+  test:
+    suffix: 0
+    nsize: {{1 2}}
+    args: -dm_plex_simplex 0 -dm_plex_box_faces 3,3 -petscspace_degree 1
+
+  test:
+    suffix: 1
+    args: -dm_plex_simplex 0 -dm_plex_dim 3 -dm_plex_box_faces 2,2,2 -petscspace_degree 2
+
+  test:
+    suffix: 2
+    requires: triangle
+    args: -dm_plex_box_faces 3,3 -petscspace_degree 2
+
+TEST*/
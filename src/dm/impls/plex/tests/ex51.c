@@ -5,7 +5,9 @@ static char help[] = "Tests save/load plex with distribution in HDF5.\n\n";
 #include <petsclayouthdf5.h>
 
 typedef struct {
-  char fname[PETSC_MAX_PATH_LEN]; /* Output mesh filename */
+  char        fname[PETSC_MAX_PATH_LEN]; /* Output mesh filename */
+  PetscMPIInt saveSize;                  /* Number of processes saving the distribution in SaveLoadResized() */
+  PetscMPIInt loadSize;                  /* Number of processes loading the distribution in SaveLoadResized() */
 } AppCtx;
 
 PetscErrorCode ProcessOptions(MPI_Comm comm, AppCtx *options)
@@ -14,12 +16,217 @@ PetscErrorCode ProcessOptions(MPI_Comm comm, AppCtx *options)
 
   PetscFunctionBegin;
   options->fname[0] = '\0';
+  PetscCallMPI(MPI_Comm_size(comm, &options->saveSize));
+  options->loadSize = options->saveSize;
   PetscOptionsBegin(comm, "", "DMPlex View/Load Test Options", "DMPLEX");
   PetscCall(PetscOptionsString("-fname", "The output mesh file", "ex51.c", options->fname, options->fname, sizeof(options->fname), &flg));
+  PetscCall(PetscOptionsMPIInt("-save_size", "The number of processes saving the distribution", "ex51.c", options->saveSize, &options->saveSize, NULL));
+  PetscCall(PetscOptionsMPIInt("-load_size", "The number of processes loading the distribution", "ex51.c", options->loadSize, &options->loadSize, NULL));
   PetscOptionsEnd();
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/* The saved vector has one dof per vertex with this value */
+static PetscScalar VertexValue(const PetscScalar x[])
+{
+  return 1.0 + x[0] + 10.0 * x[1];
+}
+
+/* Number of cells owned by this process */
+static PetscErrorCode GetOwnedCells(DM dm, PetscInt *nowned)
+{
+  PetscSF         sf;
+  PetscBT         leaves;
+  PetscInt        pStart, pEnd, cStart, cEnd, nleaves;
+  const PetscInt *ilocal;
+
+  PetscFunctionBegin;
+  PetscCall(DMPlexGetChart(dm, &pStart, &pEnd));
+  PetscCall(DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd));
+  PetscCall(DMGetPointSF(dm, &sf));
+  PetscCall(PetscSFGetGraph(sf, NULL, &nleaves, &ilocal, NULL));
+  PetscCall(PetscBTCreate(pEnd - pStart, &leaves));
+  for (PetscInt l = 0; l < nleaves; ++l) PetscCall(PetscBTSet(leaves, (ilocal ? ilocal[l] : l) - pStart));
+  *nowned = 0;
+  for (PetscInt c = cStart; c < cEnd; ++c)
+    if (!PetscBTLookup(leaves, c - pStart)) ++*nowned;
+  PetscCall(PetscBTDestroy(&leaves));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+  Saves a distributed mesh with a vertex vector on saveSize processes, loads the distribution on loadSize processes, and compares the
+  loaded topology and vector with a reference: the number of points of each depth of the serial mesh, the mesh checks, the total
+  volume, and the value of the vector at each vertex computed from the loaded coordinates.
+*/
+static PetscErrorCode SaveLoadResized(AppCtx *user, const char dmName[], const char distributionName[])
+{
+  const PetscInt    faces[2]  = {4, 3};
+  const char        sdmName[] = "exampleSectionDM", vecName[] = "exampleVec";
+  PetscViewerFormat format    = PETSC_VIEWER_HDF5_PETSC;
+  MPI_Comm          comm;
+  PetscMPIInt       rank;
+
+  PetscFunctionBegin;
+  PetscCallMPI(MPI_Comm_rank(PETSC_COMM_WORLD, &rank));
+  /* Save */
+  PetscCallMPI(MPI_Comm_split(PETSC_COMM_WORLD, rank < user->saveSize ? 0 : MPI_UNDEFINED, rank, &comm));
+  if (comm != MPI_COMM_NULL) {
+    DM                 dm, pdm, sdm;
+    PetscPartitioner   part;
+    PetscSection       section, csection;
+    PetscViewer        viewer;
+    Vec                coordinates, lvec, gvec;
+    const PetscScalar *coords;
+    PetscScalar       *values;
+    PetscInt           pStart, pEnd, vStart, vEnd, off;
+
+    PetscCall(DMPlexCreateBoxMesh(comm, 2, PETSC_FALSE, faces, NULL, NULL, NULL, PETSC_TRUE, 0, PETSC_TRUE, &dm));
+    PetscCall(DMPlexGetPartitioner(dm, &part));
+    PetscCall(PetscPartitionerSetType(part, PETSCPARTITIONERSIMPLE));
+    PetscCall(DMPlexDistribute(dm, 0, NULL, &pdm));
+    if (pdm) {
+      PetscCall(DMDestroy(&dm));
+      dm = pdm;
+    }
+    PetscCall(PetscObjectSetName((PetscObject)dm, dmName));
+    PetscCall(DMPlexDistributionSetName(dm, distributionName));
+    PetscCall(PetscViewerHDF5Open(comm, user->fname, FILE_MODE_WRITE, &viewer));
+    PetscCall(PetscViewerPushFormat(viewer, format));
+    PetscCall(DMPlexTopologyView(dm, viewer));
+    PetscCall(DMPlexLabelsView(dm, viewer));
+    PetscCall(DMPlexCoordinatesView(dm, viewer));
+    PetscCall(PetscViewerPopFormat(viewer));
+    /* Save a vector with one dof per vertex */
+    PetscCall(DMClone(dm, &sdm));
+    PetscCall(PetscObjectSetName((PetscObject)sdm, sdmName));
+    PetscCall(DMPlexGetChart(dm, &pStart, &pEnd));
+    PetscCall(DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd));
+    PetscCall(PetscSectionCreate(comm, &section));
+    PetscCall(PetscSectionSetChart(section, pStart, pEnd));
+    for (PetscInt v = vStart; v < vEnd; ++v) PetscCall(PetscSectionSetDof(section, v, 1));
+    PetscCall(PetscSectionSetUp(section));
+    PetscCall(DMSetLocalSection(sdm, section));
+    PetscCall(PetscSectionDestroy(&section));
+    PetscCall(DMPlexSectionView(dm, viewer, sdm));
+    PetscCall(DMGetCoordinateSection(dm, &csection));
+    PetscCall(DMGetCoordinatesLocal(dm, &coordinates));
+    PetscCall(DMGetLocalVector(sdm, &lvec));
+    PetscCall(VecGetArrayRead(coordinates, &coords));
+    PetscCall(VecGetArrayWrite(lvec, &values));
+    for (PetscInt v = vStart; v < vEnd; ++v) {
+      PetscCall(PetscSectionGetOffset(csection, v, &off));
+      values[v - vStart] = VertexValue(&coords[off]);
+    }
+    PetscCall(VecRestoreArrayWrite(lvec, &values));
+    PetscCall(VecRestoreArrayRead(coordinates, &coords));
+    PetscCall(DMGetGlobalVector(sdm, &gvec));
+    PetscCall(PetscObjectSetName((PetscObject)gvec, vecName));
+    PetscCall(DMLocalToGlobal(sdm, lvec, INSERT_VALUES, gvec));
+    PetscCall(DMPlexGlobalVectorView(dm, viewer, sdm, gvec));
+    PetscCall(DMRestoreGlobalVector(sdm, &gvec));
+    PetscCall(DMRestoreLocalVector(sdm, &lvec));
+    PetscCall(DMDestroy(&sdm));
+    PetscCall(PetscViewerDestroy(&viewer));
+    PetscCall(DMDestroy(&dm));
+    PetscCallMPI(MPI_Comm_free(&comm));
+  }
+  /* Load */
+  PetscCallMPI(MPI_Comm_split(PETSC_COMM_WORLD, rank < user->loadSize ? 0 : MPI_UNDEFINED, rank, &comm));
+  if (comm != MPI_COMM_NULL) {
+    DM                 dm, rdm, sdm;
+    PetscSF            sfXC, gsf, lsf;
+    PetscSection       section, csection;
+    PetscViewer        viewer;
+    Vec                coordinates, lvec;
+    const PetscScalar *coords, *values;
+    PetscInt           d, depth, n, nref, ncells, vStart, vEnd, cStart, cEnd, off, dof, nbad = 0;
+    PetscReal          vol, volume = 0;
+    PetscBool          topology = PETSC_TRUE;
+
+    PetscCall(PetscViewerHDF5Open(comm, user->fname, FILE_MODE_READ, &viewer));
+    PetscCall(DMCreate(comm, &dm));
+    PetscCall(DMSetType(dm, DMPLEX));
+    PetscCall(PetscObjectSetName((PetscObject)dm, dmName));
+    PetscCall(DMPlexDistributionSetName(dm, distributionName));
+    PetscCall(PetscViewerPushFormat(viewer, format));
+    PetscCall(DMPlexTopologyLoad(dm, viewer, &sfXC));
+    PetscCall(DMPlexLabelsLoad(dm, viewer, sfXC));
+    PetscCall(DMPlexCoordinatesLoad(dm, viewer, sfXC));
+    PetscCall(PetscViewerPopFormat(viewer));
+    /* Topology */
+    PetscCall(DMPlexCreateBoxMesh(comm, 2, PETSC_FALSE, faces, NULL, NULL, NULL, PETSC_TRUE, 0, PETSC_TRUE, &rdm));
+    PetscCall(DMPlexGetDepth(rdm, &depth));
+    for (d = 0; d <= depth; ++d) {
+      PetscCall(DMPlexGetDepthStratumGlobalSize(dm, d, &n));
+      PetscCall(DMPlexGetDepthStratumGlobalSize(rdm, d, &nref));
+      if (n != nref) topology = PETSC_FALSE;
+    }
+    PetscCall(DMDestroy(&rdm));
+    PetscCall(DMPlexCheckSymmetry(dm));
+    PetscCall(DMPlexCheckSkeleton(dm, 0));
+    PetscCall(DMPlexCheckFaces(dm, 0));
+    PetscCall(DMPlexCheckGeometry(dm));
+    PetscCall(DMPlexCheckPointSF(dm, NULL, PETSC_FALSE));
+    PetscCall(DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd));
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+      PetscCall(DMPlexComputeCellGeometryFVM(dm, c, &vol, NULL, NULL));
+      volume += vol;
+    }
+    PetscCall(GetOwnedCells(dm, &ncells));
+    PetscCall(PetscSynchronizedPrintf(comm, "[%d] %" PetscInt_FMT " cells\n", rank, ncells));
+    PetscCall(PetscSynchronizedFlush(comm, PETSC_STDOUT));
+    PetscCallMPI(MPIU_Allreduce(MPI_IN_PLACE, &volume, 1, MPIU_REAL, MPIU_SUM, comm));
+    if (PetscAbsReal(volume - 1.0) > PETSC_SMALL) topology = PETSC_FALSE;
+    PetscCall(PetscPrintf(comm, "Topology matches the reference: %s\n", topology ? "yes" : "no"));
+    /* Section and vector */
+    PetscCall(DMClone(dm, &sdm));
+    PetscCall(PetscObjectSetName((PetscObject)sdm, sdmName));
+    PetscCall(PetscSectionCreate(comm, &section));
+    PetscCall(DMSetLocalSection(sdm, section));
+    PetscCall(PetscSectionDestroy(&section));
+    PetscCall(DMPlexSectionLoad(dm, viewer, sdm, sfXC, &gsf, &lsf));
+    PetscCall(DMGetLocalSection(sdm, &section));
+    PetscCall(DMGetLocalVector(sdm, &lvec));
+    PetscCall(PetscObjectSetName((PetscObject)lvec, vecName));
+    PetscCall(VecSet(lvec, 0.0));
+    PetscCall(DMPlexLocalVectorLoad(dm, viewer, sdm, lsf, lvec));
+    PetscCall(DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd));
+    PetscCall(DMGetCoordinateSection(dm, &csection));
+    PetscCall(DMGetCoordinatesLocal(dm, &coordinates));
+    PetscCall(VecGetArrayRead(coordinates, &coords));
+    PetscCall(VecGetArrayRead(lvec, &values));
+    for (PetscInt p = cStart; p < cEnd; ++p) {
+      PetscCall(PetscSectionGetDof(section, p, &dof));
+      if (dof) ++nbad;
+    }
+    for (PetscInt v = vStart; v < vEnd; ++v) {
+      PetscCall(PetscSectionGetDof(section, v, &dof));
+      PetscCall(PetscSectionGetOffset(section, v, &off));
+      if (dof != 1) ++nbad;
+      else {
+        PetscInt coff;
+
+        PetscCall(PetscSectionGetOffset(csection, v, &coff));
+        if (PetscAbsScalar(values[off] - VertexValue(&coords[coff])) > PETSC_SMALL) ++nbad;
+      }
+    }
+    PetscCall(VecRestoreArrayRead(lvec, &values));
+    PetscCall(VecRestoreArrayRead(coordinates, &coords));
+    PetscCall(DMRestoreLocalVector(sdm, &lvec));
+    PetscCallMPI(MPIU_Allreduce(MPI_IN_PLACE, &nbad, 1, MPIU_INT, MPI_SUM, comm));
+    PetscCall(PetscPrintf(comm, "Section and vector match the reference: %s\n", nbad ? "no" : "yes"));
+    PetscCall(PetscSFDestroy(&gsf));
+    PetscCall(PetscSFDestroy(&lsf));
+    PetscCall(DMDestroy(&sdm));
+    PetscCall(PetscSFDestroy(&sfXC));
+    PetscCall(DMDestroy(&dm));
+    PetscCall(PetscViewerDestroy(&viewer));
+    PetscCallMPI(MPI_Comm_free(&comm));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 int main(int argc, char **argv)
 {
   const char        exampleDMPlexName[]       = "exampleDMPlex";
@@ -101,6 +308,8 @@ int main(int argc, char **argv)
     PetscCall(DMDestroy(&dm));
     PetscCall(PetscViewerDestroy(&viewer));
   }
+  /* Save and load on different numbers of processes */
+  if (user.saveSize != user.loadSize) PetscCall(SaveLoadResized(&user, exampleDMPlexName, exampleDistributionName));
   /* Finalize */
   PetscCall(PetscFinalize());
   return 0;
@@ -118,5 +327,17 @@ int main(int argc, char **argv)
     args: -fname ex51_dump.h5 -dm_view ascii::ascii_info_detail
     args: -petscpartitioner_type parmetis
     args: -dm_plex_view_hdf5_storage_version 2.1.0
+  test:
+    # Load a distribution saved on 4 processes on fewer processes, merging the saved parts
+    suffix: merge
+    nsize: 4
+    args: -fname ex51_merge_dump.h5 -petscpartitioner_type simple
+    args: -save_size 4 -load_size {{1 2 3}separate output}
+  test:
+    # Load a distribution saved on 2 processes on more processes, splitting the saved parts
+    suffix: split
+    nsize: 4
+    args: -fname ex51_split_dump.h5 -petscpartitioner_type simple
+    args: -save_size 2 -load_size {{3 4}separate output}
 
 TEST*/
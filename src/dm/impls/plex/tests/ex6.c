@@ -130,5 +130,8 @@ int main(int argc, char **argv)
   test:
     suffix: 3
     args: -malloc_dump -pend 10000 -fill 0.25
+  test:
+    suffix: 4
+    args: -malloc_dump -pend 10000 -fill 0.25 -num_strata 100
 
 TEST*/
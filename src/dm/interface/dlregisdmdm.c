@@ -27,6 +27,7 @@ PetscErrorCode DMFinalizePackage(void)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+PETSC_EXTERN PetscErrorCode MatCreate_Stencil(Mat);
 #if defined(PETSC_HAVE_HYPRE)
 PETSC_EXTERN PetscErrorCode MatCreate_HYPREStruct(Mat);
 PETSC_EXTERN PetscErrorCode MatCreate_HYPRESStruct(Mat);
@@ -60,6 +61,7 @@ PetscErrorCode DMInitializePackage(void)
   PetscCall(PetscClassIdRegister("Mesh Transform", &DMPLEXTRANSFORM_CLASSID));
   PetscCall(PetscClassIdRegister("Swarm Cell DM", &DMSWARMCELLDM_CLASSID));
 
+  PetscCall(MatRegister(MATSTENCIL, MatCreate_Stencil));
 #if defined(PETSC_HAVE_HYPRE)
   PetscCall(MatRegister(MATHYPRESTRUCT, MatCreate_HYPREStruct));
   PetscCall(MatRegister(MATHYPRESSTRUCT, MatCreate_HYPRESStruct));
@@ -44,6 +44,7 @@ PetscErrorCode DMLabelCreate(MPI_Comm comm, const char name[], DMLabel *label)
   (*label)->pStart        = -1;
   (*label)->pEnd          = -1;
   (*label)->bt            = NULL;
+  (*label)->pointMap      = NULL;
   PetscCall(PetscHMapICreate(&(*label)->hmap));
   PetscCall(PetscObjectSetName((PetscObject)*label, name));
   PetscCall(DMLabelSetType(*label, DMLABELCONCRETE));
@@ -509,6 +510,7 @@ PetscErrorCode DMLabelReset(DMLabel label)
   label->pStart = -1;
   label->pEnd   = -1;
   PetscCall(PetscBTDestroy(&label->bt));
+  PetscCall(PetscHMapIDestroy(&label->pointMap));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -1006,6 +1008,89 @@ PetscErrorCode DMLabelSetDefaultValue(DMLabel label, PetscInt defaultValue)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+#if !defined(DMLABEL_POINT_MAP_THRESHOLD)
+  #define DMLABEL_POINT_MAP_THRESHOLD 8
+#endif
+
+/* Return the index of the first stratum containing the point, or -1, by searching each stratum in turn */
+static PetscErrorCode DMLabelSearchPoint_Private(DMLabel label, PetscInt point, PetscInt *index)
+{
+  PetscInt v;
+
+  PetscFunctionBegin;
+  *index = -1;
+  for (v = 0; v < label->numStrata; ++v) {
+    if (label->validIS[v] || label->readonly) {
+      IS       is;
+      PetscInt i;
+
+      PetscUseTypeMethod(label, getstratumis, v, &is);
+      PetscCall(ISLocate(label->points[v], point, &i));
+      PetscCall(ISDestroy(&is));
+      if (i >= 0) {
+        *index = v;
+        break;
+      }
+    } else {
+      PetscBool has;
+
+      PetscCall(PetscHSetIHas(label->ht[v], point, &has));
+      if (has) {
+        *index = v;
+        break;
+      }
+    }
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+  DMLabelCreatePointMap_Private - Build the map from each point to the first stratum containing it
+
+  Once built, the map is updated by DMLabelSetValue(), DMLabelClearValue(), and DMLabelInsertIS(), and discarded by bulk modifications of the strata
+*/
+static PetscErrorCode DMLabelCreatePointMap_Private(DMLabel label)
+{
+  PetscInt size = 0, *elems = NULL;
+
+  PetscFunctionBegin;
+  PetscCall(PetscHMapICreate(&label->pointMap));
+  /* Visit strata backwards so that the first stratum containing a point wins */
+  for (PetscInt v = label->numStrata - 1; v >= 0; --v) {
+    if (label->validIS[v]) {
+      const PetscInt *points;
+
+      PetscCall(ISGetIndices(label->points[v], &points));
+      for (PetscInt p = 0; p < label->stratumSizes[v]; ++p) PetscCall(PetscHMapISet(label->pointMap, points[p], v));
+      PetscCall(ISRestoreIndices(label->points[v], &points));
+    } else {
+      PetscInt n, off = 0;
+
+      PetscCall(PetscHSetIGetSize(label->ht[v], &n));
+      if (n > size) {
+        PetscCall(PetscFree(elems));
+        PetscCall(PetscMalloc1(n, &elems));
+        size = n;
+      }
+      PetscCall(PetscHSetIGetElems(label->ht[v], &off, elems));
+      for (PetscInt p = 0; p < n; ++p) PetscCall(PetscHMapISet(label->pointMap, elems[p], v));
+    }
+  }
+  PetscCall(PetscFree(elems));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/* Record that the point now belongs to stratum v */
+static inline PetscErrorCode DMLabelPointMapAdd_Private(DMLabel label, PetscInt point, PetscInt v)
+{
+  PetscInt w;
+
+  PetscFunctionBegin;
+  PetscCall(PetscHMapIGet(label->pointMap, point, &w));
+  if (w < 0 || v < w) PetscCall(PetscHMapISet(label->pointMap, point, v));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
   DMLabelGetValue - Return the value a label assigns to a point, or the label's default value (which is initially -1, and can be changed with
   `DMLabelSetDefaultValue()`)
@@ -1034,29 +1119,19 @@ PetscErrorCode DMLabelGetValue(DMLabel label, PetscInt point, PetscInt *value)
   PetscFunctionBeginHot;
   PetscValidHeaderSpecific(label, DMLABEL_CLASSID, 1);
   PetscAssertPointer(value, 3);
-  *value = label->defaultValue;
-  for (v = 0; v < label->numStrata; ++v) {
-    if (label->validIS[v] || label->readonly) {
-      IS       is;
-      PetscInt i;
-
-      PetscUseTypeMethod(label, getstratumis, v, &is);
-      PetscCall(ISLocate(label->points[v], point, &i));
-      PetscCall(ISDestroy(&is));
-      if (i >= 0) {
-        *value = label->stratumValues[v];
-        break;
-      }
-    } else {
-      PetscBool has;
+  if (label->numStrata <= DMLABEL_POINT_MAP_THRESHOLD || label->readonly) {
+    PetscCall(DMLabelSearchPoint_Private(label, point, &v));
+  } else {
+    if (!label->pointMap) PetscCall(DMLabelCreatePointMap_Private(label));
+    PetscCall(PetscHMapIGet(label->pointMap, point, &v));
+    if (PetscDefined(USE_DEBUG)) { /* Check point map consistency */
+      PetscInt loc;
 
-      PetscCall(PetscHSetIHas(label->ht[v], point, &has));
-      if (has) {
-        *value = label->stratumValues[v];
-        break;
-      }
+      PetscCall(DMLabelSearchPoint_Private(label, point, &loc));
+      PetscCheck(loc == v, PETSC_COMM_SELF, PETSC_ERR_PLIB, "Inconsistent point map lookup for point %" PetscInt_FMT ": stratum %" PetscInt_FMT " != %" PetscInt_FMT, point, v, loc);
     }
   }
+  *value = v < 0 ? label->defaultValue : label->stratumValues[v];
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -1088,6 +1163,7 @@ PetscErrorCode DMLabelSetValue(DMLabel label, PetscInt point, PetscInt value)
   /* Set key */
   PetscCall(DMLabelMakeInvalid_Private(label, v));
   PetscCall(PetscHSetIAdd(label->ht[v], point));
+  if (label->pointMap) PetscCall(DMLabelPointMapAdd_Private(label, point, v));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -1124,6 +1200,17 @@ PetscErrorCode DMLabelClearValue(DMLabel label, PetscInt point, PetscInt value)
   /* Delete key */
   PetscCall(DMLabelMakeInvalid_Private(label, v));
   PetscCall(PetscHSetIDel(label->ht[v], point));
+  if (label->pointMap) {
+    PetscInt w;
+
+    /* The point may still be in a later stratum */
+    PetscCall(PetscHMapIGet(label->pointMap, point, &w));
+    if (w == v) {
+      PetscCall(DMLabelSearchPoint_Private(label, point, &w));
+      if (w < 0) PetscCall(PetscHMapIDel(label->pointMap, point));
+      else PetscCall(PetscHMapISet(label->pointMap, point, w));
+    }
+  }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -1158,6 +1245,9 @@ PetscErrorCode DMLabelInsertIS(DMLabel label, IS is, PetscInt value)
   PetscCall(ISGetLocalSize(is, &n));
   PetscCall(ISGetIndices(is, &points));
   for (p = 0; p < n; ++p) PetscCall(PetscHSetIAdd(label->ht[v], points[p]));
+  if (label->pointMap) {
+    for (p = 0; p < n; ++p) PetscCall(DMLabelPointMapAdd_Private(label, points[p], v));
+  }
   PetscCall(ISRestoreIndices(is, &points));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1499,6 +1589,7 @@ PetscErrorCode DMLabelSetStratumIS(DMLabel label, PetscInt value, IS is)
   PetscCall(ISDestroy(&label->points[v]));
   label->points[v]  = is;
   label->validIS[v] = PETSC_TRUE;
+  PetscCall(PetscHMapIDestroy(&label->pointMap));
   PetscCall(PetscObjectStateIncrease((PetscObject)label));
   if (label->bt) {
     const PetscInt *points;
@@ -1537,6 +1628,7 @@ PetscErrorCode DMLabelClearStratum(DMLabel label, PetscInt value)
   PetscCheck(!label->readonly, PetscObjectComm((PetscObject)label), PETSC_ERR_ARG_WRONG, "Read-only labels cannot be altered");
   PetscCall(DMLabelLookupStratum(label, value, &v));
   if (v < 0) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(PetscHMapIDestroy(&label->pointMap));
   if (label->validIS[v]) {
     if (label->bt) {
       PetscInt        i;
@@ -1651,6 +1743,7 @@ PetscErrorCode DMLabelFilter(DMLabel label, PetscInt start, PetscInt end)
   PetscValidHeaderSpecific(label, DMLABEL_CLASSID, 1);
   PetscCheck(!label->readonly, PetscObjectComm((PetscObject)label), PETSC_ERR_ARG_WRONG, "Read-only labels cannot be altered");
   PetscCall(DMLabelDestroyIndex(label));
+  PetscCall(PetscHMapIDestroy(&label->pointMap));
   PetscCall(DMLabelMakeAllValid_Private(label));
   for (v = 0; v < label->numStrata; ++v) {
     PetscCall(ISGeneralFilter(label->points[v], start, end));
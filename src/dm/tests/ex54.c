@@ -0,0 +1,176 @@
+static char help[] = "Tests MATSTENCIL against MATAIJ on a DMDA.\n\n";
+
+#include <petscdmda.h>
+
+static PetscErrorCode FillMatrix(DM da, Mat A)
+{
+  PetscInt        dim, M, N, P, dof, sw, xs, ys, zs, xm, ym, zm;
+  DMBoundaryType  bx, by, bz;
+  DMDAStencilType st;
+  PetscScalar    *v;
+  MatStencil     *cols;
+
+  PetscFunctionBeginUser;
+  PetscCall(DMDAGetInfo(da, &dim, &M, &N, &P, NULL, NULL, NULL, &dof, &sw, &bx, &by, &bz, &st));
+  PetscCall(DMDAGetCorners(da, &xs, &ys, &zs, &xm, &ym, &zm));
+  PetscCall(PetscMalloc2(dof * PetscPowInt(2 * sw + 1, dim), &cols, dof * PetscPowInt(2 * sw + 1, dim), &v));
+  for (PetscInt k = zs; k < zs + zm; ++k) {
+    for (PetscInt j = ys; j < ys + ym; ++j) {
+      for (PetscInt i = xs; i < xs + xm; ++i) {
+        for (PetscInt c = 0; c < dof; ++c) {
+          MatStencil row = {k, j, i, c};
+          PetscInt   nc  = 0;
+
+          for (PetscInt dk = dim > 2 ? -sw : 0; dk <= (dim > 2 ? sw : 0); ++dk) {
+            for (PetscInt dj = dim > 1 ? -sw : 0; dj <= (dim > 1 ? sw : 0); ++dj) {
+              for (PetscInt di = -sw; di <= sw; ++di) {
+                if (st == DMDA_STENCIL_STAR && (di != 0) + (dj != 0) + (dk != 0) > 1) continue;
+                if (bx != DM_BOUNDARY_PERIODIC && (i + di < 0 || i + di >= M)) continue;
+                if (by != DM_BOUNDARY_PERIODIC && (j + dj < 0 || j + dj >= N)) continue;
+                if (bz != DM_BOUNDARY_PERIODIC && (k + dk < 0 || k + dk >= P)) continue;
+                for (PetscInt d = 0; d < dof; ++d) {
+                  cols[nc].i = i + di;
+                  cols[nc].j = j + dj;
+                  cols[nc].k = k + dk;
+                  cols[nc].c = d;
+                  v[nc++]    = (!di && !dj && !dk && c == d) ? 50.0 + i : 1.0 + 0.01 * ((i + 3 * j + 7 * k) % 11) - 0.1 * (di + 2 * dj + 3 * dk) + 0.2 * c - 0.3 * d;
+                }
+              }
+            }
+          }
+          PetscCall(MatSetValuesStencil(A, 1, &row, nc, cols, v, INSERT_VALUES));
+        }
+      }
+    }
+  }
+  PetscCall(PetscFree2(cols, v));
+  PetscCall(MatAssemblyBegin(A, MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A, MAT_FINAL_ASSEMBLY));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+int main(int argc, char **argv)
+{
+  DM             da;
+  Mat            A, B, C;
+  Vec            b, x, y, z;
+  PetscInt       dim = 2, dof = 1, sw = 1;
+  PetscBool      box = PETSC_FALSE, periodic = PETSC_FALSE, flg;
+  DMBoundaryType bd;
+  PetscReal      nrm;
+
+  PetscFunctionBeginUser;
+  PetscCall(PetscInitialize(&argc, &argv, NULL, help));
+  PetscCall(PetscOptionsGetInt(NULL, NULL, "-dim", &dim, NULL));
+  PetscCall(PetscOptionsGetInt(NULL, NULL, "-dof", &dof, NULL));
+  PetscCall(PetscOptionsGetInt(NULL, NULL, "-sw", &sw, NULL));
+  PetscCall(PetscOptionsGetBool(NULL, NULL, "-box", &box, NULL));
+  PetscCall(PetscOptionsGetBool(NULL, NULL, "-periodic", &periodic, NULL));
+  bd = periodic ? DM_BOUNDARY_PERIODIC : DM_BOUNDARY_NONE;
+
+  PetscCall(DMDACreate(PETSC_COMM_WORLD, &da));
+  PetscCall(DMSetDimension(da, dim));
+  PetscCall(DMDASetSizes(da, 9, dim > 1 ? 7 : 1, dim > 2 ? 5 : 1));
+  PetscCall(DMDASetDof(da, dof));
+  PetscCall(DMDASetStencilType(da, box ? DMDA_STENCIL_BOX : DMDA_STENCIL_STAR));
+  PetscCall(DMDASetStencilWidth(da, sw));
+  PetscCall(DMDASetBoundaryType(da, bd, bd, bd));
+  PetscCall(DMSetFromOptions(da));
+  PetscCall(DMSetUp(da));
+
+  PetscCall(DMSetMatType(da, MATSTENCIL));
+  PetscCall(DMCreateMatrix(da, &A));
+  PetscCall(FillMatrix(da, A));
+  PetscCall(DMSetMatType(da, MATAIJ));
+  PetscCall(DMCreateMatrix(da, &B));
+  PetscCall(FillMatrix(da, B));
+
+  PetscCall(MatMultEqual(A, B, 3, &flg));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD, "MatMult() matches: %s\n", PetscBools[flg]));
+  PetscCall(MatMultAddEqual(A, B, 3, &flg));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD, "MatMultAdd() matches: %s\n", PetscBools[flg]));
+
+  /* the duplicate keeps the DMDA and stencil, so values can be set with MatSetValuesStencil() */
+  PetscCall(MatDuplicate(A, MAT_DO_NOT_COPY_VALUES, &C));
+  PetscCall(FillMatrix(da, C));
+  PetscCall(MatScale(C, 2.0));
+  PetscCall(MatCopy(A, C, SAME_NONZERO_PATTERN));
+  PetscCall(MatMultEqual(C, B, 3, &flg));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD, "MatDuplicate() and MatCopy() match: %s\n", PetscBools[flg]));
+  PetscCall(MatDestroy(&C));
+
+  PetscCall(MatViewFromOptions(A, NULL, "-stencil_view"));
+  PetscCall(MatViewFromOptions(B, NULL, "-aij_view"));
+
+  PetscCall(MatConvert(A, MATAIJ, MAT_INITIAL_MATRIX, &C));
+  PetscCall(MatAXPY(C, -1.0, B, DIFFERENT_NONZERO_PATTERN));
+  PetscCall(MatNorm(C, NORM_FROBENIUS, &nrm));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD, "MatConvert() matches: %s\n", PetscBools[nrm < 1.0e-12]));
+  PetscCall(MatDestroy(&C));
+
+  PetscCall(DMCreateGlobalVector(da, &b));
+  PetscCall(VecDuplicate(b, &x));
+  PetscCall(VecDuplicate(b, &y));
+  PetscCall(VecDuplicate(b, &z));
+  PetscCall(MatGetDiagonal(A, y));
+  PetscCall(MatGetDiagonal(B, z));
+  PetscCall(VecAXPY(y, -1.0, z));
+  PetscCall(VecNorm(y, NORM_INFINITY, &nrm));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD, "MatGetDiagonal() matches: %s\n", PetscBools[nrm < 1.0e-12]));
+
+  /* periodic images of owned points are ghosts for MATSTENCIL, held fixed during a sweep */
+  if (!periodic) {
+    PetscCall(VecSet(b, 1.0));
+    PetscCall(VecSet(x, 0.5));
+    PetscCall(VecCopy(x, y));
+    PetscCall(MatSOR(A, b, 1.0, SOR_LOCAL_SYMMETRIC_SWEEP, 0.0, 1, 1, x));
+    PetscCall(MatSOR(B, b, 1.0, SOR_LOCAL_SYMMETRIC_SWEEP, 0.0, 1, 1, y));
+    PetscCall(VecAXPY(x, -1.0, y));
+    PetscCall(VecNorm(x, NORM_INFINITY, &nrm));
+    PetscCall(PetscPrintf(PETSC_COMM_WORLD, "MatSOR() matches: %s\n", PetscBools[nrm < 1.0e-12]));
+  }
+
+  PetscCall(VecDestroy(&b));
+  PetscCall(VecDestroy(&x));
+  PetscCall(VecDestroy(&y));
+  PetscCall(VecDestroy(&z));
+  PetscCall(MatDestroy(&A));
+  PetscCall(MatDestroy(&B));
+  PetscCall(DMDestroy(&da));
+  PetscCall(PetscFinalize());
+  return 0;
+}
+
+/*TEST
+
+  # inodes make SeqAIJ SOR point-block, compare with pointwise SOR
+  test:
+    suffix: 0
+    nsize: {{1 3}}
+    args: -dim {{1 2 3}} -dof {{1 2}} -mat_no_inode
+    output_file: output/ex54_0.out
+
+  test:
+    suffix: 1
+    nsize: {{1 4}}
+    args: -dim {{2 3}} -dof 2 -box -periodic
+    output_file: output/ex54_1.out
+
+  test:
+    suffix: 2
+    nsize: 2
+    args: -dim 2 -sw 2 -box -mat_no_inode
+    output_file: output/ex54_0.out
+
+  # the stencil matrix is viewed in the natural ordering, like an assembled DMDA matrix
+  test:
+    suffix: view
+    nsize: {{1 2}separate output}
+    args: -dim 1 -mat_no_inode -stencil_view -aij_view
+
+  test:
+    suffix: view_info
+    args: -dim 2 -dof 2 -mat_no_inode -stencil_view ::ascii_info
+    output_file: output/ex54_view_info.out
+
+TEST*/
@@ -9,6 +9,7 @@ static PetscErrorCode KSPReset_Chebyshev(KSP ksp)
 
   PetscFunctionBegin;
   if (cheb->kspest) PetscCall(KSPReset(cheb->kspest));
+  PetscCall(VecDestroy(&cheb->evec));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -37,6 +38,78 @@ static PetscErrorCode KSPChebyshevComputeExtremeEigenvalues_Private(KSP kspest,
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+    Runs its steps of the power method on the preconditioned operator starting from cheb->evec. The first product is returned in
+    *first, the iterate is left in cheb->evec with cheb->evecnorm the norm of its image. Both are zero if the iteration broke down.
+ */
+static PetscErrorCode KSPChebyshevPowerIterate_Private(KSP ksp, Mat Amat, PetscInt its, PetscReal *first)
+{
+  KSP_Chebyshev *cheb = (KSP_Chebyshev *)ksp->data;
+  Vec            v = cheb->evec, t = ksp->work[0], w = ksp->work[1];
+  PetscReal      nrm;
+
+  PetscFunctionBegin;
+  *first         = 0.0;
+  cheb->evecnorm = 0.0;
+  PetscCall(VecNormalize(v, &nrm));
+  if (nrm == 0.0) PetscFunctionReturn(PETSC_SUCCESS);
+  for (PetscInt i = 0; i < PetscMax(its, 1); i++) {
+    if (i) PetscCall(VecAXPBY(v, 1.0 / nrm, 0.0, w));
+    PetscCall(MatMult(Amat, v, t));
+    PetscCall(PCApply(ksp->pc, t, w));
+    PetscCall(VecNorm(w, NORM_2, &nrm));
+    if (nrm == 0.0 || PetscIsInfOrNanReal(nrm)) PetscFunctionReturn(PETSC_SUCCESS);
+    if (!i) *first = nrm;
+  }
+  cheb->evecnorm = nrm;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+    Called after a Krylov estimate, starts the power method from a noisy vector so later refreshes have an iterate to continue from
+ */
+static PetscErrorCode KSPChebyshevEstEigStartRefresh_Private(KSP ksp, Mat Amat)
+{
+  KSP_Chebyshev *cheb = (KSP_Chebyshev *)ksp->data;
+  PetscReal      first;
+
+  PetscFunctionBegin;
+  PetscCall(VecDestroy(&cheb->evec));
+  if (cheb->emax_computed <= 0.0) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(VecDuplicate(ksp->work[0], &cheb->evec));
+  PetscCall(KSPSetNoisy_Private(Amat, cheb->evec));
+  PetscCall(KSPChebyshevPowerIterate_Private(ksp, Amat, cheb->refreshits, &first));
+  if (cheb->evecnorm <= 0.0) PetscCall(VecDestroy(&cheb->evec));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+    Updates the estimates after the values of the operator changed. The bounds are scaled by the ratio of the norms of the new and
+    old operators applied to the same vector, the power method iterate, which is then advanced on the new operator. Comparing on the
+    same vector keeps the estimates unchanged when the operator is, however far the iterate still is from the dominant eigenvector.
+    *refreshed is false if a Krylov estimate is needed.
+ */
+static PetscErrorCode KSPChebyshevEstEigRefresh_Private(KSP ksp, Mat Amat, PetscBool *refreshed)
+{
+  KSP_Chebyshev *cheb = (KSP_Chebyshev *)ksp->data;
+  PetscReal      oldnorm = cheb->evecnorm, first, ratio;
+
+  PetscFunctionBegin;
+  *refreshed = PETSC_FALSE;
+  PetscCall(PCSetUp(ksp->pc));
+  PetscCall(KSPChebyshevPowerIterate_Private(ksp, Amat, cheb->refreshits, &first));
+  if (cheb->evecnorm <= 0.0) {
+    PetscCall(VecDestroy(&cheb->evec));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  ratio               = first / oldnorm;
+  cheb->emin_computed = ratio * cheb->emin_computed;
+  cheb->emax_computed = ratio * cheb->emax_computed;
+  *refreshed          = PETSC_TRUE;
+  PetscCall(PetscInfo(ksp, "Refreshed eigen estimate min/max = %g %g with %" PetscInt_FMT " power iterations\n", (double)cheb->emin_computed, (double)cheb->emax_computed, cheb->refreshits));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode KSPChebyshevGetEigenvalues_Chebyshev(KSP ksp, PetscReal *emax, PetscReal *emin)
 {
   KSP_Chebyshev *cheb = (KSP_Chebyshev *)ksp->data;
@@ -109,6 +182,7 @@ static PetscErrorCode KSPChebyshevEstEigSet_Chebyshev(KSP ksp, PetscReal a, Pets
   } else {
     PetscCall(KSPDestroy(&cheb->kspest));
   }
+  PetscCall(VecDestroy(&cheb->evec));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -121,6 +195,16 @@ static PetscErrorCode KSPChebyshevEstEigSetUseNoisy_Chebyshev(KSP ksp, PetscBool
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode KSPChebyshevEstEigSetRefresh_Chebyshev(KSP ksp, PetscInt its)
+{
+  KSP_Chebyshev *cheb = (KSP_Chebyshev *)ksp->data;
+
+  PetscFunctionBegin;
+  if (its != cheb->refreshits) PetscCall(VecDestroy(&cheb->evec));
+  cheb->refreshits = its;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode KSPChebyshevSetKind_Chebyshev(KSP ksp, KSPChebyshevKind kind)
 {
   KSP_Chebyshev *cheb = (KSP_Chebyshev *)ksp->data;
@@ -249,6 +333,42 @@ PetscErrorCode KSPChebyshevEstEigSetUseNoisy(KSP ksp, PetscBool use)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+  KSPChebyshevEstEigSetRefresh - reuse the eigenvalue estimates of `KSPCHEBYSHEV` when only the values of the operator change,
+  updating them with a few steps of the power method warm-started from the previous iterate instead of a new Krylov estimate
+
+  Logically Collective
+
+  Input Parameters:
++ ksp - linear solver context
+- its - number of power iterations for each refresh, 0 (the default) estimates the eigenvalues with a Krylov method every time the operator changes
+
+  Options Database Key:
+. -ksp_chebyshev_esteig_refresh <its> - number of power iterations used to refresh the estimates
+
+  Level: intermediate
+
+  Notes:
+  The Krylov estimate is still computed the first time and whenever a different `Mat` object is provided, after which the power method is
+  started from a noisy vector. When only the values of the operator change, the bounds are scaled by the ratio of the norms of the new and
+  the old preconditioned operator applied to the current power method iterate, and the iterate is then advanced `its` steps on the new
+  operator. The iterate approaches the dominant eigenvector across refreshes, so the ratio tracks the change of the largest eigenvalue,
+  while the bounds stay unchanged when the operator is unchanged. Each refresh costs `its` applications of the operator and preconditioner.
+
+  This is most useful for smoothers in `PCMG` within nonlinear or time-dependent solves where the operator changes slowly, for example with
+  `-mg_levels_ksp_chebyshev_esteig_refresh 3`.
+
+.seealso: [](ch_ksp), `KSPCHEBYSHEV`, `KSPChebyshevEstEigSet()`, `KSPChebyshevEstEigGetKSP()`, `PCMGSetNumberSmoothAutotune()`
+@*/
+PetscErrorCode KSPChebyshevEstEigSetRefresh(KSP ksp, PetscInt its)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(ksp, KSP_CLASSID, 1);
+  PetscValidLogicalCollectiveInt(ksp, its, 2);
+  PetscTryMethod(ksp, "KSPChebyshevEstEigSetRefresh_C", (KSP, PetscInt), (ksp, its));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
   KSPChebyshevEstEigGetKSP - Get the Krylov method context used to estimate the eigenvalues for the Chebyshev method.
 
@@ -345,7 +465,8 @@ static PetscErrorCode KSPSetFromOptions_Chebyshev(KSP ksp, PetscOptionItems Pets
   PetscInt       neigarg = 2, nestarg = 4;
   PetscReal      eminmax[2] = {0., 0.};
   PetscReal      tform[4]   = {PETSC_DECIDE, PETSC_DECIDE, PETSC_DECIDE, PETSC_DECIDE};
-  PetscBool      flgeig, flgest;
+  PetscBool      flgeig, flgest, flg;
+  PetscInt       its;
 
   PetscFunctionBegin;
   PetscOptionsHeadBegin(PetscOptionsObject, "KSP Chebyshev Options");
@@ -380,6 +501,8 @@ static PetscErrorCode KSPSetFromOptions_Chebyshev(KSP ksp, PetscOptionItems Pets
 
   if (cheb->kspest) {
     PetscCall(PetscOptionsBool("-ksp_chebyshev_esteig_noisy", "Use noisy random number generated right-hand side for estimate", "KSPChebyshevEstEigSetUseNoisy", cheb->usenoisy, &cheb->usenoisy, NULL));
+    PetscCall(PetscOptionsInt("-ksp_chebyshev_esteig_refresh", "Number of warm-started power iterations to refresh the estimates when the operator values change", "KSPChebyshevEstEigSetRefresh", cheb->refreshits, &its, &flg));
+    if (flg) PetscCall(KSPChebyshevEstEigSetRefresh(ksp, its));
     PetscCall(KSPSetFromOptions(cheb->kspest));
   }
   PetscOptionsHeadEnd();
@@ -554,6 +677,26 @@ static PetscErrorCode KSPSolve_Chebyshev_FirstKind(KSP ksp)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode KSPChebyshevSetUpBetas_Private(KSP ksp)
+{
+  KSP_Chebyshev *cheb = (KSP_Chebyshev *)ksp->data;
+
+  PetscFunctionBegin;
+  if (ksp->max_it > cheb->num_betas_alloc) {
+    PetscCall(PetscFree(cheb->betas));
+    PetscCall(PetscMalloc1(ksp->max_it, &cheb->betas));
+    cheb->num_betas_alloc = ksp->max_it;
+  }
+
+  // coefficients for 4th-kind Chebyshev
+  for (PetscInt i = 0; i < ksp->max_it; i++) cheb->betas[i] = 1.0;
+
+  // coefficients for optimized 4th-kind Chebyshev
+  if (cheb->chebykind == KSP_CHEBYSHEV_OPT_FOURTH) PetscCall(KSPChebyshevGetBetas_Private(ksp));
+  cheb->num_betas = ksp->max_it;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode KSPSolve_Chebyshev_FourthKind(KSP ksp)
 {
   KSP_Chebyshev *cheb = (KSP_Chebyshev *)ksp->data;
@@ -563,9 +706,11 @@ static PetscErrorCode KSPSolve_Chebyshev_FourthKind(KSP ksp)
   Vec            x, b, d, r, Br;
   Mat            Amat, Pmat;
   PetscBool      diagonalscale;
-  PetscReal     *betas = cheb->betas;
+  PetscReal     *betas;
 
   PetscFunctionBegin;
+  if (ksp->max_it != cheb->num_betas) PetscCall(KSPChebyshevSetUpBetas_Private(ksp)); /* the degree was changed after KSPSetUp() */
+  betas = cheb->betas;
   PetscCall(PCGetDiagonalScale(ksp->pc, &diagonalscale));
   PetscCheck(!diagonalscale, PetscObjectComm((PetscObject)ksp), PETSC_ERR_SUP, "Krylov method %s does not support diagonal scaling", ((PetscObject)ksp)->type_name);
 
@@ -737,6 +882,7 @@ static PetscErrorCode KSPView_Chebyshev(KSP ksp, PetscViewer viewer)
       PetscCall(KSPView(cheb->kspest, viewer));
       PetscCall(PetscViewerASCIIPopTab(viewer));
       if (cheb->usenoisy) PetscCall(PetscViewerASCIIPrintf(viewer, "  estimating eigenvalues using a noisy random number generated right-hand side\n"));
+      if (cheb->refreshits > 0) PetscCall(PetscViewerASCIIPrintf(viewer, "  refreshing eigenvalue estimates with %" PetscInt_FMT " power iterations when the operator values change\n", cheb->refreshits));
     } else if (cheb->emax_provided != 0.) {
       PetscCall(PetscViewerASCIIPrintf(viewer, "  eigenvalues provided (min %g, max %g) with transform: [%g %g; %g %g]\n", (double)cheb->emin_provided, (double)cheb->emax_provided, (double)cheb->tform[0], (double)cheb->tform[1], (double)cheb->tform[2],
                                        (double)cheb->tform[3]));
@@ -764,18 +910,7 @@ static PetscErrorCode KSPSetUp_Chebyshev(KSP ksp)
     break;
   }
 
-  if (ksp->max_it > cheb->num_betas_alloc) {
-    PetscCall(PetscFree(cheb->betas));
-    PetscCall(PetscMalloc1(ksp->max_it, &cheb->betas));
-    cheb->num_betas_alloc = ksp->max_it;
-  }
-
-  // coefficients for 4th-kind Chebyshev
-  for (PetscInt i = 0; i < ksp->max_it; i++) cheb->betas[i] = 1.0;
-
-  // coefficients for optimized 4th-kind Chebyshev
-  if (cheb->chebykind == KSP_CHEBYSHEV_OPT_FOURTH) PetscCall(KSPChebyshevGetBetas_Private(ksp));
-
+  PetscCall(KSPChebyshevSetUpBetas_Private(ksp));
   PetscCall(KSPSetWorkVecs(ksp, 3));
   if (cheb->emin == 0. || cheb->emax == 0.) { // User did not specify eigenvalues
     PC pc;
@@ -803,6 +938,15 @@ static PetscErrorCode KSPSetUp_Chebyshev(KSP ksp)
     PetscCall(PetscObjectGetId((PetscObject)Pmat, &pmatid));
     PetscCall(PetscObjectStateGet((PetscObject)Amat, &amatstate));
     PetscCall(PetscObjectStateGet((PetscObject)Pmat, &pmatstate));
+    if (cheb->evec && amatid == cheb->amatid && pmatid == cheb->pmatid && (amatstate != cheb->amatstate || pmatstate != cheb->pmatstate)) {
+      PetscBool refreshed;
+
+      PetscCall(KSPChebyshevEstEigRefresh_Private(ksp, Amat, &refreshed));
+      if (refreshed) {
+        cheb->amatstate = amatstate;
+        cheb->pmatstate = pmatstate;
+      }
+    }
     if (amatid != cheb->amatid || pmatid != cheb->pmatid || amatstate != cheb->amatstate || pmatstate != cheb->pmatstate) {
       PetscReal          max = 0.0, min = 0.0;
       Vec                B;
@@ -848,6 +992,7 @@ static PetscErrorCode KSPSetUp_Chebyshev(KSP ksp)
 
       cheb->emin_computed = min;
       cheb->emax_computed = max;
+      if (cheb->refreshits > 0) PetscCall(KSPChebyshevEstEigStartRefresh_Private(ksp, Amat));
 
       cheb->amatid    = amatid;
       cheb->pmatid    = pmatid;
@@ -866,9 +1011,11 @@ static PetscErrorCode KSPDestroy_Chebyshev(KSP ksp)
   PetscFunctionBegin;
   PetscCall(PetscFree(cheb->betas));
   PetscCall(KSPDestroy(&cheb->kspest));
+  PetscCall(VecDestroy(&cheb->evec));
   PetscCall(PetscObjectComposeFunction((PetscObject)ksp, "KSPChebyshevSetEigenvalues_C", NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)ksp, "KSPChebyshevEstEigSet_C", NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)ksp, "KSPChebyshevEstEigSetUseNoisy_C", NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)ksp, "KSPChebyshevEstEigSetRefresh_C", NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)ksp, "KSPChebyshevSetKind_C", NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)ksp, "KSPChebyshevGetKind_C", NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)ksp, "KSPChebyshevEstEigGetKSP_C", NULL));
@@ -885,7 +1032,8 @@ static PetscErrorCode KSPDestroy_Chebyshev(KSP ksp)
 .   -ksp_chebyshev_esteig <a,b,c,d>        - estimate eigenvalues using a Krylov method, then use this
                                              transform for Chebyshev eigenvalue bounds (`KSPChebyshevEstEigSet()`)
 .   -ksp_chebyshev_esteig_steps            - number of eigenvalue estimation steps
--   -ksp_chebyshev_esteig_noisy            - use a noisy random number generator to create right-hand side for eigenvalue estimator
+.   -ksp_chebyshev_esteig_noisy            - use a noisy random number generator to create right-hand side for eigenvalue estimator
+-   -ksp_chebyshev_esteig_refresh <its>    - refresh the estimates with a few warm-started power iterations when only the operator values change (`KSPChebyshevEstEigSetRefresh()`)
 
    Level: beginner
 
@@ -901,7 +1049,7 @@ static PetscErrorCode KSPDestroy_Chebyshev(KSP ksp)
    See `MatIsSPDKnown()` for how to indicate a `Mat`, matrix is SPD.
 
 .seealso: [](ch_ksp), `KSPCreate()`, `KSPSetType()`, `KSPType`, `KSP`,
-          `KSPChebyshevSetEigenvalues()`, `KSPChebyshevEstEigSet()`, `KSPChebyshevEstEigSetUseNoisy()`
+          `KSPChebyshevSetEigenvalues()`, `KSPChebyshevEstEigSet()`, `KSPChebyshevEstEigSetUseNoisy()`, `KSPChebyshevEstEigSetRefresh()`
           `KSPRICHARDSON`, `KSPCG`, `PCMG`
 M*/
 
@@ -940,6 +1088,7 @@ PETSC_EXTERN PetscErrorCode KSPCreate_Chebyshev(KSP ksp)
   PetscCall(PetscObjectComposeFunction((PetscObject)ksp, "KSPChebyshevSetEigenvalues_C", KSPChebyshevSetEigenvalues_Chebyshev));
   PetscCall(PetscObjectComposeFunction((PetscObject)ksp, "KSPChebyshevEstEigSet_C", KSPChebyshevEstEigSet_Chebyshev));
   PetscCall(PetscObjectComposeFunction((PetscObject)ksp, "KSPChebyshevEstEigSetUseNoisy_C", KSPChebyshevEstEigSetUseNoisy_Chebyshev));
+  PetscCall(PetscObjectComposeFunction((PetscObject)ksp, "KSPChebyshevEstEigSetRefresh_C", KSPChebyshevEstEigSetRefresh_Chebyshev));
   PetscCall(PetscObjectComposeFunction((PetscObject)ksp, "KSPChebyshevSetKind_C", KSPChebyshevSetKind_Chebyshev));
   PetscCall(PetscObjectComposeFunction((PetscObject)ksp, "KSPChebyshevGetKind_C", KSPChebyshevGetKind_Chebyshev));
   PetscCall(PetscObjectComposeFunction((PetscObject)ksp, "KSPChebyshevEstEigGetKSP_C", KSPChebyshevEstEigGetKSP_Chebyshev));
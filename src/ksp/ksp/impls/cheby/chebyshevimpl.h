@@ -12,11 +12,15 @@ typedef struct {
   PetscReal  emin_provided, emax_provided; /* provided by PCGAMG; discarded unless preconditioned by Jacobi */
   PetscReal *betas;                        /* store beta coefficients for 4th-kind Chebyshev smoother */
   PetscInt   num_betas_alloc;
+  PetscInt   num_betas;                    /* degree the beta coefficients were computed for */
 
-  KSP              kspest;   /* KSP used to estimate eigenvalues */
-  PetscReal        tform[4]; /* transform from Krylov estimates to Chebyshev bounds */
-  PetscInt         eststeps; /* number of kspest steps in KSP used to estimate eigenvalues */
-  PetscBool        usenoisy; /* use noisy right-hand side vector to estimate eigenvalues */
+  KSP              kspest;     /* KSP used to estimate eigenvalues */
+  PetscReal        tform[4];   /* transform from Krylov estimates to Chebyshev bounds */
+  PetscInt         eststeps;   /* number of kspest steps in KSP used to estimate eigenvalues */
+  PetscBool        usenoisy;   /* use noisy right-hand side vector to estimate eigenvalues */
+  PetscInt         refreshits; /* if positive, refresh the estimates with this many warm-started power iterations when only the operator values change */
+  Vec              evec;       /* power method iterate, kept between refreshes */
+  PetscReal        evecnorm;   /* norm of the preconditioned operator applied to evec */
   KSPChebyshevKind chebykind;
   /* For tracking when to update the eigenvalue estimates */
   PetscObjectId    amatid, pmatid;
@@ -241,6 +241,15 @@ int main(int argc, char **args)
       suffix: 4
       args: -pc_type eisenstat -ksp_monitor_short -ksp_gmres_cgs_refinement_type refine_always
 
+   test:
+      suffix: sor_multicolor
+      args: -m 20 -n 20 -ksp_type cg -pc_type sor -pc_sor_symmetric -mat_sor_multicolor -ksp_monitor_short
+
+   test:
+      suffix: sor_multicolor_2
+      nsize: 2
+      args: -m 20 -n 20 -ksp_type cg -pc_type sor -pc_sor_local_symmetric -mat_sor_multicolor -ksp_monitor_short
+
    test:
       suffix: 5
       nsize: 2
@@ -262,6 +271,13 @@ int main(int argc, char **args)
       nsize: 4
       args: -pc_type bjacobi -pc_bjacobi_blocks 4 -ksp_monitor_short -sub_pc_type jacobi -sub_ksp_type gmres
 
+   # batched blocks are exact, so they match LU on every block
+   test:
+      suffix: bjacobi_batched
+      nsize: 2
+      args: -m 20 -n 20 -pc_type bjacobi -pc_bjacobi_local_blocks 7 -ksp_monitor_short -pc_bjacobi_batched {{0 1}} -sub_pc_type lu -options_left 0
+      output_file: output/ex2_bjacobi_batched.out
+
    test:
       suffix: qmrcgs
       args: -ksp_type qmrcgs -pc_type ilu
@@ -222,4 +222,10 @@ PetscErrorCode FormElementRhs(PetscScalar x, PetscScalar y, PetscReal H, PetscSc
       nsize: 2
       args: -ksp_monitor_short
 
+   test:
+      suffix: 1_progressive
+      nsize: 2
+      args: -ksp_monitor_short -matstash_progressive {{1 10}}
+      output_file: output/ex3_1.out
+
 TEST*/
@@ -194,6 +194,17 @@ PetscErrorCode ComputeMatrix(KSP ksp, Mat jac, Mat B, void *ctx)
       nsize: 4
       args: -ksp_monitor_short -da_grid_x 21 -da_grid_y 21 -da_grid_z 21 -pc_type mg -pc_mg_levels 3 -mg_levels_ksp_type richardson -mg_levels_ksp_max_it 1 -mg_levels_pc_type bjacobi
 
+   test:
+      suffix: autotune
+      nsize: 2
+      args: -ksp_monitor_short -ksp_type cg -da_grid_x 17 -da_grid_y 17 -da_grid_z 17 -pc_type mg -pc_mg_levels 3 -pc_mg_smooths_autotune 6 -ksp_view
+      filter: grep -e "KSP Residual" -e "maximum iterations" -e "Chebyshev smoothing steps"
+
+   test:
+      suffix: stencil
+      nsize: 4
+      args: -ksp_monitor_short -da_grid_x 21 -da_grid_y 21 -da_grid_z 21 -dm_mat_type stencil -pc_type mg -pc_mg_levels 3 -mg_levels_ksp_type richardson -mg_levels_ksp_max_it 1 -mg_levels_pc_type sor -mg_coarse_ksp_type cg -mg_coarse_pc_type jacobi -mg_coarse_ksp_rtol 1.e-6
+
    test:
       suffix: telescope
       nsize: 4
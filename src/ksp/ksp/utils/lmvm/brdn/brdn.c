@@ -280,8 +280,7 @@ PETSC_INTERN PetscErrorCode BroydenKernelHermitianTranspose_Dense(Mat B, MatLMVM
     PetscCall(MatLMVMGetUpdatedBasis(B, Y_t, &Y, NULL, NULL));
     PetscCall(MatLMVMGetWorkRow(B, &YtX));
     PetscCall(MatLMVMGetWorkRow(B, &StBHX));
-    PetscCall(LMBasisGEMVH(S, oldest, next, 1.0, BHX, 0.0, StBHX));
-    PetscCall(LMBasisGEMVH(Y, oldest, next, 1.0, X, 0.0, YtX));
+    PetscCall(LMBasisGEMVH2(S, Y, oldest, next, BHX, X, StBHX, YtX));
     PetscCall(VecAXPY(YtX, -1.0, StBHX));
     PetscCall(LMProductsSolve(StS, oldest, next, YtX, YtX, PETSC_TRUE));
     PetscCall(LMBasisGEMV(S, oldest, next, 1.0, YtX, 1.0, BHX));
@@ -93,10 +93,11 @@ PETSC_INTERN PetscErrorCode DFPKernel_CompactDense(Mat B, MatLMVMMode mode, Vec
     PetscCall(MatLMVMGetWorkRow(B, &v));
 
     PetscCall(SymBroydenCompactDenseKernelUseB0S(B, mode, X, &use_B0S));
-    if (use_B0S) PetscCall(MatLMVMBasisGEMVH(B, B0S_t, oldest, next, 1.0, X, 0.0, StB0X));
-    else PetscCall(LMBasisGEMVH(S, oldest, next, 1.0, BX, 0.0, StB0X));
+    if (use_B0S) {
+      PetscCall(MatLMVMBasisGEMVH(B, B0S_t, oldest, next, 1.0, X, 0.0, StB0X));
+      PetscCall(LMBasisGEMVH(Y, oldest, next, 1.0, X, 0.0, YtX));
+    } else PetscCall(LMBasisGEMVH2(S, Y, oldest, next, BX, X, StB0X, YtX));
 
-    PetscCall(LMBasisGEMVH(Y, oldest, next, 1.0, X, 0.0, YtX));
     PetscCall(LMProductsSolve(YtS, oldest, next, YtX, YtX, /* ^H */ PETSC_FALSE));
 
     PetscCall(VecAXPBY(u, -1.0, 0.0, YtX));
@@ -1,4 +1,5 @@
 #include <petsc/private/petscimpl.h>
+#include <petscblaslapack.h>
 #include "lmbasis.h"
 #include "blas_cyclic/blas_cyclic.h"
 
@@ -295,16 +296,10 @@ PETSC_INTERN PetscErrorCode LMBasisGEMV(LMBasis A, PetscInt oldest, PetscInt nex
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
-PETSC_INTERN PetscErrorCode LMBasisGEMVH(LMBasis A, PetscInt oldest, PetscInt next, PetscScalar alpha, Vec x, PetscScalar beta, Vec y)
+static PetscErrorCode LMBasisIsCachedVec(LMBasis A, Vec x, PetscBool *is_cached)
 {
-  PetscInt lim        = next - oldest;
-  PetscInt next_idx   = ((next - 1) % A->m) + 1;
-  PetscInt oldest_idx = oldest % A->m;
-  Vec      y_         = y;
-
   PetscFunctionBegin;
-  if (lim <= 0) PetscFunctionReturn(PETSC_SUCCESS);
-  PetscCall(LMBasisMultCheck(A, oldest, next));
+  *is_cached = PETSC_FALSE;
   if (A->cached_product && A->cached_vec_id != 0 && A->cached_vec_state != 0) {
     // see if x is the cached input vector
     PetscObjectId    x_id;
@@ -312,10 +307,26 @@ PETSC_INTERN PetscErrorCode LMBasisGEMVH(LMBasis A, PetscInt oldest, PetscInt ne
 
     PetscCall(PetscObjectGetId((PetscObject)x, &x_id));
     PetscCall(PetscObjectStateGet((PetscObject)x, &x_state));
-    if (x_id == A->cached_vec_id && x_state == A->cached_vec_state) {
-      PetscCall(VecAXPBYCyclic(oldest, next, alpha, A->cached_product, beta, y));
-      PetscFunctionReturn(PETSC_SUCCESS);
-    }
+    if (x_id == A->cached_vec_id && x_state == A->cached_vec_state) *is_cached = PETSC_TRUE;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PETSC_INTERN PetscErrorCode LMBasisGEMVH(LMBasis A, PetscInt oldest, PetscInt next, PetscScalar alpha, Vec x, PetscScalar beta, Vec y)
+{
+  PetscInt  lim        = next - oldest;
+  PetscInt  next_idx   = ((next - 1) % A->m) + 1;
+  PetscInt  oldest_idx = oldest % A->m;
+  Vec       y_         = y;
+  PetscBool is_cached;
+
+  PetscFunctionBegin;
+  if (lim <= 0) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(LMBasisMultCheck(A, oldest, next));
+  PetscCall(LMBasisIsCachedVec(A, x, &is_cached));
+  if (is_cached) {
+    PetscCall(VecAXPBYCyclic(oldest, next, alpha, A->cached_product, beta, y));
+    PetscFunctionReturn(PETSC_SUCCESS);
   }
   PetscCall(PetscLogEventBegin(LMBASIS_GEMVH, NULL, NULL, NULL, NULL));
   if (alpha != 1.0 || (beta != 1.0 && beta != 0.0)) PetscCall(LMBasisGetWorkRow(A, &y_));
@@ -344,6 +355,89 @@ PETSC_INTERN PetscErrorCode LMBasisGEMVH(LMBasis A, PetscInt oldest, PetscInt ne
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+// local part of y = A^H x in history order, the columns [oldest, next) of A wrap around the window
+static PetscErrorCode LMBasisGEMVHLocal_Host(LMBasis A, PetscInt oldest, PetscInt next, Vec x, PetscScalar y[])
+{
+  PetscInt           lim        = next - oldest;
+  PetscInt           oldest_idx = oldest % A->m;
+  PetscInt           first      = PetscMin(lim, A->m - oldest_idx);
+  PetscInt           n, lda;
+  PetscBLASInt       n_blas, lda_blas, first_blas, rest_blas, ione = 1;
+  PetscScalar        sone = 1.0, szero = 0.0;
+  const PetscScalar *a, *xa;
+
+  PetscFunctionBegin;
+  PetscCall(PetscArrayzero(y, lim));
+  PetscCall(VecGetLocalSize(x, &n));
+  if (n == 0) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(MatDenseGetLDA(A->vecs, &lda));
+  PetscCall(PetscBLASIntCast(n, &n_blas));
+  PetscCall(PetscBLASIntCast(lda, &lda_blas));
+  PetscCall(PetscBLASIntCast(first, &first_blas));
+  PetscCall(PetscBLASIntCast(lim - first, &rest_blas));
+  PetscCall(MatDenseGetArrayRead(A->vecs, &a));
+  PetscCall(VecGetArrayRead(x, &xa));
+  PetscCallBLAS("BLASgemv", BLASgemv_("C", &n_blas, &first_blas, &sone, &a[oldest_idx * lda], &lda_blas, xa, &ione, &szero, y, &ione));
+  if (rest_blas > 0) PetscCallBLAS("BLASgemv", BLASgemv_("C", &n_blas, &rest_blas, &sone, a, &lda_blas, xa, &ione, &szero, &y[first], &ione));
+  PetscCall(VecRestoreArrayRead(x, &xa));
+  PetscCall(MatDenseRestoreArrayRead(A->vecs, &a));
+  PetscCall(PetscLogFlops(2.0 * n * lim));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+  Computes ya = A^H a and yb = B^H b over the same window with a single reduction for both, instead of one reduction
+  per basis. The compact dense kernels need both products of their input before anything else can proceed, so this
+  halves the number of global synchronizations of an application of the matrix.
+
+  Falls back to two LMBasisGEMVH() when one of the products is cached or the bases are not on the host.
+*/
+PETSC_INTERN PetscErrorCode LMBasisGEMVH2(LMBasis A, LMBasis B, PetscInt oldest, PetscInt next, Vec a, Vec b, Vec ya, Vec yb)
+{
+  PetscInt  lim = next - oldest;
+  PetscBool a_cached, b_cached, a_host, b_host;
+
+  PetscFunctionBegin;
+  if (lim <= 0) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(LMBasisIsCachedVec(A, a, &a_cached));
+  PetscCall(LMBasisIsCachedVec(B, b, &b_cached));
+  PetscCall(PetscObjectTypeCompareAny((PetscObject)A->vecs, &a_host, MATSEQDENSE, MATMPIDENSE, ""));
+  PetscCall(PetscObjectTypeCompareAny((PetscObject)B->vecs, &b_host, MATSEQDENSE, MATMPIDENSE, ""));
+  if (a_cached || b_cached || !a_host || !b_host || A->m != B->m) {
+    PetscCall(LMBasisGEMVH(A, oldest, next, 1.0, a, 0.0, ya));
+    PetscCall(LMBasisGEMVH(B, oldest, next, 1.0, b, 0.0, yb));
+  } else {
+    MPI_Comm     comm = PetscObjectComm((PetscObject)A->vecs);
+    PetscMPIInt  rank, count;
+    PetscScalar *sendbuf, *recvbuf, *yaa, *yba;
+
+    PetscCall(LMBasisMultCheck(A, oldest, next));
+    PetscCall(LMBasisMultCheck(B, oldest, next));
+    PetscCall(PetscInfo(A->vecs, "Computing the products with two bases of %" PetscInt_FMT " vectors with one reduction\n", lim));
+    PetscCall(PetscLogEventBegin(LMBASIS_GEMVH, NULL, NULL, NULL, NULL));
+    PetscCall(PetscMalloc2(2 * lim, &sendbuf, 2 * lim, &recvbuf));
+    PetscCall(LMBasisGEMVHLocal_Host(A, oldest, next, a, sendbuf));
+    PetscCall(LMBasisGEMVHLocal_Host(B, oldest, next, b, &sendbuf[lim]));
+    // the row vectors are stored on the first process
+    PetscCall(PetscMPIIntCast(2 * lim, &count));
+    PetscCallMPI(MPI_Comm_rank(comm, &rank));
+    PetscCallMPI(MPI_Reduce(sendbuf, recvbuf, count, MPIU_SCALAR, MPIU_SUM, 0, comm));
+    PetscCall(VecGetArray(ya, &yaa));
+    PetscCall(VecGetArray(yb, &yba));
+    if (rank == 0) {
+      for (PetscInt i = 0; i < lim; i++) {
+        yaa[(oldest + i) % A->m] = recvbuf[i];
+        yba[(oldest + i) % A->m] = recvbuf[lim + i];
+      }
+    }
+    PetscCall(VecRestoreArray(yb, &yba));
+    PetscCall(VecRestoreArray(ya, &yaa));
+    PetscCall(PetscFree2(sendbuf, recvbuf));
+    PetscCall(PetscLogEventEnd(LMBASIS_GEMVH, NULL, NULL, NULL, NULL));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode LMBasisGEMMH_Internal(Mat A, Mat B, PetscScalar alpha, PetscScalar beta, Mat G)
 {
   PetscFunctionBegin;
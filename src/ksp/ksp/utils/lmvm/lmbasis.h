@@ -46,5 +46,6 @@ PETSC_INTERN PetscErrorCode LMBasisRestoreWorkVec(LMBasis, Vec *);
 PETSC_INTERN PetscErrorCode LMBasisGetRange(LMBasis, PetscInt *, PetscInt *);
 PETSC_INTERN PetscErrorCode LMBasisGEMV(LMBasis, PetscInt, PetscInt, PetscScalar, Vec, PetscScalar, Vec);
 PETSC_INTERN PetscErrorCode LMBasisGEMVH(LMBasis, PetscInt, PetscInt, PetscScalar, Vec, PetscScalar, Vec);
+PETSC_INTERN PetscErrorCode LMBasisGEMVH2(LMBasis, LMBasis, PetscInt, PetscInt, Vec, Vec, Vec, Vec);
 PETSC_INTERN PetscErrorCode LMBasisGEMMH(LMBasis, PetscInt, PetscInt, LMBasis, PetscInt, PetscInt, PetscScalar, PetscScalar, Mat);
 PETSC_INTERN PetscErrorCode LMBasisSetCachedProduct(LMBasis, Vec, Vec);
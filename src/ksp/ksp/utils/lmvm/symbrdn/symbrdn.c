@@ -527,10 +527,10 @@ PETSC_INTERN PetscErrorCode SymBroydenKernel_CompactDense(Mat B, MatLMVMMode mod
     PetscCall(MatLMVMGetWorkRow(B, &v));
 
     PetscCall(SymBroydenCompactDenseKernelUseB0S(B, mode, X, &use_B0S));
-    if (use_B0S) PetscCall(MatLMVMBasisGEMVH(B, B0S_t, oldest, next, 1.0, X, 0.0, StB0X));
-    else PetscCall(LMBasisGEMVH(S, oldest, next, 1.0, BX, 0.0, StB0X));
-
-    PetscCall(LMBasisGEMVH(Y, oldest, next, 1.0, X, 0.0, YtX));
+    if (use_B0S) {
+      PetscCall(MatLMVMBasisGEMVH(B, B0S_t, oldest, next, 1.0, X, 0.0, StB0X));
+      PetscCall(LMBasisGEMVH(Y, oldest, next, 1.0, X, 0.0, YtX));
+    } else PetscCall(LMBasisGEMVH2(S, Y, oldest, next, BX, X, StB0X, YtX));
 
     PetscCall(LMProductsMult(M00, oldest, next, 1.0, StB0X, 0.0, u, PETSC_FALSE));
     PetscCall(LMProductsMult(M01, oldest, next, 1.0, YtX, 1.0, u, PETSC_FALSE));
@@ -791,6 +791,15 @@ int main(int argc, char **argv)
       requires: hip !complex
       args: -B_mat_type lmvmdfp -vec_type hip
 
+  # the products with S and Y are not cached, so the compact dense kernels compute them with a single reduction
+  test:
+    requires: !single
+    suffix: compact_dense_fused
+    nsize: 2
+    filter: sed -n -e "/<mat/!p" -e "/LMBasisGEMVH2/p" | uniq
+    output_file: output/ex1_compact_dense_fused.out
+    args: -m 15 -n 15 -B_mat_lmvm_J0_mat_type diagonal -B_mat_lmvm_mult_algorithm compact_dense -B_mat_lmvm_scale_type user -B_mat_type {{lmvmbfgs lmvmdfp}} -info :mat
+
   testset:
     requires: !single
     nsize: 2
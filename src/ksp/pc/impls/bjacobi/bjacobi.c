@@ -3,10 +3,15 @@
 */
 
 #include <../src/ksp/pc/impls/bjacobi/bjacobi.h> /*I "petscpc.h" I*/
+#include <petsc/private/kernels/blockinvert.h>
 
 static PetscErrorCode PCSetUp_BJacobi_Singleblock(PC, Mat, Mat);
 static PetscErrorCode PCSetUp_BJacobi_Multiblock(PC, Mat, Mat);
 static PetscErrorCode PCSetUp_BJacobi_Multiproc(PC);
+static PetscErrorCode PCSetUp_BJacobi_Batched(PC, Mat);
+
+/* largest block inverted as a dense matrix when the local blocks are batched, see PCBJacobiSetBatched() */
+#define PCBJACOBI_BATCHED_MAX_BLOCK_SIZE 1024
 
 static PetscErrorCode PCSetUp_BJacobi(PC pc)
 {
@@ -24,6 +29,7 @@ static PetscErrorCode PCSetUp_BJacobi(PC pc)
   PetscCall(MatGetBlockSize(pc->pmat, &bs));
 
   if (jac->n > 0 && jac->n < size) {
+    if (jac->batched) PetscCall(PetscInfo(pc, "Ignoring the batching of the local blocks since each block is shared by several processes\n"));
     PetscCall(PCSetUp_BJacobi_Multiproc(pc));
     PetscFunctionReturn(PETSC_SUCCESS);
   }
@@ -124,7 +130,9 @@ static PetscErrorCode PCSetUp_BJacobi(PC pc)
   /*
      Setup code depends on the number of blocks
   */
-  if (jac->n_local == 1) {
+  if (jac->batched) {
+    PetscCall(PCSetUp_BJacobi_Batched(pc, pmat));
+  } else if (jac->n_local == 1) {
     PetscCall(PCSetUp_BJacobi_Singleblock(pc, mat, pmat));
   } else {
     PetscCall(PCSetUp_BJacobi_Multiblock(pc, mat, pmat));
@@ -145,6 +153,8 @@ static PetscErrorCode PCDestroy_BJacobi(PC pc)
   PetscCall(PetscObjectComposeFunction((PetscObject)pc, "PCBJacobiGetTotalBlocks_C", NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)pc, "PCBJacobiSetLocalBlocks_C", NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)pc, "PCBJacobiGetLocalBlocks_C", NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)pc, "PCBJacobiSetBatched_C", NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)pc, "PCBJacobiGetBatched_C", NULL));
   PetscCall(PetscFree(pc->data));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -153,7 +163,7 @@ static PetscErrorCode PCSetFromOptions_BJacobi(PC pc, PetscOptionItems PetscOpti
 {
   PC_BJacobi *jac = (PC_BJacobi *)pc->data;
   PetscInt    blocks, i;
-  PetscBool   flg;
+  PetscBool   flg, batched;
 
   PetscFunctionBegin;
   PetscOptionsHeadBegin(PetscOptionsObject, "Block Jacobi options");
@@ -161,6 +171,8 @@ static PetscErrorCode PCSetFromOptions_BJacobi(PC pc, PetscOptionItems PetscOpti
   if (flg) PetscCall(PCBJacobiSetTotalBlocks(pc, blocks, NULL));
   PetscCall(PetscOptionsInt("-pc_bjacobi_local_blocks", "Local number of blocks", "PCBJacobiSetLocalBlocks", jac->n_local, &blocks, &flg));
   if (flg) PetscCall(PCBJacobiSetLocalBlocks(pc, blocks, NULL));
+  PetscCall(PetscOptionsBool("-pc_bjacobi_batched", "Invert all local blocks together as dense matrices", "PCBJacobiSetBatched", jac->batched, &batched, &flg));
+  if (flg) PetscCall(PCBJacobiSetBatched(pc, batched));
   if (jac->ksp) {
     /* The sub-KSP has already been set up (e.g., PCSetUp_BJacobi_Singleblock), but KSPSetFromOptions was not called
      * unless we had already been called. */
@@ -190,6 +202,18 @@ static PetscErrorCode PCView_BJacobi(PC pc, PetscViewer viewer)
     if (pc->useAmat) PetscCall(PetscViewerASCIIPrintf(viewer, "  using Amat local matrix, number of blocks = %" PetscInt_FMT "\n", jac->n));
     PetscCall(PetscViewerASCIIPrintf(viewer, "  number of blocks = %" PetscInt_FMT "\n", jac->n));
     PetscCallMPI(MPI_Comm_rank(PetscObjectComm((PetscObject)pc), &rank));
+    if (jac->batched) {
+      PC_BJacobi_Batched *bjac = (PC_BJacobi_Batched *)jac->data;
+
+      PetscCall(PetscViewerASCIIPrintf(viewer, "  local blocks inverted together as dense matrices\n"));
+      if (bjac) {
+        PetscCall(PetscViewerASCIIPushSynchronized(viewer));
+        PetscCall(PetscViewerASCIISynchronizedPrintf(viewer, "  [%d] number of local blocks = %" PetscInt_FMT ", groups of equal size = %" PetscInt_FMT ", largest block = %" PetscInt_FMT "\n", rank, jac->n_local, bjac->ngroups, bjac->ngroups ? bjac->gsizes[bjac->ngroups - 1] : 0));
+        PetscCall(PetscViewerFlush(viewer));
+        PetscCall(PetscViewerASCIIPopSynchronized(viewer));
+      }
+      PetscFunctionReturn(PETSC_SUCCESS);
+    }
     PetscCall(PetscViewerGetFormat(viewer, &format));
     if (format != PETSC_VIEWER_ASCII_INFO_DETAIL) {
       PetscCall(PetscViewerASCIIPrintf(viewer, "  Local solver information for first block is in the following KSP and PC objects on rank 0:\n"));
@@ -262,6 +286,7 @@ static PetscErrorCode PCBJacobiGetSubKSP_BJacobi(PC pc, PetscInt *n_local, Petsc
 
   PetscFunctionBegin;
   PetscCheck(pc->setupcalled, PetscObjectComm((PetscObject)pc), PETSC_ERR_ARG_WRONGSTATE, "Must call KSPSetUp() or PCSetUp() first");
+  PetscCheck(!jac->batched, PetscObjectComm((PetscObject)pc), PETSC_ERR_ARG_WRONGSTATE, "There are no sub-KSPs when the local blocks are batched, see PCBJacobiSetBatched()");
 
   if (n_local) *n_local = jac->n_local;
   if (first_local) *first_local = jac->first_local;
@@ -320,6 +345,25 @@ static PetscErrorCode PCBJacobiGetLocalBlocks_BJacobi(PC pc, PetscInt *blocks, c
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode PCBJacobiSetBatched_BJacobi(PC pc, PetscBool flg)
+{
+  PC_BJacobi *jac = (PC_BJacobi *)pc->data;
+
+  PetscFunctionBegin;
+  PetscCheck(!pc->setupcalled || jac->batched == flg, PetscObjectComm((PetscObject)pc), PETSC_ERR_ORDER, "Cannot change batching after PCSetUp()/KSPSetUp() has been called");
+  jac->batched = flg;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PCBJacobiGetBatched_BJacobi(PC pc, PetscBool *flg)
+{
+  PC_BJacobi *jac = (PC_BJacobi *)pc->data;
+
+  PetscFunctionBegin;
+  *flg = jac->batched;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@C
   PCBJacobiGetSubKSP - Gets the local `KSP` contexts for all blocks on
   this processor.
@@ -468,13 +512,75 @@ PetscErrorCode PCBJacobiGetLocalBlocks(PC pc, PetscInt *blocks, const PetscInt *
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+  PCBJacobiSetBatched - Sets whether the local blocks of the block Jacobi, `PCBJACOBI`, preconditioner
+  are inverted together as dense matrices instead of each being solved with its own `KSP`
+
+  Logically Collective
+
+  Input Parameters:
++ pc  - the preconditioner context
+- flg - `PETSC_TRUE` to batch the local blocks
+
+  Options Database Key:
+. -pc_bjacobi_batched <bool> - Invert all local blocks together as dense matrices
+
+  Level: intermediate
+
+  Notes:
+  Each block is applied exactly, as with `-sub_ksp_type preonly -sub_pc_type lu`, but no `KSP`, `PC` or submatrix is created
+  for it. The blocks are grouped by size, the dense inverses of all the blocks are computed in one pass at setup, and each
+  application is a dense matrix-vector product per block. With OpenMP the blocks of a group are applied concurrently, and
+  when PETSc is also configured with thread safety (`--with-threadsafety`) the inversions are computed concurrently too.
+
+  This is intended for many small blocks per process, see `PCBJacobiSetLocalBlocks()`; the storage and setup cost grow
+  with the square and the cube of the block size, so blocks with more than 1024 rows generate an error. `PCBJacobiGetSubKSP()`
+  cannot be used with batched blocks. The batching is ignored when a block is shared by several processes.
+
+.seealso: [](ch_ksp), `PCBJACOBI`, `PCBJacobiGetBatched()`, `PCBJacobiSetLocalBlocks()`, `PCVPBJACOBI`
+@*/
+PetscErrorCode PCBJacobiSetBatched(PC pc, PetscBool flg)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(pc, PC_CLASSID, 1);
+  PetscValidLogicalCollectiveBool(pc, flg, 2);
+  PetscTryMethod(pc, "PCBJacobiSetBatched_C", (PC, PetscBool), (pc, flg));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+  PCBJacobiGetBatched - Gets whether the local blocks of the block Jacobi, `PCBJACOBI`, preconditioner
+  are inverted together as dense matrices
+
+  Not Collective
+
+  Input Parameter:
+. pc - the preconditioner context
+
+  Output Parameter:
+. flg - `PETSC_TRUE` if the local blocks are batched
+
+  Level: intermediate
+
+.seealso: [](ch_ksp), `PCBJACOBI`, `PCBJacobiSetBatched()`
+@*/
+PetscErrorCode PCBJacobiGetBatched(PC pc, PetscBool *flg)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(pc, PC_CLASSID, 1);
+  PetscAssertPointer(flg, 2);
+  PetscUseMethod(pc, "PCBJacobiGetBatched_C", (PC, PetscBool *), (pc, flg));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*MC
    PCBJACOBI - Use block Jacobi preconditioning, each block is (approximately) solved with
            its own `KSP` object.
 
    Options Database Keys:
 +  -pc_use_amat - use Amat to apply block of operator in inner Krylov method
--  -pc_bjacobi_blocks <n> - use n total blocks
+.  -pc_bjacobi_blocks <n> - use n total blocks
+-  -pc_bjacobi_batched <bool> - invert all local blocks together as dense matrices, see `PCBJacobiSetBatched()`
 
    Level: beginner
 
@@ -498,7 +604,7 @@ PetscErrorCode PCBJacobiGetLocalBlocks(PC pc, PetscInt *blocks, const PetscInt *
 
 .seealso: [](ch_ksp), `PCCreate()`, `PCSetType()`, `PCType`, `PC`, `PCType`,
           `PCASM`, `PCSetUseAmat()`, `PCGetUseAmat()`, `PCBJacobiGetSubKSP()`, `PCBJacobiSetTotalBlocks()`,
-          `PCBJacobiSetLocalBlocks()`, `PCSetModifySubMatrices()`, `PCJACOBI`, `PCVPBJACOBI`, `PCPBJACOBI`
+          `PCBJacobiSetLocalBlocks()`, `PCSetModifySubMatrices()`, `PCJACOBI`, `PCVPBJACOBI`, `PCPBJACOBI`, `PCBJacobiSetBatched()`
 M*/
 
 PETSC_EXTERN PetscErrorCode PCCreate_BJacobi(PC pc)
@@ -534,6 +640,8 @@ PETSC_EXTERN PetscErrorCode PCCreate_BJacobi(PC pc)
   PetscCall(PetscObjectComposeFunction((PetscObject)pc, "PCBJacobiGetTotalBlocks_C", PCBJacobiGetTotalBlocks_BJacobi));
   PetscCall(PetscObjectComposeFunction((PetscObject)pc, "PCBJacobiSetLocalBlocks_C", PCBJacobiSetLocalBlocks_BJacobi));
   PetscCall(PetscObjectComposeFunction((PetscObject)pc, "PCBJacobiGetLocalBlocks_C", PCBJacobiGetLocalBlocks_BJacobi));
+  PetscCall(PetscObjectComposeFunction((PetscObject)pc, "PCBJacobiSetBatched_C", PCBJacobiSetBatched_BJacobi));
+  PetscCall(PetscObjectComposeFunction((PetscObject)pc, "PCBJacobiGetBatched_C", PCBJacobiGetBatched_BJacobi));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -1140,6 +1248,201 @@ static PetscErrorCode PCSetUp_BJacobi_Multiblock(PC pc, Mat mat, Mat pmat)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+      These are for multiple blocks per process inverted together as dense matrices
+*/
+static PetscErrorCode PCReset_BJacobi_Batched(PC pc)
+{
+  PC_BJacobi         *jac  = (PC_BJacobi *)pc->data;
+  PC_BJacobi_Batched *bjac = (PC_BJacobi_Batched *)jac->data;
+
+  PetscFunctionBegin;
+  if (bjac) {
+    PetscCall(PetscFree3(bjac->gsizes, bjac->gstarts, bjac->perm));
+    PetscCall(PetscFree4(bjac->starts, bjac->offsets, bjac->pivots, bjac->work));
+    PetscCall(PetscFree(bjac->diag));
+  }
+  PetscCall(PetscFree(jac->l_lens));
+  PetscCall(PetscFree(jac->g_lens));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PCDestroy_BJacobi_Batched(PC pc)
+{
+  PC_BJacobi *jac = (PC_BJacobi *)pc->data;
+
+  PetscFunctionBegin;
+  PetscCall(PCReset_BJacobi_Batched(pc));
+  PetscCall(PetscFree(jac->data));
+  PetscCall(PCDestroy_BJacobi(pc));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PCApply_BJacobi_Batched_Private(PC pc, Vec x, Vec y, PetscBool transpose)
+{
+  PC_BJacobi         *jac  = (PC_BJacobi *)pc->data;
+  PC_BJacobi_Batched *bjac = (PC_BJacobi_Batched *)jac->data;
+  const PetscScalar  *xin;
+  PetscScalar        *yin;
+  PetscLogDouble      flops = 0.0;
+
+  PetscFunctionBegin;
+  PetscCall(PetscLogEventBegin(transpose ? PC_ApplyTransposeOnBlocks : PC_ApplyOnBlocks, pc, x, y, 0));
+  PetscCall(VecGetArrayRead(x, &xin));
+  PetscCall(VecGetArrayWrite(y, &yin));
+  /* blocks of one group share a size, so every iteration of the threaded loop does the same work */
+  for (PetscInt g = 0; g < bjac->ngroups; g++) {
+    const PetscInt bs = bjac->gsizes[g];
+
+    PetscPragmaOMP(parallel for schedule(static))
+    for (PetscInt k = bjac->gstarts[g]; k < bjac->gstarts[g + 1]; k++) {
+      const PetscInt     b  = bjac->perm[k];
+      const PetscScalar *d  = bjac->diag + bjac->offsets[b];
+      const PetscScalar *xb = xin + bjac->starts[b];
+      PetscScalar       *yb = yin + bjac->starts[b];
+
+      if (transpose) {
+        for (PetscInt i = 0; i < bs; i++) {
+          PetscScalar sum = 0.0;
+
+          for (PetscInt j = 0; j < bs; j++) sum += d[j + i * bs] * xb[j];
+          yb[i] = sum;
+        }
+      } else {
+        for (PetscInt i = 0; i < bs; i++) yb[i] = 0.0;
+        for (PetscInt j = 0; j < bs; j++) {
+          for (PetscInt i = 0; i < bs; i++) yb[i] += d[i + j * bs] * xb[j];
+        }
+      }
+    }
+    flops += (2.0 * bs - 1.0) * bs * (bjac->gstarts[g + 1] - bjac->gstarts[g]);
+  }
+  PetscCall(VecRestoreArrayRead(x, &xin));
+  PetscCall(VecRestoreArrayWrite(y, &yin));
+  PetscCall(PetscLogFlops(flops));
+  PetscCall(PetscLogEventEnd(transpose ? PC_ApplyTransposeOnBlocks : PC_ApplyOnBlocks, pc, x, y, 0));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PCApply_BJacobi_Batched(PC pc, Vec x, Vec y)
+{
+  PetscFunctionBegin;
+  PetscCall(PCApply_BJacobi_Batched_Private(pc, x, y, PETSC_FALSE));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PCApplyTranspose_BJacobi_Batched(PC pc, Vec x, Vec y)
+{
+  PetscFunctionBegin;
+  PetscCall(PCApply_BJacobi_Batched_Private(pc, x, y, PETSC_TRUE));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/* Gathers the block of rows [start, start + bs) of a SeqAIJ matrix into column-major d[] and inverts it in place */
+static PetscErrorCode PCBJacobiInvertBlock_Private(PetscInt bs, PetscInt start, const PetscInt ai[], const PetscInt aj[], const PetscScalar aa[], PetscScalar d[], PetscInt pivots[], PetscScalar work[], PetscBool *zeropivot)
+{
+  PetscFunctionBegin;
+  PetscCall(PetscArrayzero(d, bs * bs));
+  for (PetscInt r = 0; r < bs; r++) {
+    for (PetscInt k = ai[start + r]; k < ai[start + r + 1]; k++) {
+      const PetscInt c = aj[k] - start;
+
+      if (c >= 0 && c < bs) d[r + c * bs] = aa[k];
+    }
+  }
+  if (bs == 1) {
+    *zeropivot = (PetscBool)(d[0] == 0.0);
+    if (!*zeropivot) d[0] = 1.0 / d[0];
+  } else PetscCall(PetscKernel_A_gets_inverse_A(bs, d, pivots, work, PETSC_TRUE, zeropivot));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PCSetUp_BJacobi_Batched(PC pc, Mat pmat)
+{
+  PC_BJacobi         *jac     = (PC_BJacobi *)pc->data;
+  PC_BJacobi_Batched *bjac    = (PC_BJacobi_Batched *)jac->data;
+  PetscInt            n_local = jac->n_local, m;
+  Mat                 A;
+  const PetscInt     *ai, *aj;
+  const PetscScalar  *aa;
+  PetscBool           isseqaij, done, *zeropivot;
+  PetscLogDouble      flops = 0.0;
+
+  PetscFunctionBegin;
+  if (!bjac) {
+    pc->ops->reset               = PCReset_BJacobi_Batched;
+    pc->ops->destroy             = PCDestroy_BJacobi_Batched;
+    pc->ops->apply               = PCApply_BJacobi_Batched;
+    pc->ops->matapply            = NULL;
+    pc->ops->matapplytranspose   = NULL;
+    pc->ops->applysymmetricleft  = NULL;
+    pc->ops->applysymmetricright = NULL;
+    pc->ops->applytranspose      = PCApplyTranspose_BJacobi_Batched;
+    pc->ops->setuponblocks       = NULL;
+
+    PetscCall(PetscNew(&bjac));
+    jac->data = (void *)bjac;
+  }
+  /* the grouping only depends on the block layout, so it is computed once and kept across numeric setups */
+  if (!bjac->diag) {
+    PetscInt M, nd = 0;
+
+    for (PetscInt i = 0; i < n_local; i++) PetscCheck(jac->l_lens[i] <= PCBJACOBI_BATCHED_MAX_BLOCK_SIZE, PETSC_COMM_SELF, PETSC_ERR_SUP, "Local block %" PetscInt_FMT " has %" PetscInt_FMT " rows, more than the %d allowed for batched blocks; use more local blocks with PCBJacobiSetLocalBlocks() or do not batch them", i, jac->l_lens[i], PCBJACOBI_BATCHED_MAX_BLOCK_SIZE);
+    PetscCall(MatGetLocalSize(pmat, &M, NULL));
+    PetscCall(PetscMalloc3(n_local, &bjac->gsizes, n_local + 1, &bjac->gstarts, n_local, &bjac->perm));
+    PetscCall(PetscMalloc4(n_local, &bjac->starts, n_local, &bjac->offsets, M, &bjac->pivots, M, &bjac->work));
+    for (PetscInt i = 0, start = 0; i < n_local; i++) {
+      bjac->starts[i]  = start;
+      bjac->offsets[i] = nd;
+      bjac->perm[i]    = i;
+      start += jac->l_lens[i];
+      nd += jac->l_lens[i] * jac->l_lens[i];
+    }
+    PetscCall(PetscSortIntWithPermutation(n_local, jac->l_lens, bjac->perm));
+    bjac->ngroups = 0;
+    for (PetscInt k = 0; k < n_local; k++) {
+      if (k && jac->l_lens[bjac->perm[k]] == jac->l_lens[bjac->perm[k - 1]]) continue;
+      bjac->gsizes[bjac->ngroups]    = jac->l_lens[bjac->perm[k]];
+      bjac->gstarts[bjac->ngroups++] = k;
+    }
+    bjac->gstarts[bjac->ngroups] = n_local;
+    PetscCall(PetscMalloc1(nd, &bjac->diag));
+  }
+
+  PetscCall(PetscObjectBaseTypeCompare((PetscObject)pmat, MATSEQAIJ, &isseqaij));
+  if (isseqaij) {
+    A = pmat;
+    PetscCall(PetscObjectReference((PetscObject)A));
+  } else PetscCall(MatConvert(pmat, MATSEQAIJ, MAT_INITIAL_MATRIX, &A));
+  PetscCall(MatGetRowIJ(A, 0, PETSC_FALSE, PETSC_FALSE, &m, &ai, &aj, &done));
+  PetscCheck(done, PETSC_COMM_SELF, PETSC_ERR_PLIB, "MatGetRowIJ() failed");
+  PetscCall(MatSeqAIJGetArrayRead(A, &aa));
+  PetscCall(PetscCalloc1(n_local, &zeropivot));
+  pc->failedreason = PC_NOERROR;
+  /* largest blocks first so that the dynamic schedule balances the cubic inversion cost across threads */
+#if defined(PETSC_HAVE_THREADSAFETY)
+  PetscPragmaOMP(parallel for schedule(dynamic))
+#endif
+  for (PetscInt k = n_local - 1; k >= 0; k--) {
+    const PetscInt b = bjac->perm[k], start = bjac->starts[b];
+
+    PetscCallAbort(PETSC_COMM_SELF, PCBJacobiInvertBlock_Private(jac->l_lens[b], start, ai, aj, aa, bjac->diag + bjac->offsets[b], bjac->pivots + start, bjac->work + start, &zeropivot[b]));
+  }
+  PetscCall(MatSeqAIJRestoreArrayRead(A, &aa));
+  PetscCall(MatRestoreRowIJ(A, 0, PETSC_FALSE, PETSC_FALSE, &m, &ai, &aj, &done));
+  PetscCall(MatDestroy(&A));
+  for (PetscInt g = 0; g < bjac->ngroups; g++) flops += 2.0 * PetscPowInt64(bjac->gsizes[g], 3) / 3.0 * (bjac->gstarts[g + 1] - bjac->gstarts[g]);
+  PetscCall(PetscLogFlops(flops));
+  for (PetscInt i = 0; i < n_local; i++) {
+    if (!zeropivot[i]) continue;
+    PetscCheck(!pc->erroriffailure, PETSC_COMM_SELF, PETSC_ERR_MAT_LU_ZRPVT, "Zero pivot in local block %" PetscInt_FMT, i);
+    PetscCall(PetscInfo(pc, "Zero pivot in local block %" PetscInt_FMT "\n", i));
+    pc->failedreason = PC_SUBPC_ERROR;
+  }
+  PetscCall(PetscFree(zeropivot));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
       These are for a single block with multiple processes
 */
@@ -17,6 +17,7 @@ typedef struct {
   PetscInt    *l_lens;         /* lens of each block */
   PetscInt    *g_lens;
   PetscSubcomm psubcomm; /* for multiple processors per block */
+  PetscBool    batched;  /* invert all local blocks together as dense matrices instead of using sub-KSPs */
 } PC_BJacobi;
 
 /*
@@ -31,6 +32,19 @@ typedef struct {
   IS       *is;         /* for gathering the submatrices */
 } PC_BJacobi_Multiblock;
 
+/*  This is for multiple blocks per processor inverted together, grouped by size */
+typedef struct {
+  PetscInt     ngroups; /* number of groups of equal-size blocks */
+  PetscInt    *gsizes;  /* block size of each group */
+  PetscInt    *gstarts; /* first entry of each group in perm[] */
+  PetscInt    *perm;    /* local blocks sorted by size */
+  PetscInt    *starts;  /* starting point of each block */
+  PetscInt    *offsets; /* starting point of each block inverse in diag[] */
+  PetscInt    *pivots;  /* pivot workspace, one segment per block */
+  PetscScalar *work;    /* inversion workspace, one segment per block */
+  PetscScalar *diag;    /* column-major inverses of the blocks */
+} PC_BJacobi_Batched;
+
 /*  This is for a single block per processor */
 typedef struct {
   Vec x, y;
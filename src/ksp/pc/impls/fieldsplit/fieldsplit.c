@@ -26,6 +26,11 @@ struct _PC_FieldSplitLink {
   PC_FieldSplitLink next, previous;
   PetscLogEvent     event;
 
+  /* Used only with PCFieldSplitSetSubcomm(), the split vector laid out over the sub-communicator of this split */
+  Vec        xtmp;
+  VecScatter subsctx;
+  PetscInt   subsize;
+
   /* Used only when setting coordinates with PCSetCoordinates */
   PetscInt   dim;
   PetscInt   ndofs;
@@ -75,6 +80,12 @@ typedef struct {
   PetscBool         offdiag_use_amat; /* Whether to extract off-diagonal matrix blocks from Amat, rather than Pmat (weaker than -pc_use_amat) */
   PetscBool         detect;           /* Whether to form 2-way split by finding zero diagonal entries */
   PetscBool         coordinates_set;  /* Whether PCSetCoordinates has been called */
+
+  /* Only used when the additive splits are solved concurrently on sub-communicators */
+  PetscBool    subcomm;    /* Whether PCFieldSplitSetSubcomm() has been requested */
+  PetscSubcomm psubcomm;   /* One sub-communicator per split, NULL when the splits are solved on the full communicator */
+  KSP          subksp;     /* The solver for the split owned by this process, on PetscSubcommChild(psubcomm) */
+  Vec          xsub, ysub; /* Work vectors for subksp */
 } PC_FieldSplit;
 
 /*
@@ -122,22 +133,45 @@ static PetscErrorCode PCView_FieldSplit(PC pc, PetscViewer viewer)
     if (pc->useAmat) PetscCall(PetscViewerASCIIPrintf(viewer, "  using Amat (not Pmat) as operator for blocks\n"));
     if (jac->diag_use_amat) PetscCall(PetscViewerASCIIPrintf(viewer, "  using Amat (not Pmat) as operator for diagonal blocks\n"));
     if (jac->offdiag_use_amat) PetscCall(PetscViewerASCIIPrintf(viewer, "  using Amat (not Pmat) as operator for off-diagonal blocks\n"));
+    if (jac->psubcomm) {
+      PetscCall(PetscViewerASCIIPrintf(viewer, "  splits solved concurrently on sub-communicators of sizes"));
+      PetscCall(PetscViewerASCIIUseTabs(viewer, PETSC_FALSE));
+      for (ilink = jac->head; ilink; ilink = ilink->next) PetscCall(PetscViewerASCIIPrintf(viewer, " %" PetscInt_FMT, ilink->subsize));
+      PetscCall(PetscViewerASCIIPrintf(viewer, "\n"));
+      PetscCall(PetscViewerASCIIUseTabs(viewer, PETSC_TRUE));
+      ilink = jac->head;
+    }
     PetscCall(PetscViewerASCIIPrintf(viewer, "  Solver info for each split is in the following KSP objects:\n"));
-    for (i = 0; i < jac->nsplits; i++) {
-      if (ilink->fields) {
-        PetscCall(PetscViewerASCIIPrintf(viewer, "Split number %" PetscInt_FMT " Fields ", i));
-        PetscCall(PetscViewerASCIIUseTabs(viewer, PETSC_FALSE));
-        for (j = 0; j < ilink->nfields; j++) {
-          if (j > 0) PetscCall(PetscViewerASCIIPrintf(viewer, ","));
-          PetscCall(PetscViewerASCIIPrintf(viewer, " %" PetscInt_FMT, ilink->fields[j]));
+    if (jac->psubcomm) {
+      PetscViewer sviewer;
+
+      /* each split is solved by jac->subksp on its own sub-communicator, the first process of each one prints it, in the order of the splits */
+      PetscCall(PetscViewerGetSubViewer(viewer, PetscSubcommChild(jac->psubcomm), &sviewer));
+      for (i = 0; i < jac->nsplits; i++, ilink = ilink->next) {
+        if (i != jac->psubcomm->color) continue;
+        PetscCall(PetscViewerASCIIPrintf(sviewer, "Split number %" PetscInt_FMT " solved on a sub-communicator of size %" PetscInt_FMT "\n", i, ilink->subsize));
+        PetscCall(KSPView(jac->subksp, sviewer));
+      }
+      PetscCall(PetscViewerRestoreSubViewer(viewer, PetscSubcommChild(jac->psubcomm), &sviewer));
+      /*  extra call needed because of the two calls to PetscViewerASCIIPushSynchronized() in PetscViewerGetSubViewer() */
+      PetscCall(PetscViewerASCIIPopSynchronized(viewer));
+    } else {
+      for (i = 0; i < jac->nsplits; i++) {
+        if (ilink->fields) {
+          PetscCall(PetscViewerASCIIPrintf(viewer, "Split number %" PetscInt_FMT " Fields ", i));
+          PetscCall(PetscViewerASCIIUseTabs(viewer, PETSC_FALSE));
+          for (j = 0; j < ilink->nfields; j++) {
+            if (j > 0) PetscCall(PetscViewerASCIIPrintf(viewer, ","));
+            PetscCall(PetscViewerASCIIPrintf(viewer, " %" PetscInt_FMT, ilink->fields[j]));
+          }
+          PetscCall(PetscViewerASCIIPrintf(viewer, "\n"));
+          PetscCall(PetscViewerASCIIUseTabs(viewer, PETSC_TRUE));
+        } else {
+          PetscCall(PetscViewerASCIIPrintf(viewer, "Split number %" PetscInt_FMT " Defined by IS\n", i));
         }
-        PetscCall(PetscViewerASCIIPrintf(viewer, "\n"));
-        PetscCall(PetscViewerASCIIUseTabs(viewer, PETSC_TRUE));
-      } else {
-        PetscCall(PetscViewerASCIIPrintf(viewer, "Split number %" PetscInt_FMT " Defined by IS\n", i));
+        PetscCall(KSPView(ilink->ksp, viewer));
+        ilink = ilink->next;
       }
-      PetscCall(KSPView(ilink->ksp, viewer));
-      ilink = ilink->next;
     }
   }
 
@@ -574,6 +608,134 @@ static PetscErrorCode MatGolubKahanComputeExplicitOperator(Mat A, Mat B, Mat C,
 
 PETSC_EXTERN PetscErrorCode PetscOptionsFindPairPrefix_Private(PetscOptions, const char pre[], const char name[], const char *option[], const char *value[], PetscBool *flg);
 
+/*
+  Assigns each additive split a disjoint, contiguous group of processes: every split gets one process, the remaining
+  processes are handed out in proportion to the global split sizes and any leftover goes to the split with the most rows per process
+*/
+static PetscErrorCode PCFieldSplitSubcommSizes_Private(PetscMPIInt size, PetscInt nsplit, const PetscInt N[], PetscInt np[])
+{
+  PetscInt Ntotal = 0, nassigned = 0;
+
+  PetscFunctionBegin;
+  for (PetscInt i = 0; i < nsplit; i++) Ntotal += N[i];
+  for (PetscInt i = 0; i < nsplit; i++) {
+    np[i] = 1 + (Ntotal ? (PetscInt)((PetscReal)(size - nsplit) * (PetscReal)N[i] / (PetscReal)Ntotal) : 0);
+    nassigned += np[i];
+  }
+  for (; nassigned < size; nassigned++) {
+    PetscInt j = 0;
+
+    for (PetscInt i = 1; i < nsplit; i++) {
+      if ((PetscReal)N[i] * (PetscReal)np[j] > (PetscReal)N[j] * (PetscReal)np[i]) j = i;
+    }
+    np[j]++;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+  Redistributes each split onto its own sub-communicator, in the same way as PCTELESCOPE, so that every process only takes part in the solve of one split
+*/
+static PetscErrorCode PCFieldSplitSetUpSubcomm_Private(PC pc)
+{
+  PC_FieldSplit    *jac = (PC_FieldSplit *)pc->data;
+  PC_FieldSplitLink ilink;
+  MPI_Comm          comm;
+  PetscInt          i, nsplit = jac->nsplits;
+  Mat               Bred = NULL, *Blocal;
+  MatReuse          reuse = MAT_INITIAL_MATRIX;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectGetComm((PetscObject)pc, &comm));
+  if (!jac->psubcomm) {
+    PetscMPIInt size, rank, color = 0, subrank = 0, nsub;
+    PetscInt   *N, *np, offset = 0;
+    Vec         xfull;
+    const char *prefix = NULL;
+
+    PetscCallMPI(MPI_Comm_size(comm, &size));
+    if (size < nsplit) {
+      PetscCall(PetscInfo(pc, "Only %d processes for %" PetscInt_FMT " splits, solving the splits on the full communicator\n", size, nsplit));
+      PetscFunctionReturn(PETSC_SUCCESS);
+    }
+    PetscCallMPI(MPI_Comm_rank(comm, &rank));
+    PetscCall(PetscMalloc2(nsplit, &N, nsplit, &np));
+    for (i = 0; i < nsplit; i++) PetscCall(MatGetSize(jac->pmat[i], &N[i], NULL));
+    PetscCall(PCFieldSplitSubcommSizes_Private(size, nsplit, N, np));
+    for (i = 0; i < nsplit; i++) {
+      if (rank >= offset && rank < offset + np[i]) {
+        PetscCall(PetscMPIIntCast(i, &color));
+        PetscCall(PetscMPIIntCast(rank - offset, &subrank));
+      }
+      offset += np[i];
+    }
+    PetscCall(PetscMPIIntCast(nsplit, &nsub));
+    PetscCall(PetscSubcommCreate(comm, &jac->psubcomm));
+    PetscCall(PetscSubcommSetNumber(jac->psubcomm, nsub));
+    PetscCall(PetscSubcommSetTypeGeneral(jac->psubcomm, color, subrank));
+
+    /* lay out each split over the processes of its sub-communicator, all other processes own none of it */
+    PetscCall(MatCreateVecs(pc->pmat, &xfull, NULL));
+    for (i = 0, ilink = jac->head; ilink; ilink = ilink->next, i++) {
+      PetscInt m = 0, n, rstart;
+      VecType  vtype;
+      IS       isy;
+
+      if (i == color) {
+        m = N[i] / np[i] + (subrank < N[i] % np[i] ? 1 : 0);
+        PetscCall(KSPGetOptionsPrefix(ilink->ksp, &prefix));
+      }
+      ilink->subsize = np[i];
+      PetscCall(VecGetType(ilink->x, &vtype));
+      PetscCall(VecCreate(comm, &ilink->xtmp));
+      PetscCall(VecSetSizes(ilink->xtmp, m, N[i]));
+      PetscCall(VecSetType(ilink->xtmp, vtype));
+      PetscCall(VecGetLocalSize(ilink->x, &n));
+      PetscCall(VecGetOwnershipRange(ilink->x, &rstart, NULL));
+      PetscCall(ISCreateStride(comm, n, rstart, 1, &isy));
+      PetscCall(VecScatterCreate(xfull, ilink->is, ilink->xtmp, isy, &ilink->subsctx));
+      PetscCall(ISDestroy(&isy));
+    }
+    PetscCall(VecDestroy(&xfull));
+    PetscCall(PetscFree2(N, np));
+
+    PetscCall(KSPCreate(PetscSubcommChild(jac->psubcomm), &jac->subksp));
+    PetscCall(KSPSetNestLevel(jac->subksp, pc->kspnestlevel));
+    PetscCall(KSPSetErrorIfNotConverged(jac->subksp, pc->erroriffailure));
+    PetscCall(PetscObjectIncrementTabLevel((PetscObject)jac->subksp, (PetscObject)pc, 1));
+    PetscCall(KSPSetType(jac->subksp, KSPPREONLY));
+    PetscCall(KSPSetOptionsPrefix(jac->subksp, prefix));
+  } else if (pc->flag != DIFFERENT_NONZERO_PATTERN) {
+    reuse = MAT_REUSE_MATRIX;
+    PetscCall(KSPGetOperators(jac->subksp, NULL, &Bred));
+  }
+
+  /* every process extracts the rows it owns in the new layout, the processes of each split then assemble them on the sub-communicator */
+  for (i = 0, ilink = jac->head; ilink; ilink = ilink->next, i++) {
+    PetscInt st, ed, Nc;
+    IS       isrow, iscol;
+
+    PetscCall(VecGetOwnershipRange(ilink->xtmp, &st, &ed));
+    PetscCall(MatGetSize(jac->pmat[i], NULL, &Nc));
+    PetscCall(ISCreateStride(PETSC_COMM_SELF, ed - st, st, 1, &isrow));
+    PetscCall(ISCreateStride(PETSC_COMM_SELF, Nc, 0, 1, &iscol));
+    PetscCall(ISSetIdentity(iscol));
+    PetscCall(MatSetOption(jac->pmat[i], MAT_SUBMAT_SINGLEIS, PETSC_TRUE));
+    PetscCall(MatCreateSubMatrices(jac->pmat[i], 1, &isrow, &iscol, MAT_INITIAL_MATRIX, &Blocal));
+    if (i == jac->psubcomm->color) PetscCall(MatCreateMPIMatConcatenateSeqMat(PetscSubcommChild(jac->psubcomm), Blocal[0], ed - st, reuse, &Bred));
+    PetscCall(MatDestroyMatrices(1, &Blocal));
+    PetscCall(ISDestroy(&isrow));
+    PetscCall(ISDestroy(&iscol));
+  }
+  if (reuse == MAT_INITIAL_MATRIX) {
+    PetscCall(KSPSetOperators(jac->subksp, Bred, Bred));
+    if (!jac->xsub) PetscCall(MatCreateVecs(Bred, &jac->xsub, &jac->ysub));
+    PetscCall(MatDestroy(&Bred));
+  }
+  if (!jac->suboptionsset) PetscCall(KSPSetFromOptions(jac->subksp));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode PCSetUp_FieldSplit(PC pc)
 {
   PC_FieldSplit    *jac = (PC_FieldSplit *)pc->data;
@@ -1103,12 +1265,15 @@ static PetscErrorCode PCSetUp_FieldSplit(PC pc)
       PetscCall(PetscObjectIncrementTabLevel((PetscObject)ilink->ksp, (PetscObject)ilink->ksp, 1));
     }
   } else {
+    /* the splits solved on sub-communicators use jac->subksp instead of their own KSP */
+    if (jac->subcomm && jac->type == PC_COMPOSITE_ADDITIVE) PetscCall(PCFieldSplitSetUpSubcomm_Private(pc));
     /* set up the individual splits' PCs */
     i     = 0;
     ilink = jac->head;
     while (ilink) {
-      PetscCall(KSPSetOperators(ilink->ksp, jac->mat[i], jac->pmat[i]));
-      /* really want setfromoptions called in PCSetFromOptions_FieldSplit(), but it is not ready yet */
+      if (!jac->psubcomm) PetscCall(KSPSetOperators(ilink->ksp, jac->mat[i], jac->pmat[i]));
+      /* really want setfromoptions called in PCSetFromOptions_FieldSplit(), but it is not ready yet; with sub-communicators
+         it only processes the options of the splits solved by the other processes, which would otherwise be reported unused */
       if (!jac->suboptionsset) PetscCall(KSPSetFromOptions(ilink->ksp));
       i++;
       ilink = ilink->next;
@@ -1189,6 +1354,11 @@ static PetscErrorCode PCSetUpOnBlocks_FieldSplit(PC pc)
   PC_FieldSplitLink ilink = jac->head;
 
   PetscFunctionBegin;
+  if (jac->psubcomm) {
+    PetscCall(KSPSetUp(jac->subksp));
+    PetscCall(KSPSetUpOnBlocks(jac->subksp));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   while (ilink) {
     PetscCall(KSPSetUp(ilink->ksp));
     PetscCall(KSPSetUpOnBlocks(ilink->ksp));
@@ -1490,6 +1660,48 @@ static PetscErrorCode PCApplyTranspose_FieldSplit_Schur(PC pc, Vec x, Vec y)
                     KSPSolve(ilink->ksp, ilink->x, ilink->y) || KSPCheckSolve(ilink->ksp, pc, ilink->y) || PetscLogEventEnd(ilink->event, ilink->ksp, ilink->x, ilink->y, NULL) || VecScatterBegin(ilink->sctx, ilink->y, yy, ADD_VALUES, SCATTER_REVERSE) || \
                     VecScatterEnd(ilink->sctx, ilink->y, yy, ADD_VALUES, SCATTER_REVERSE)))
 
+/*
+  Each process only takes part in the solve of the split of its sub-communicator so the splits are solved concurrently,
+  the scatters into and out of the sub-communicator layouts are collective on the full communicator
+*/
+static PetscErrorCode PCApply_FieldSplit_Subcomm(PC pc, Vec x, Vec y, PetscBool transpose)
+{
+  PC_FieldSplit     *jac = (PC_FieldSplit *)pc->data;
+  PC_FieldSplitLink  ilink, mine = NULL;
+  PetscInt           i, n;
+  const PetscScalar *xarray;
+  PetscScalar       *yarray;
+
+  PetscFunctionBegin;
+  for (ilink = jac->head; ilink; ilink = ilink->next) PetscCall(VecScatterBegin(ilink->subsctx, x, ilink->xtmp, INSERT_VALUES, SCATTER_FORWARD));
+  for (i = 0, ilink = jac->head; ilink; ilink = ilink->next, i++) {
+    PetscCall(VecScatterEnd(ilink->subsctx, x, ilink->xtmp, INSERT_VALUES, SCATTER_FORWARD));
+    if (i == jac->psubcomm->color) mine = ilink;
+  }
+  PetscCall(VecGetLocalSize(jac->xsub, &n));
+  PetscCall(VecGetArrayRead(mine->xtmp, &xarray));
+  PetscCall(VecGetArrayWrite(jac->xsub, &yarray));
+  PetscCall(PetscArraycpy(yarray, xarray, n));
+  PetscCall(VecRestoreArrayWrite(jac->xsub, &yarray));
+  PetscCall(VecRestoreArrayRead(mine->xtmp, &xarray));
+  PetscCall(PetscLogEventBegin(mine->event, jac->subksp, jac->xsub, jac->ysub, NULL));
+  if (transpose) PetscCall(KSPSolveTranspose(jac->subksp, jac->xsub, jac->ysub));
+  else PetscCall(KSPSolve(jac->subksp, jac->xsub, jac->ysub));
+  PetscCall(KSPCheckSolve(jac->subksp, pc, jac->ysub));
+  PetscCall(PetscLogEventEnd(mine->event, jac->subksp, jac->xsub, jac->ysub, NULL));
+  PetscCall(VecGetArrayRead(jac->ysub, &xarray));
+  PetscCall(VecGetArrayWrite(mine->xtmp, &yarray));
+  PetscCall(PetscArraycpy(yarray, xarray, n));
+  PetscCall(VecRestoreArrayWrite(mine->xtmp, &yarray));
+  PetscCall(VecRestoreArrayRead(jac->ysub, &xarray));
+  PetscCall(VecSet(y, 0.0));
+  for (ilink = jac->head; ilink; ilink = ilink->next) {
+    PetscCall(VecScatterBegin(ilink->subsctx, ilink->xtmp, y, ADD_VALUES, SCATTER_REVERSE));
+    PetscCall(VecScatterEnd(ilink->subsctx, ilink->xtmp, y, ADD_VALUES, SCATTER_REVERSE));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode PCApply_FieldSplit(PC pc, Vec x, Vec y)
 {
   PC_FieldSplit    *jac   = (PC_FieldSplit *)pc->data;
@@ -1500,6 +1712,10 @@ static PetscErrorCode PCApply_FieldSplit(PC pc, Vec x, Vec y)
   if (jac->type == PC_COMPOSITE_ADDITIVE) {
     PetscBool matnest;
 
+    if (jac->psubcomm) {
+      PetscCall(PCApply_FieldSplit_Subcomm(pc, x, y, PETSC_FALSE));
+      PetscFunctionReturn(PETSC_SUCCESS);
+    }
     PetscCall(PetscObjectTypeCompare((PetscObject)pc->pmat, MATNEST, &matnest));
     if (jac->defaultsplit && !matnest) {
       PetscCall(VecGetBlockSize(x, &bs));
@@ -1729,6 +1945,10 @@ static PetscErrorCode PCApplyTranspose_FieldSplit(PC pc, Vec x, Vec y)
   if (jac->type == PC_COMPOSITE_ADDITIVE) {
     PetscBool matnest;
 
+    if (jac->psubcomm) {
+      PetscCall(PCApply_FieldSplit_Subcomm(pc, x, y, PETSC_TRUE));
+      PetscFunctionReturn(PETSC_SUCCESS);
+    }
     PetscCall(PetscObjectTypeCompare((PetscObject)pc->pmat, MATNEST, &matnest));
     if (jac->defaultsplit && !matnest) {
       PetscCall(VecGetBlockSize(x, &bs));
@@ -1798,7 +2018,9 @@ static PetscErrorCode PCReset_FieldSplit(PC pc)
     PetscCall(VecDestroy(&ilink->x));
     PetscCall(VecDestroy(&ilink->y));
     PetscCall(VecDestroy(&ilink->z));
+    PetscCall(VecDestroy(&ilink->xtmp));
     PetscCall(VecScatterDestroy(&ilink->sctx));
+    PetscCall(VecScatterDestroy(&ilink->subsctx));
     PetscCall(ISDestroy(&ilink->is));
     PetscCall(ISDestroy(&ilink->is_col));
     PetscCall(PetscFree(ilink->splitname));
@@ -1835,6 +2057,10 @@ static PetscErrorCode PCReset_FieldSplit(PC pc)
   PetscCall(VecDestroy(&jac->d));
   PetscCall(PetscFree(jac->vecz));
   PetscCall(PetscViewerDestroy(&jac->gkbviewer));
+  PetscCall(KSPDestroy(&jac->subksp));
+  PetscCall(VecDestroy(&jac->xsub));
+  PetscCall(VecDestroy(&jac->ysub));
+  PetscCall(PetscSubcommDestroy(&jac->psubcomm));
   jac->isrestrict = PETSC_FALSE;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1883,6 +2109,7 @@ static PetscErrorCode PCSetFromOptions_FieldSplit(PC pc, PetscOptionItems PetscO
   PetscCall(PCFieldSplitSetDetectSaddlePoint(pc, jac->detect)); /* Sets split type and Schur PC type */
   PetscCall(PetscOptionsEnum("-pc_fieldsplit_type", "Type of composition", "PCFieldSplitSetType", PCCompositeTypes, (PetscEnum)jac->type, (PetscEnum *)&ctype, &flg));
   if (flg) PetscCall(PCFieldSplitSetType(pc, ctype));
+  if (jac->type == PC_COMPOSITE_ADDITIVE) PetscCall(PetscOptionsBool("-pc_fieldsplit_subcomm", "Solve the splits concurrently, each on its own sub-communicator", "PCFieldSplitSetSubcomm", jac->subcomm, &jac->subcomm, NULL));
   /* Only setup fields once */
   if ((jac->bs > 0) && (jac->nsplits == 0)) {
     /* only allow user to set fields from command line.
@@ -1926,6 +2153,7 @@ static PetscErrorCode PCSetFromOptions_FieldSplit(PC pc, PetscOptionItems PetscO
       if (ilink->ksp->totalits > 0) PetscCall(KSPSetFromOptions(ilink->ksp));
       ilink = ilink->next;
     }
+    if (jac->subksp && jac->subksp->totalits > 0) PetscCall(KSPSetFromOptions(jac->subksp));
   }
   PetscOptionsHeadEnd();
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -3254,6 +3482,73 @@ PetscErrorCode PCFieldSplitGetDMSplits(PC pc, PetscBool *flg)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+  PCFieldSplitSetSubcomm - Flags whether the splits of an additive `PCFIELDSPLIT` are solved concurrently, each on its own sub-communicator
+
+  Logically Collective
+
+  Input Parameters:
++ pc  - the preconditioner context
+- flg - boolean indicating whether to solve the splits on disjoint sub-communicators
+
+  Options Database Key:
+. -pc_fieldsplit_subcomm <bool> - solve the additive splits concurrently on sub-communicators
+
+  Level: intermediate
+
+  Notes:
+  Each split is redistributed, as with `PCTELESCOPE`, onto a disjoint group of processes whose size is proportional to the size of the split,
+  every split getting at least one process. Each process then only takes part in the solve of one split. This requires at least as many
+  processes as there are splits, otherwise the splits are solved one after the other on the full communicator.
+
+  Only the preconditioning matrix of each split is used, and the solvers on the sub-communicators are configured through the options database
+  with the prefixes of the `KSP` returned by `PCFieldSplitGetSubKSP()`; those `KSP` themselves are not used to solve.
+
+  This must be called before `PCSetUp()` and is ignored unless the `PCCompositeType` is `PC_COMPOSITE_ADDITIVE`.
+
+.seealso: [](sec_block_matrices), `PC`, `PCFIELDSPLIT`, `PCFieldSplitGetSubcomm()`, `PCFieldSplitSetType()`, `PCTELESCOPE`, `PetscSubcomm`
+@*/
+PetscErrorCode PCFieldSplitSetSubcomm(PC pc, PetscBool flg)
+{
+  PC_FieldSplit *jac = (PC_FieldSplit *)pc->data;
+  PetscBool      isfs;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(pc, PC_CLASSID, 1);
+  PetscValidLogicalCollectiveBool(pc, flg, 2);
+  PetscCall(PetscObjectTypeCompare((PetscObject)pc, PCFIELDSPLIT, &isfs));
+  if (isfs) jac->subcomm = flg;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+  PCFieldSplitGetSubcomm - Returns flag indicating whether the splits of an additive `PCFIELDSPLIT` are solved concurrently, each on its own sub-communicator
+
+  Not Collective
+
+  Input Parameter:
+. pc - the preconditioner context
+
+  Output Parameter:
+. flg - boolean indicating whether to solve the splits on disjoint sub-communicators
+
+  Level: intermediate
+
+.seealso: [](sec_block_matrices), `PC`, `PCFIELDSPLIT`, `PCFieldSplitSetSubcomm()`
+@*/
+PetscErrorCode PCFieldSplitGetSubcomm(PC pc, PetscBool *flg)
+{
+  PC_FieldSplit *jac = (PC_FieldSplit *)pc->data;
+  PetscBool      isfs;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(pc, PC_CLASSID, 1);
+  PetscAssertPointer(flg, 2);
+  PetscCall(PetscObjectTypeCompare((PetscObject)pc, PCFIELDSPLIT, &isfs));
+  if (isfs) *flg = jac->subcomm;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
   PCFieldSplitGetDetectSaddlePoint - Returns flag indicating whether `PCFIELDSPLIT` will attempt to automatically determine fields based on zero diagonal entries.
 
@@ -3330,6 +3625,8 @@ PetscErrorCode PCFieldSplitSetDetectSaddlePoint(PC pc, PetscBool flg)
 .   -pc_fieldsplit_schur_fact_type <diag,lower,upper,full>                           - set factorization type when using `-pc_fieldsplit_type schur`;
                                                                                        see `PCFieldSplitSetSchurFactType()`
 .   -pc_fieldsplit_dm_splits <true,false> (default is true)                          - Whether to use `DMCreateFieldDecomposition()` for splits
+.   -pc_fieldsplit_subcomm <true,false> (default is false)                           - solve the additive splits concurrently, each on its own sub-communicator;
+                                                                                       see `PCFieldSplitSetSubcomm()`
 -   -pc_fieldsplit_detect_saddle_point                                               - automatically finds rows with zero diagonal and uses Schur complement with no preconditioner as the solver
 
   Options prefixes for inner solvers when using the Schur complement preconditioner are `-fieldsplit_0_` and `-fieldsplit_1_` .
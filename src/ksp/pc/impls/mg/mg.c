@@ -675,7 +675,7 @@ static PetscErrorCode PCMatApplyTranspose_MG(PC pc, Mat b, Mat x)
 
 PetscErrorCode PCSetFromOptions_MG(PC pc, PetscOptionItems PetscOptionsObject)
 {
-  PetscInt            levels, cycles;
+  PetscInt            levels, cycles, maxn;
   PetscBool           flg, flg2;
   PC_MG              *mg = (PC_MG *)pc->data;
   PC_MG_Levels      **mglevels;
@@ -707,6 +707,8 @@ PetscErrorCode PCSetFromOptions_MG(PC pc, PetscOptionItems PetscOptionsObject)
   flg2 = PETSC_FALSE;
   PetscCall(PetscOptionsBool("-pc_mg_adapt_cr", "Monitor coarse space quality using Compatible Relaxation (CR)", "PCMGSetAdaptCR", PETSC_FALSE, &flg2, &flg));
   if (flg) PetscCall(PCMGSetAdaptCR(pc, flg2));
+  PetscCall(PetscOptionsInt("-pc_mg_smooths_autotune", "Choose the degree of Chebyshev smoothers up to this value from their measured smoothing rate", "PCMGSetNumberSmoothAutotune", mg->autotunesmooth, &maxn, &flg));
+  if (flg) PetscCall(PCMGSetNumberSmoothAutotune(pc, maxn));
   flg = PETSC_FALSE;
   PetscCall(PetscOptionsBool("-pc_mg_distinct_smoothup", "Create separate smoothup KSP and append the prefix _up", "PCMGSetDistinctSmoothUp", PETSC_FALSE, &flg, NULL));
   if (flg) PetscCall(PCMGSetDistinctSmoothUp(pc));
@@ -775,6 +777,7 @@ PetscErrorCode PCView_MG(PC pc, PetscViewer viewer)
     const char *cyclename = levels ? (mglevels[0]->cycles == PC_MG_CYCLE_V ? "v" : "w") : "unknown";
     PetscCall(PetscViewerASCIIPrintf(viewer, "  type is %s, levels=%" PetscInt_FMT " cycles=%s\n", PCMGTypes[mg->am], levels, cyclename));
     if (mg->am == PC_MG_MULTIPLICATIVE) PetscCall(PetscViewerASCIIPrintf(viewer, "    Cycles per PCApply=%" PetscInt_FMT "\n", mg->cyclesperpcapply));
+    if (mg->autotunesmooth > 0) PetscCall(PetscViewerASCIIPrintf(viewer, "    Chebyshev smoothing steps chosen from measured smoothing rates, at most %" PetscInt_FMT "\n", mg->autotunesmooth));
     if (mg->galerkin == PC_MG_GALERKIN_BOTH) {
       PetscCall(PetscViewerASCIIPrintf(viewer, "    Using Galerkin computed coarse grid matrices\n"));
     } else if (mg->galerkin == PC_MG_GALERKIN_PMAT) {
@@ -846,6 +849,72 @@ PetscErrorCode PCView_MG(PC pc, PetscViewer viewer)
 
 #include <petsc/private/kspimpl.h>
 
+/*
+   Picks the degree of the Chebyshev smoother on a level that gives the largest reduction of the residual per unit of work. The
+   smoother is applied with zero right-hand side to a noisy initial guess with degrees 1 to maxn; a smoothing pass of degree k is
+   counted as k + 1 operator applications, the extra one for the residual and grid transfers of the level.
+*/
+static PetscErrorCode PCMGAutotuneSmooth_Private(PC pc, PetscInt l)
+{
+  PC_MG             *mg  = (PC_MG *)pc->data;
+  PC_MG_Levels      *mgl = mg->levels[l];
+  KSP                smooth[2];
+  Mat                A;
+  Vec                b, x, r;
+  PetscObjectId      id;
+  PetscBool          ischeby, nonzero;
+  PetscReal          r0, rk, rate, bestrate = 0.0;
+  PetscInt           best, nsmooth = (mgl->smoothu && mgl->smoothu != mgl->smoothd) ? 2 : 1;
+  KSPConvergedReason reason;
+
+  PetscFunctionBegin;
+  smooth[0] = mgl->smoothd;
+  smooth[1] = mgl->smoothu;
+  PetscCall(KSPGetOperators(smooth[0], &A, NULL));
+  PetscCall(PetscObjectGetId((PetscObject)A, &id));
+  if (id == mgl->autotuneid) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(PetscObjectTypeCompare((PetscObject)smooth[0], KSPCHEBYSHEV, &ischeby));
+  if (!ischeby) PetscFunctionReturn(PETSC_SUCCESS);
+  mgl->autotuneid = id;
+  PetscCall(KSPGetTolerances(smooth[0], NULL, NULL, NULL, &best));
+
+  PetscCall(MatCreateVecs(A, &x, &b));
+  PetscCall(VecDuplicate(b, &r));
+  PetscCall(VecZeroEntries(b));
+  PetscCall(KSPGetInitialGuessNonzero(smooth[0], &nonzero));
+  PetscCall(KSPSetInitialGuessNonzero(smooth[0], PETSC_TRUE));
+  PetscCall(KSPSetNoisy_Private(A, r));
+  PetscCall(MatMult(A, r, x));
+  PetscCall(VecNorm(x, NORM_2, &r0));
+  for (PetscInt k = 1; k <= mg->autotunesmooth && r0 > 0.0; k++) {
+    PetscCall(KSPSetNoisy_Private(A, x));
+    PetscCall(KSPSetTolerances(smooth[0], PETSC_CURRENT, PETSC_CURRENT, PETSC_CURRENT, k));
+    PetscCall(KSPSolve(smooth[0], b, x));
+    PetscCall(KSPGetConvergedReason(smooth[0], &reason));
+    if (reason < 0) break;
+    PetscCall(MatMult(A, x, r));
+    PetscCall(VecNorm(r, NORM_2, &rk));
+    rate = rk > 0.0 ? -PetscLogReal(rk / r0) / (k + 1) : PETSC_MAX_REAL;
+    PetscCall(PetscInfo(pc, "Level %" PetscInt_FMT " degree %" PetscInt_FMT ": residual reduction %g, rate per operator application %g\n", l, k, (double)(rk / r0), (double)rate));
+    if (rate > bestrate) {
+      bestrate = rate;
+      best     = k;
+    }
+  }
+  PetscCall(KSPSetInitialGuessNonzero(smooth[0], nonzero));
+  PetscCall(VecDestroy(&x));
+  PetscCall(VecDestroy(&b));
+  PetscCall(VecDestroy(&r));
+
+  PetscCall(PetscInfo(pc, "Level %" PetscInt_FMT ": using %" PetscInt_FMT " smoothing steps\n", l, best));
+  for (PetscInt s = 0; s < nsmooth; s++) {
+    PetscCall(PetscObjectTypeCompare((PetscObject)smooth[s], KSPCHEBYSHEV, &ischeby));
+    if (!ischeby) continue;
+    PetscCall(KSPSetTolerances(smooth[s], PETSC_CURRENT, PETSC_CURRENT, PETSC_CURRENT, best));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
     Calls setup for the KSP on each level
 */
@@ -1206,6 +1275,14 @@ PetscErrorCode PCSetUp_MG(PC pc)
     }
   }
 
+  if (mg->autotunesmooth > 0) {
+    for (i = 1; i < n; i++) {
+      if (mglevels[i]->eventsmoothsetup) PetscCall(PetscLogEventBegin(mglevels[i]->eventsmoothsetup, 0, 0, 0, 0));
+      PetscCall(PCMGAutotuneSmooth_Private(pc, i));
+      if (mglevels[i]->eventsmoothsetup) PetscCall(PetscLogEventEnd(mglevels[i]->eventsmoothsetup, 0, 0, 0, 0));
+    }
+  }
+
   if (mglevels[0]->eventsmoothsetup) PetscCall(PetscLogEventBegin(mglevels[0]->eventsmoothsetup, 0, 0, 0, 0));
   PetscCall(KSPSetUp(mglevels[0]->smoothd));
   if (mglevels[0]->smoothd->reason) pc->failedreason = PC_SUBPC_ERROR;
@@ -1757,6 +1834,73 @@ PetscErrorCode PCMGSetNumberSmooth(PC pc, PetscInt n)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+  PCMGSetNumberSmoothAutotune - Sets `PCMG` to choose the number of smoothing steps (the polynomial degree) of the `KSPCHEBYSHEV`
+  smoothers on each level from their measured smoothing rate
+
+  Logically Collective
+
+  Input Parameters:
++ pc   - the multigrid context
+- maxn - the largest number of smoothing steps to consider, 0 (the default) turns the tuning off
+
+  Options Database Key:
+. -pc_mg_smooths_autotune <maxn> - Sets the largest number of smoothing steps to consider
+
+  Level: advanced
+
+  Notes:
+  When a level gets a new operator object, its pre-smoother is applied with a zero right-hand side to a noisy initial guess with
+  each degree from 1 to `maxn`. The degree that gives the largest reduction of the residual norm per unit of work is used for the
+  pre- and post-smoother of that level, where a smoothing pass of degree k counts as k + 1 operator applications to account for the
+  residual and grid transfers. Levels whose smoothers are not `KSPCHEBYSHEV` are left untouched.
+
+  The operator values may change between setups without retuning; combine with `KSPChebyshevEstEigSetRefresh()`, for example
+  `-mg_levels_ksp_chebyshev_esteig_refresh 3`, to also avoid recomputing the eigenvalue estimates from scratch in that case.
+
+.seealso: [](ch_ksp), `PCMG`, `PCMGSetNumberSmooth()`, `PCMGGetNumberSmoothAutotune()`, `KSPChebyshevEstEigSetRefresh()`
+@*/
+PetscErrorCode PCMGSetNumberSmoothAutotune(PC pc, PetscInt maxn)
+{
+  PC_MG *mg = (PC_MG *)pc->data;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(pc, PC_CLASSID, 1);
+  PetscValidLogicalCollectiveInt(pc, maxn, 2);
+  PetscCheck(maxn >= 0, PetscObjectComm((PetscObject)pc), PETSC_ERR_ARG_OUTOFRANGE, "Number of smoothing steps %" PetscInt_FMT " cannot be negative", maxn);
+  if (maxn != mg->autotunesmooth && mg->levels) {
+    for (PetscInt i = 0; i < mg->nlevels; i++) mg->levels[i]->autotuneid = 0;
+  }
+  mg->autotunesmooth = maxn;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+  PCMGGetNumberSmoothAutotune - Gets the largest number of smoothing steps considered when `PCMG` tunes the degree of `KSPCHEBYSHEV` smoothers
+
+  Not Collective
+
+  Input Parameter:
+. pc - the multigrid context
+
+  Output Parameter:
+. maxn - the largest number of smoothing steps, 0 if the tuning is off
+
+  Level: advanced
+
+.seealso: [](ch_ksp), `PCMG`, `PCMGSetNumberSmoothAutotune()`
+@*/
+PetscErrorCode PCMGGetNumberSmoothAutotune(PC pc, PetscInt *maxn)
+{
+  PC_MG *mg = (PC_MG *)pc->data;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(pc, PC_CLASSID, 1);
+  PetscAssertPointer(maxn, 2);
+  *maxn = mg->autotunesmooth;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
   PCMGSetDistinctSmoothUp - sets the up (post) smoother to be a separate `KSP` from the down (pre) smoother on all levels
   and adds the suffix _up to the options name
@@ -1895,6 +2039,7 @@ PetscErrorCode PCMGGetCoarseSpaceConstructor(const char name[], PCMGCoarseSpaceC
 .  -pc_mg_type <additive,multiplicative,full,kaskade> - multiplicative is the default
 .  -pc_mg_log                                         - log information about time spent on each level of the solver
 .  -pc_mg_distinct_smoothup                           - configure up (after interpolation) and down (before restriction) smoothers separately (with different options prefixes)
+.  -pc_mg_smooths_autotune <maxn>                     - choose the degree of `KSPCHEBYSHEV` smoothers on each level, up to maxn, from their measured smoothing rate
 .  -pc_mg_galerkin <both,pmat,mat,none>               - use Galerkin process to compute coarser operators, i.e. Acoarse = R A R'
 .  -pc_mg_multiplicative_cycles                        - number of cycles to use as the preconditioner (defaults to 1)
 .  -pc_mg_dump_matlab                                  - dumps the matrices for each level and the restriction/interpolation matrices
@@ -1918,6 +2063,11 @@ PetscErrorCode PCMGGetCoarseSpaceConstructor(const char name[], PCMGCoarseSpaceC
 
    When run with a single level the smoother options are used on that level NOT the coarse grid solver options
 
+   With the default `KSPCHEBYSHEV` smoothers the eigenvalue estimates of each level are recomputed whenever its operator changes. For
+   nonlinear or time-dependent problems where the operator changes slowly, `-mg_levels_ksp_chebyshev_esteig_refresh <its>` refreshes them
+   with a few warm-started power iterations instead, see `KSPChebyshevEstEigSetRefresh()`, and `-pc_mg_smooths_autotune` picks the degree
+   per level, see `PCMGSetNumberSmoothAutotune()`.
+
    When run with `KSPRICHARDSON` the convergence test changes slightly if monitor is turned on. The iteration count may change slightly. This
    is because without monitoring the residual norm is computed WITHIN each multigrid cycle on the finest level after the pre-smoothing
    (because the residual has just been computed for the multigrid algorithm and is hence available for free) while with monitoring the
@@ -1926,7 +2076,7 @@ PetscErrorCode PCMGGetCoarseSpaceConstructor(const char name[], PCMGCoarseSpaceC
 .seealso: [](sec_mg), `PCCreate()`, `PCSetType()`, `PCType`, `PC`, `PCMGType`, `PCEXOTIC`, `PCGAMG`, `PCML`, `PCHYPRE`
           `PCMGSetLevels()`, `PCMGGetLevels()`, `PCMGSetType()`, `PCMGSetCycleType()`,
           `PCMGSetDistinctSmoothUp()`, `PCMGGetCoarseSolve()`, `PCMGSetResidual()`, `PCMGSetInterpolation()`,
-          `PCMGSetRestriction()`, `PCMGGetSmoother()`, `PCMGGetSmootherUp()`, `PCMGGetSmootherDown()`,
+          `PCMGSetRestriction()`, `PCMGGetSmoother()`, `PCMGGetSmootherUp()`, `PCMGGetSmootherDown()`, `PCMGSetNumberSmoothAutotune()`,
           `PCMGSetCycleTypeOnLevel()`, `PCMGSetRhs()`, `PCMGSetX()`, `PCMGSetR()`,
           `PCMGSetAdaptCR()`, `PCMGGetAdaptInterpolation()`, `PCMGSetGalerkin()`, `PCMGGetAdaptCoarseSpaceType()`, `PCMGSetAdaptCoarseSpaceType()`
 M*/
@@ -1,5 +1,6 @@
 #include <../src/ksp/pc/impls/pbjacobi/pbjacobi.h>
 #include <petsc/private/matimpl.h>
+#include <petsc/private/kernels/blockinvert.h>
 
 static PetscErrorCode PCApply_PBJacobi(PC pc, Vec x, Vec y)
 {
@@ -245,21 +246,240 @@ static PetscErrorCode PCApplyTranspose_PBJacobi(PC pc, Vec x, Vec y)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/* a pivot this much smaller than an entry below it would have been swapped by partial pivoting */
+#define PC_PB_PIVOT_THRESHOLD 1.e-2
+
+PETSC_INTERN PetscErrorCode PCPBJacobiInterleavedCreate_Private(PetscInt nblocks, PetscInt bs, const PetscInt bsizes[], PC_PBJacobi_Interleaved **ib)
+{
+  const PetscInt           W = PC_PB_INTERLEAVE;
+  PC_PBJacobi_Interleaved *b;
+  PetscInt                 p = -1, row = 0;
+
+  PetscFunctionBegin;
+  PetscCall(PetscNew(&b));
+  PetscCall(PetscMalloc4(nblocks, &b->bs, nblocks, &b->nb, nblocks, &b->rstart, nblocks + 1, &b->vstart));
+  /* a pack holds consecutive blocks of the same size, a block of another size starts a new pack */
+  for (PetscInt i = 0; i < nblocks; i++) {
+    const PetscInt bsi = bsizes ? bsizes[i] : bs;
+
+    if (p < 0 || b->bs[p] != bsi || b->nb[p] == W) {
+      p++;
+      b->bs[p]     = bsi;
+      b->nb[p]     = 0;
+      b->rstart[p] = row;
+      b->vstart[p] = p ? b->vstart[p - 1] + b->bs[p - 1] * b->bs[p - 1] * W : 0;
+      b->max_bs    = PetscMax(b->max_bs, bsi);
+    }
+    b->nb[p]++;
+    row += bsi;
+  }
+  b->npacks        = p + 1;
+  b->vstart[p + 1] = p < 0 ? 0 : b->vstart[p] + b->bs[p] * b->bs[p] * W;
+  PetscCall(PetscMalloc1(b->vstart[b->npacks], &b->values));
+  PetscCall(PetscMalloc2(2 * b->max_bs * W + b->max_bs * b->max_bs * (W + 1) + b->max_bs, &b->work, b->max_bs, &b->pivots));
+  *ib = b;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PETSC_INTERN PetscErrorCode PCPBJacobiInterleavedDestroy_Private(PC_PBJacobi_Interleaved **ib)
+{
+  PetscFunctionBegin;
+  if (!*ib) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(PetscFree4((*ib)->bs, (*ib)->nb, (*ib)->rstart, (*ib)->vstart));
+  PetscCall(PetscFree((*ib)->values));
+  PetscCall(PetscFree2((*ib)->work, (*ib)->pivots));
+  PetscCall(PetscFree(*ib));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   In-place Gauss-Jordan inversion of the PC_PB_INTERLEAVE blocks of a pack, vectorized across the blocks. Pivoting
+   would make the blocks take different paths, so the blocks whose pivots are too small are only flagged here
+*/
+static PetscErrorCode PCPBJacobiInterleavedInvert_Private(PetscInt bs, MatScalar *a, PetscBool flag[])
+{
+  const PetscInt W = PC_PB_INTERLEAVE;
+  PetscScalar    pinv[PC_PB_INTERLEAVE], f[PC_PB_INTERLEAVE];
+  PetscReal      cmax[PC_PB_INTERLEAVE];
+
+  PetscFunctionBegin;
+  for (PetscInt k = 0; k < bs; k++) {
+    MatScalar *rowk = a + k * W, *colk = a + k * bs * W;
+
+    for (PetscInt l = 0; l < W; l++) cmax[l] = 0.0;
+    for (PetscInt i = k + 1; i < bs; i++) {
+      PetscPragmaSIMD
+      for (PetscInt l = 0; l < W; l++) cmax[l] = PetscMax(cmax[l], PetscAbsScalar(colk[i * W + l]));
+    }
+    PetscPragmaSIMD
+    for (PetscInt l = 0; l < W; l++) {
+      const PetscScalar piv = colk[k * W + l];
+
+      if (piv == (PetscScalar)0.0 || PetscAbsScalar(piv) < PC_PB_PIVOT_THRESHOLD * cmax[l]) flag[l] = PETSC_TRUE;
+      pinv[l]         = flag[l] ? 1.0 : 1.0 / piv;
+      colk[k * W + l] = 1.0;
+    }
+    for (PetscInt j = 0; j < bs; j++) {
+      PetscPragmaSIMD
+      for (PetscInt l = 0; l < W; l++) rowk[j * bs * W + l] *= pinv[l];
+    }
+    for (PetscInt i = 0; i < bs; i++) {
+      MatScalar *rowi = a + i * W;
+
+      if (i == k) continue;
+      PetscPragmaSIMD
+      for (PetscInt l = 0; l < W; l++) {
+        f[l]            = colk[i * W + l];
+        colk[i * W + l] = 0.0;
+      }
+      for (PetscInt j = 0; j < bs; j++) {
+        PetscPragmaSIMD
+        for (PetscInt l = 0; l < W; l++) rowi[j * bs * W + l] -= f[l] * rowk[j * bs * W + l];
+      }
+    }
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/* Gathers the point blocks of A into the packs and inverts them; A must provide MatGetRow() */
+PETSC_INTERN PetscErrorCode PCPBJacobiInterleavedSetUp_Private(PC pc, Mat A, PC_PBJacobi_Interleaved *ib)
+{
+  const PetscInt W    = PC_PB_INTERLEAVE;
+  PetscScalar   *orig = ib->work + 2 * ib->max_bs * W, *lwork = orig + ib->max_bs * ib->max_bs * W;
+  PetscInt       rstart, npivoted = 0;
+  PetscBool      allowzeropivot = PetscNot(A->erroriffailure), zeropivot = PETSC_FALSE;
+  PetscLogDouble flops          = 0.0;
+
+  PetscFunctionBegin;
+  PetscCall(MatGetOwnershipRange(A, &rstart, NULL));
+  PetscCall(PetscArrayzero(ib->values, ib->vstart[ib->npacks]));
+  for (PetscInt p = 0; p < ib->npacks; p++) {
+    const PetscInt bs = ib->bs[p], nb = ib->nb[p];
+    MatScalar     *a  = ib->values + ib->vstart[p];
+    PetscBool      flag[PC_PB_INTERLEAVE];
+
+    for (PetscInt l = 0; l < W; l++) {
+      flag[l] = PETSC_FALSE;
+      if (l >= nb) {
+        for (PetscInt i = 0; i < bs; i++) a[(i + i * bs) * W + l] = 1.0;
+        continue;
+      }
+      for (PetscInt i = 0; i < bs; i++) {
+        const PetscInt     row = rstart + ib->rstart[p] + l * bs + i, col0 = row - i;
+        PetscInt           ncols;
+        const PetscInt    *cols;
+        const PetscScalar *vals;
+
+        PetscCall(MatGetRow(A, row, &ncols, &cols, &vals));
+        for (PetscInt k = 0; k < ncols; k++) {
+          if (cols[k] >= col0 && cols[k] < col0 + bs) a[(i + (cols[k] - col0) * bs) * W + l] = vals[k];
+        }
+        PetscCall(MatRestoreRow(A, row, &ncols, &cols, &vals));
+      }
+    }
+    PetscCall(PetscArraycpy(orig, a, bs * bs * W));
+    PetscCall(PCPBJacobiInterleavedInvert_Private(bs, a, flag));
+    /* redo the flagged blocks one at a time with partial pivoting */
+    for (PetscInt l = 0; l < nb; l++) {
+      PetscBool zp = PETSC_FALSE;
+
+      if (!flag[l]) continue;
+      for (PetscInt i = 0; i < bs * bs; i++) lwork[i] = orig[i * W + l];
+      PetscCall(PetscKernel_A_gets_inverse_A(bs, lwork, ib->pivots, lwork + bs * bs, allowzeropivot, &zp));
+      for (PetscInt i = 0; i < bs * bs; i++) a[i * W + l] = lwork[i];
+      if (zp) zeropivot = PETSC_TRUE;
+      npivoted++;
+    }
+    flops += 2.0 * bs * bs * bs * nb;
+  }
+  if (npivoted) PetscCall(PetscInfo(pc, "Inverted %" PetscInt_FMT " blocks with small pivots using partial pivoting\n", npivoted));
+  if (zeropivot) pc->failedreason = PC_FACTOR_NUMERIC_ZEROPIVOT;
+  PetscCall(PetscLogFlops(flops));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PETSC_INTERN PetscErrorCode PCPBJacobiInterleavedApply_Private(PC_PBJacobi_Interleaved *ib, Vec x, Vec y, PetscBool transpose)
+{
+  const PetscInt     W  = PC_PB_INTERLEAVE;
+  PetscScalar       *xt = ib->work, *yt = ib->work + ib->max_bs * W, *yy;
+  const PetscScalar *xx;
+  PetscLogDouble     flops = 0.0;
+
+  PetscFunctionBegin;
+  PetscCall(VecGetArrayRead(x, &xx));
+  PetscCall(VecGetArrayWrite(y, &yy));
+  for (PetscInt p = 0; p < ib->npacks; p++) {
+    const PetscInt     bs = ib->bs[p], nb = ib->nb[p];
+    const MatScalar   *a  = ib->values + ib->vstart[p];
+    const PetscScalar *xb = xx + ib->rstart[p];
+    PetscScalar       *yb = yy + ib->rstart[p];
+
+    for (PetscInt j = 0; j < bs; j++) {
+      for (PetscInt l = 0; l < W; l++) xt[j * W + l] = l < nb ? xb[l * bs + j] : 0.0;
+    }
+    PetscCall(PetscArrayzero(yt, bs * W));
+    for (PetscInt i = 0; i < bs; i++) {
+      for (PetscInt j = 0; j < bs; j++) {
+        const MatScalar *aij = a + (transpose ? j + i * bs : i + j * bs) * W;
+
+        PetscPragmaSIMD
+        for (PetscInt l = 0; l < W; l++) yt[i * W + l] += aij[l] * xt[j * W + l];
+      }
+    }
+    for (PetscInt l = 0; l < nb; l++) {
+      for (PetscInt i = 0; i < bs; i++) yb[l * bs + i] = yt[i * W + l];
+    }
+    flops += (2.0 * bs * bs - bs) * nb;
+  }
+  PetscCall(VecRestoreArrayRead(x, &xx));
+  PetscCall(VecRestoreArrayWrite(y, &yy));
+  PetscCall(PetscLogFlops(flops));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PCApply_PBJacobi_Interleaved(PC pc, Vec x, Vec y)
+{
+  PC_PBJacobi *jac = (PC_PBJacobi *)pc->data;
+
+  PetscFunctionBegin;
+  PetscCall(PCPBJacobiInterleavedApply_Private(jac->ib, x, y, PETSC_FALSE));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PCApplyTranspose_PBJacobi_Interleaved(PC pc, Vec x, Vec y)
+{
+  PC_PBJacobi *jac = (PC_PBJacobi *)pc->data;
+
+  PetscFunctionBegin;
+  PetscCall(PCPBJacobiInterleavedApply_Private(jac->ib, x, y, PETSC_TRUE));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 PETSC_INTERN PetscErrorCode PCSetUp_PBJacobi_Host(PC pc, Mat diagPB)
 {
   PC_PBJacobi   *jac = (PC_PBJacobi *)pc->data;
   Mat            A   = diagPB ? diagPB : pc->pmat;
   MatFactorError err;
   PetscInt       nlocal;
+  PetscBool      hasrow;
 
   PetscFunctionBegin;
-  PetscCall(MatInvertBlockDiagonal(A, &jac->diag));
-  PetscCall(MatFactorGetError(A, &err));
-  if (err) pc->failedreason = (PCFailedReason)err;
-
   PetscCall(MatGetBlockSize(A, &jac->bs));
   PetscCall(MatGetLocalSize(A, &nlocal, NULL));
   jac->mbs = nlocal / jac->bs;
+
+  PetscCall(MatHasOperation(A, MATOP_GET_ROW, &hasrow));
+  if (jac->interleave && !hasrow) PetscCall(PetscInfo(pc, "Matrix type %s does not provide MatGetRow(), not interleaving the blocks\n", ((PetscObject)A)->type_name));
+  if (jac->interleave && hasrow) {
+    if (!jac->ib) PetscCall(PCPBJacobiInterleavedCreate_Private(jac->mbs, jac->bs, NULL, &jac->ib));
+    PetscCall(PCPBJacobiInterleavedSetUp_Private(pc, A, jac->ib));
+    pc->ops->apply          = PCApply_PBJacobi_Interleaved;
+    pc->ops->applytranspose = PCApplyTranspose_PBJacobi_Interleaved;
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  PetscCall(MatInvertBlockDiagonal(A, &jac->diag));
+  PetscCall(MatFactorGetError(A, &err));
+  if (err) pc->failedreason = (PCFailedReason)err;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -303,6 +523,17 @@ static PetscErrorCode PCSetUp_PBJacobi(PC pc)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode PCReset_PBJacobi(PC pc)
+{
+  PC_PBJacobi *jac = (PC_PBJacobi *)pc->data;
+
+  PetscFunctionBegin;
+  PetscCall(PCPBJacobiInterleavedDestroy_Private(&jac->ib));
+  pc->ops->apply          = PCApply_PBJacobi;
+  pc->ops->applytranspose = PCApplyTranspose_PBJacobi;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 PetscErrorCode PCDestroy_PBJacobi(PC pc)
 {
   PC_PBJacobi *jac = (PC_PBJacobi *)pc->data;
@@ -313,6 +544,7 @@ PetscErrorCode PCDestroy_PBJacobi(PC pc)
   */
   // PetscCall(PetscFree(jac->diag)); // the memory is owned by e.g., a->ibdiag in Mat_SeqAIJ, so don't free it here.
   PetscCall(MatDestroy(&jac->diagPB));
+  PetscCall(PCReset_PBJacobi(pc));
   PetscCall(PetscFree(pc->data));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -324,13 +556,30 @@ static PetscErrorCode PCView_PBJacobi(PC pc, PetscViewer viewer)
 
   PetscFunctionBegin;
   PetscCall(PetscObjectTypeCompare((PetscObject)viewer, PETSCVIEWERASCII, &iascii));
-  if (iascii) PetscCall(PetscViewerASCIIPrintf(viewer, "  point-block size %" PetscInt_FMT "\n", jac->bs));
+  if (iascii) {
+    PetscCall(PetscViewerASCIIPrintf(viewer, "  point-block size %" PetscInt_FMT "\n", jac->bs));
+    if (jac->ib) PetscCall(PetscViewerASCIIPrintf(viewer, "  blocks inverted and applied in interleaved packs of %d\n", PC_PB_INTERLEAVE));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PCSetFromOptions_PBJacobi(PC pc, PetscOptionItems PetscOptionsObject)
+{
+  PC_PBJacobi *jac = (PC_PBJacobi *)pc->data;
+
+  PetscFunctionBegin;
+  PetscOptionsHeadBegin(PetscOptionsObject, "Point block Jacobi options");
+  PetscCall(PetscOptionsBool("-pc_pbjacobi_interleave", "Invert and apply the blocks in interleaved packs", "PCPBJACOBI", jac->interleave, &jac->interleave, NULL));
+  PetscOptionsHeadEnd();
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
 /*MC
      PCPBJACOBI - Point block Jacobi preconditioner
 
+   Options Database Key:
+.  -pc_pbjacobi_interleave <bool> - invert and apply the blocks in packs of 8 with the same entry of the blocks stored contiguously
+
    Notes:
     See `PCJACOBI` for diagonal Jacobi, `PCVPBJACOBI` for variable-size point block, and `PCBJACOBI` for large size blocks
 
@@ -339,6 +588,10 @@ static PetscErrorCode PCView_PBJacobi(PC pc, PetscViewer viewer)
    Uses dense LU factorization with partial pivoting to invert the blocks; if a zero pivot
    is detected a PETSc error is generated.
 
+   With `-pc_pbjacobi_interleave` the blocks are inverted without pivoting by Gauss-Jordan elimination vectorized across
+   the blocks of a pack, and applied vectorized the same way. This pays off for many small blocks, say of size 3 to 10. The
+   blocks with a small pivot are inverted again with partial pivoting. This requires a matrix that provides `MatGetRow()`.
+
    Developer Notes:
      This should support the `PCSetErrorIfFailure()` flag set to `PETSC_TRUE` to allow
      the factorization to continue even after a zero pivot is found resulting in a Nan and hence
@@ -381,8 +634,9 @@ PETSC_EXTERN PetscErrorCode PCCreate_PBJacobi(PC pc)
   pc->ops->apply               = PCApply_PBJacobi;
   pc->ops->applytranspose      = PCApplyTranspose_PBJacobi;
   pc->ops->setup               = PCSetUp_PBJacobi;
+  pc->ops->reset               = PCReset_PBJacobi;
   pc->ops->destroy             = PCDestroy_PBJacobi;
-  pc->ops->setfromoptions      = NULL;
+  pc->ops->setfromoptions      = PCSetFromOptions_PBJacobi;
   pc->ops->view                = PCView_PBJacobi;
   pc->ops->applyrichardson     = NULL;
   pc->ops->applysymmetricleft  = NULL;
@@ -2,14 +2,41 @@
 
 #include <petsc/private/pcimpl.h>
 
+/* number of blocks whose entries are interleaved, a multiple of the SIMD width of PetscScalar on current hardware */
+#define PC_PB_INTERLEAVE 8
+
+/*
+   Inverses of point blocks stored in packs of PC_PB_INTERLEAVE blocks of equal size, used by PBJacobi and VPBJacobi.
+   Entry (i, j) of the l-th block of a pack is at (i + j * bs) * PC_PB_INTERLEAVE + l, so the same entry of all the blocks
+   of a pack is contiguous and both the inversion and the application vectorize across blocks.
+*/
+typedef struct {
+  PetscInt     npacks;
+  PetscInt     max_bs;
+  PetscInt    *bs;     /* block size of each pack */
+  PetscInt    *nb;     /* number of blocks in each pack, the remaining lanes hold identity blocks */
+  PetscInt    *rstart; /* first local row of each pack */
+  PetscInt    *vstart; /* start of each pack in values[] */
+  MatScalar   *values;
+  PetscScalar *work;   /* interleaved x and y of one pack, and the pivot workspace */
+  PetscInt    *pivots;
+} PC_PBJacobi_Interleaved;
+
+PETSC_INTERN PetscErrorCode PCPBJacobiInterleavedCreate_Private(PetscInt, PetscInt, const PetscInt[], PC_PBJacobi_Interleaved **);
+PETSC_INTERN PetscErrorCode PCPBJacobiInterleavedSetUp_Private(PC, Mat, PC_PBJacobi_Interleaved *);
+PETSC_INTERN PetscErrorCode PCPBJacobiInterleavedApply_Private(PC_PBJacobi_Interleaved *, Vec, Vec, PetscBool);
+PETSC_INTERN PetscErrorCode PCPBJacobiInterleavedDestroy_Private(PC_PBJacobi_Interleaved **);
+
 /*
    Private context (data structure) for the PBJacobi preconditioner.
 */
 typedef struct {
-  const MatScalar *diag;
-  PetscInt         bs, mbs; /* block size (bs), and number of blocks (mbs) */
-  Mat              diagPB;  /* the matrix made of the diagonal blocks if some shell smatrix provided it; otherwise, NULL. Need to destroy it after use */
-  void            *spptr;   /* opaque pointer to a device data structure */
+  const MatScalar         *diag;
+  PetscInt                 bs, mbs;    /* block size (bs), and number of blocks (mbs) */
+  Mat                      diagPB;     /* the matrix made of the diagonal blocks if some shell smatrix provided it; otherwise, NULL. Need to destroy it after use */
+  void                    *spptr;      /* opaque pointer to a device data structure */
+  PetscBool                interleave; /* invert and apply the blocks in interleaved packs on the host */
+  PC_PBJacobi_Interleaved *ib;
 } PC_PBJacobi;
 
 #if defined(PETSC_HAVE_CUDA)
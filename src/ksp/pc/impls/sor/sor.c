@@ -420,6 +420,14 @@ PetscErrorCode PCSORSetIterations(PC pc, PetscInt its, PetscInt lits)
 
           If omega != 1, you will need to set the `MAT_USE_INODES` option to `PETSC_FALSE` on the matrix.
 
+          For `MATAIJ` matrices the option `-mat_sor_multicolor` makes the sweeps on each process visit the rows color by color, using
+          a distance one coloring of the graph of the (symmetrized) matrix computed with `MatColoring` when the nonzero structure changes.
+          Rows of one color do not couple, so their updates are independent and are split across OpenMP threads. This is Gauss-Seidel
+          in a different ordering, so the iterates differ from the natural ordering, but they do not depend on the number of threads.
+          As a smoother for multigrid or as a preconditioner for elliptic problems the convergence is usually similar to the natural
+          ordering (red-black Gauss-Seidel for the 5-point Laplacian, for example); as a standalone solver with an optimal omega > 1 it is
+          typically slower. `SOR_EISENSTAT` and `SOR_APPLY_UPPER` always use the natural ordering.
+
 .seealso: [](ch_ksp), `PCCreate()`, `PCSetType()`, `PCType`, `PC`, `PCJACOBI`,
           `PCSORSetIterations()`, `PCSORSetSymmetric()`, `PCSORSetOmega()`, `PCEISENSTAT`, `MatSetOption()`
 M*/
@@ -205,6 +205,24 @@ static PetscErrorCode PCApplyTranspose_VPBJacobi(PC pc, Vec x, Vec y)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode PCApply_VPBJacobi_Interleaved(PC pc, Vec x, Vec y)
+{
+  PC_VPBJacobi *jac = (PC_VPBJacobi *)pc->data;
+
+  PetscFunctionBegin;
+  PetscCall(PCPBJacobiInterleavedApply_Private(jac->ib, x, y, PETSC_FALSE));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PCApplyTranspose_VPBJacobi_Interleaved(PC pc, Vec x, Vec y)
+{
+  PC_VPBJacobi *jac = (PC_VPBJacobi *)pc->data;
+
+  PetscFunctionBegin;
+  PetscCall(PCPBJacobiInterleavedApply_Private(jac->ib, x, y, PETSC_TRUE));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 PETSC_INTERN PetscErrorCode PCSetUp_VPBJacobi_Host(PC pc, Mat diagVPB)
 {
   PC_VPBJacobi   *jac = (PC_VPBJacobi *)pc->data;
@@ -213,11 +231,30 @@ PETSC_INTERN PetscErrorCode PCSetUp_VPBJacobi_Host(PC pc, Mat diagVPB)
   PetscInt        i, nsize = 0, nlocal;
   PetscInt        nblocks;
   const PetscInt *bsizes;
+  PetscBool       hasrow;
 
   PetscFunctionBegin;
   PetscCall(MatGetVariableBlockSizes(pc->pmat, &nblocks, &bsizes));
   PetscCall(MatGetLocalSize(pc->pmat, &nlocal, NULL));
   PetscCheck(!nlocal || nblocks, PETSC_COMM_SELF, PETSC_ERR_ARG_WRONGSTATE, "Must call MatSetVariableBlockSizes() before using PCVPBJACOBI");
+  PetscCall(MatHasOperation(A, MATOP_GET_ROW, &hasrow));
+  if (jac->interleave && !hasrow) PetscCall(PetscInfo(pc, "Matrix type %s does not provide MatGetRow(), not interleaving the blocks\n", ((PetscObject)A)->type_name));
+  if (jac->interleave && hasrow) {
+    if (!jac->ib) {
+      PetscCall(PCPBJacobiInterleavedCreate_Private(nblocks, 0, bsizes, &jac->ib));
+      jac->nblocks = nblocks;
+      jac->min_bs  = PETSC_INT_MAX;
+      jac->max_bs  = -1;
+      for (i = 0; i < nblocks; i++) {
+        jac->min_bs = PetscMin(jac->min_bs, bsizes[i]);
+        jac->max_bs = PetscMax(jac->max_bs, bsizes[i]);
+      }
+    }
+    PetscCall(PCPBJacobiInterleavedSetUp_Private(pc, A, jac->ib));
+    pc->ops->apply          = PCApply_VPBJacobi_Interleaved;
+    pc->ops->applytranspose = PCApplyTranspose_VPBJacobi_Interleaved;
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   if (!jac->diag) {
     PetscInt max_bs = -1, min_bs = PETSC_INT_MAX;
     for (i = 0; i < nblocks; i++) {
@@ -288,10 +325,33 @@ static PetscErrorCode PCView_VPBJacobi(PC pc, PetscViewer viewer)
   if (iascii) {
     PetscCall(PetscViewerASCIIPrintf(viewer, "  number of blocks: %" PetscInt_FMT "\n", jac->nblocks));
     PetscCall(PetscViewerASCIIPrintf(viewer, "  block sizes: min=%" PetscInt_FMT " max=%" PetscInt_FMT "\n", jac->min_bs, jac->max_bs));
+    if (jac->ib) PetscCall(PetscViewerASCIIPrintf(viewer, "  blocks inverted and applied in interleaved packs of %d\n", PC_PB_INTERLEAVE));
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode PCSetFromOptions_VPBJacobi(PC pc, PetscOptionItems PetscOptionsObject)
+{
+  PC_VPBJacobi *jac = (PC_VPBJacobi *)pc->data;
+
+  PetscFunctionBegin;
+  PetscOptionsHeadBegin(PetscOptionsObject, "Variable point block Jacobi options");
+  PetscCall(PetscOptionsBool("-pc_vpbjacobi_interleave", "Invert and apply the blocks in interleaved packs of blocks of equal size", "PCVPBJACOBI", jac->interleave, &jac->interleave, NULL));
+  PetscOptionsHeadEnd();
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PCReset_VPBJacobi(PC pc)
+{
+  PC_VPBJacobi *jac = (PC_VPBJacobi *)pc->data;
+
+  PetscFunctionBegin;
+  PetscCall(PCPBJacobiInterleavedDestroy_Private(&jac->ib));
+  pc->ops->apply          = PCApply_VPBJacobi;
+  pc->ops->applytranspose = PCApplyTranspose_VPBJacobi;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 PETSC_INTERN PetscErrorCode PCDestroy_VPBJacobi(PC pc)
 {
   PC_VPBJacobi *jac = (PC_VPBJacobi *)pc->data;
@@ -302,6 +362,7 @@ PETSC_INTERN PetscErrorCode PCDestroy_VPBJacobi(PC pc)
   */
   PetscCall(PetscFree(jac->diag));
   PetscCall(MatDestroy(&jac->diagVPB));
+  PetscCall(PCReset_VPBJacobi(pc));
   PetscCall(PetscFree(pc->data));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -309,6 +370,9 @@ PETSC_INTERN PetscErrorCode PCDestroy_VPBJacobi(PC pc)
 /*MC
      PCVPBJACOBI - Variable size point block Jacobi preconditioner
 
+   Options Database Key:
+.  -pc_vpbjacobi_interleave <bool> - invert and apply consecutive blocks of equal size in packs of 8 with the same entry of the blocks stored contiguously
+
    Level: beginner
 
    Notes:
@@ -321,6 +385,10 @@ PETSC_INTERN PetscErrorCode PCDestroy_VPBJacobi(PC pc)
 
      One must call `MatSetVariableBlockSizes()` to use this preconditioner
 
+     With `-pc_vpbjacobi_interleave` consecutive blocks of equal size are inverted without pivoting by Gauss-Jordan
+     elimination vectorized across the blocks of a pack, and applied vectorized the same way, see `PCPBJACOBI`.
+     The blocks with a small pivot are inverted again with partial pivoting.
+
    Developer Notes:
      This should support the `PCSetErrorIfFailure()` flag set to `PETSC_TRUE` to allow
      the factorization to continue even after a zero pivot is found resulting in a Nan and hence
@@ -362,7 +430,8 @@ PETSC_EXTERN PetscErrorCode PCCreate_VPBJacobi(PC pc)
   pc->ops->applytranspose      = NULL;
   pc->ops->setup               = PCSetUp_VPBJacobi;
   pc->ops->destroy             = PCDestroy_VPBJacobi;
-  pc->ops->setfromoptions      = NULL;
+  pc->ops->reset               = PCReset_VPBJacobi;
+  pc->ops->setfromoptions      = PCSetFromOptions_VPBJacobi;
   pc->ops->view                = PCView_VPBJacobi;
   pc->ops->applyrichardson     = NULL;
   pc->ops->applysymmetricleft  = NULL;
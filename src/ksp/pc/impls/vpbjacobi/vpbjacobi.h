@@ -1,15 +1,18 @@
 #pragma once
 
 #include <petsc/private/pcimpl.h>
+#include <../src/ksp/pc/impls/pbjacobi/pbjacobi.h>
 
 /*
    Private context (data structure) for the VPBJacobi preconditioner.
 */
 typedef struct {
-  PetscInt   nblocks, min_bs, max_bs; // Stats recorded during setup for viewing
-  MatScalar *diag;                    /* on host */
-  Mat        diagVPB;                 /* the matrix made of the diagonal blocks if some shell matrix provided it; otherwise, NULL. Need to destroy it after use */
-  void      *spptr;                   /* offload to devices */
+  PetscInt                 nblocks, min_bs, max_bs; // Stats recorded during setup for viewing
+  MatScalar               *diag;                    /* on host */
+  Mat                      diagVPB;                 /* the matrix made of the diagonal blocks if some shell matrix provided it; otherwise, NULL. Need to destroy it after use */
+  void                    *spptr;                   /* offload to devices */
+  PetscBool                interleave;              /* invert and apply the blocks in interleaved packs on the host */
+  PC_PBJacobi_Interleaved *ib;
 } PC_VPBJacobi;
 
 #if defined(PETSC_HAVE_CUDA)
@@ -248,6 +248,13 @@ PetscErrorCode MatFDColoringApply_AIJ(Mat J, MatFDColoring coloring, Vec x1, voi
     PetscInt     i, m = J->rmap->n, nbcols, bcols = coloring->bcols;
     PetscScalar *dy = coloring->dy, *dy_k;
 
+    if (coloring->fbatch && coloring->nbatch != bcols) { /* one perturbed point per color of a block */
+      PetscCall(VecDestroyVecs(coloring->nbatch, &coloring->xbatch));
+      PetscCall(VecDestroyVecs(coloring->nbatch, &coloring->ybatch));
+      PetscCall(VecDuplicateVecs(x1, bcols, &coloring->xbatch));
+      PetscCall(VecDuplicateVecs(w2, bcols, &coloring->ybatch));
+      coloring->nbatch = bcols;
+    }
     nbcols = 0;
     for (k = 0; k < ncolors; k += bcols) {
       /*
@@ -259,6 +266,7 @@ PetscErrorCode MatFDColoringApply_AIJ(Mat J, MatFDColoring coloring, Vec x1, voi
       if (k + bcols > ncolors) bcols = ncolors - k;
       for (i = 0; i < bcols; i++) {
         coloring->currentcolor = k + i;
+        if (coloring->fbatch) w3 = coloring->xbatch[i];
 
         PetscCall(VecCopy(x1, w3));
         PetscCall(VecGetArray(w3, &w3_array));
@@ -278,6 +286,7 @@ PetscErrorCode MatFDColoringApply_AIJ(Mat J, MatFDColoring coloring, Vec x1, voi
         }
         if (ctype == IS_COLORING_GLOBAL) w3_array += cstart;
         PetscCall(VecRestoreArray(w3, &w3_array));
+        if (coloring->fbatch) continue;
 
         /*
          (3-2) Evaluate function at w3 = x1 + dx (here dx is a vector of perturbations)
@@ -291,6 +300,17 @@ PetscErrorCode MatFDColoringApply_AIJ(Mat J, MatFDColoring coloring, Vec x1, voi
         PetscCall(VecResetArray(w2));
         dy_k += m; /* points to dy+i*nxloc */
       }
+      if (coloring->fbatch) { /* (3-2) for all the colors of the block with a single call */
+        coloring->currentcolor = -1;
+        for (i = 0; i < bcols; i++) PetscCall(VecPlaceArray(coloring->ybatch[i], dy + i * m));
+        PetscCall(PetscLogEventBegin(MAT_FDColoringFunction, 0, 0, 0, 0));
+        PetscCall((*coloring->fbatch)(sctx, bcols, coloring->xbatch, coloring->ybatch, coloring->fbatchctx));
+        PetscCall(PetscLogEventEnd(MAT_FDColoringFunction, 0, 0, 0, 0));
+        for (i = 0; i < bcols; i++) {
+          PetscCall(VecAXPY(coloring->ybatch[i], -1.0, w1));
+          PetscCall(VecResetArray(coloring->ybatch[i]));
+        }
+      }
 
       /*
        (3-3) Loop over block rows of vector, putting results into Jacobian matrix
@@ -526,6 +526,33 @@ static PetscErrorCode MatSetValuesRow_MPIAIJ(Mat A, PetscInt row, const PetscSca
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+#if !defined(PETSC_HAVE_MPIUNI)
+/*
+   Progressive assembly with -matstash_progressive <n>: sends the stash once it holds n entries and adds the entries the other
+   ranks have sent so far, see MatStashProgressSend_Private(). Probing for messages is not free, so unless something was just
+   sent it is only done every few calls.
+*/
+static PetscErrorCode MatSetValuesProgress_MPIAIJ(Mat mat)
+{
+  MatStash    *stash = &mat->stash;
+  PetscInt    *row, *col, flg;
+  PetscScalar *val;
+
+  PetscFunctionBegin;
+  if (mat->insertmode == ADD_VALUES && !mat->assembly_subset && stash->n >= stash->progress_size) PetscCall(MatStashProgressSend_Private(stash, mat->rmap->range));
+  else if (++stash->progress_calls < 16) PetscFunctionReturn(PETSC_SUCCESS);
+  stash->progress_calls = 0;
+  stash->progress_busy  = PETSC_TRUE; /* MatSetValues_MPIAIJ() below must not recurse */
+  while (1) {
+    PetscCall(MatStashProgressGetMesg_Private(stash, PETSC_FALSE, &row, &col, &val, &flg));
+    if (!flg) break;
+    PetscCall(MatSetValues_MPIAIJ(mat, 1, row, 1, col, val, ADD_VALUES));
+  }
+  stash->progress_busy = PETSC_FALSE;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+#endif
+
 PetscErrorCode MatSetValues_MPIAIJ(Mat mat, PetscInt m, const PetscInt im[], PetscInt n, const PetscInt in[], const PetscScalar v[], InsertMode addv)
 {
   Mat_MPIAIJ *aij   = (Mat_MPIAIJ *)mat->data;
@@ -632,6 +659,9 @@ PetscErrorCode MatSetValues_MPIAIJ(Mat mat, PetscInt m, const PetscInt im[], Pet
   }
   PetscCall(MatSeqAIJRestoreArray(A, &aa)); /* aa, bb might have been free'd due to reallocation above. But we don't access them here */
   PetscCall(MatSeqAIJRestoreArray(B, &ba));
+#if !defined(PETSC_HAVE_MPIUNI)
+  if (mat->stash.progress_size > 0 && !mat->stash.progress_busy && !aij->donotstash && !mat->nooffprocentries) PetscCall(MatSetValuesProgress_MPIAIJ(mat));
+#endif
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -765,6 +795,9 @@ static PetscErrorCode MatAssemblyBegin_MPIAIJ(Mat mat, MatAssemblyType mode)
   PetscFunctionBegin;
   if (aij->donotstash || mat->nooffprocentries) PetscFunctionReturn(PETSC_SUCCESS);
 
+#if !defined(PETSC_HAVE_MPIUNI)
+  if (mat->stash.progress_size > 0) PetscCall(MatStashProgressCount_Private(&mat->stash));
+#endif
   PetscCall(MatStashScatterBegin_Private(mat, &mat->stash, mat->rmap->range));
   PetscCall(MatStashGetInfo_Private(&mat->stash, &nstash, &reallocs));
   PetscCall(PetscInfo(aij->A, "Stash has %" PetscInt_FMT " entries, uses %" PetscInt_FMT " mallocs.\n", nstash, reallocs));
@@ -784,6 +817,13 @@ PetscErrorCode MatAssemblyEnd_MPIAIJ(Mat mat, MatAssemblyType mode)
 
   PetscFunctionBegin;
   if (!aij->donotstash && !mat->nooffprocentries) {
+#if !defined(PETSC_HAVE_MPIUNI)
+    while (mat->stash.progress_size > 0) { /* Progressive messages not yet added by MatSetValuesProgress_MPIAIJ() */
+      PetscCall(MatStashProgressGetMesg_Private(&mat->stash, PETSC_TRUE, &row, &col, &val, &flg));
+      if (!flg) break;
+      PetscCall(MatSetValues_MPIAIJ(mat, 1, row, 1, col, val, ADD_VALUES));
+    }
+#endif
     while (1) {
       PetscCall(MatStashScatterGetMesg_Private(&mat->stash, &n, &row, &col, &val, &flg));
       if (!flg) break;
@@ -4377,6 +4417,7 @@ PetscErrorCode MatUpdateMPIAIJWithArray(Mat mat, const PetscScalar v[])
   Options Database Keys:
 + -mat_no_inode                     - Do not use inodes
 . -mat_inode_limit <limit>          - Sets inode limit (max limit=5)
+. -mat_sor_multicolor               - Sweep over a multicolor ordering of the rows of the diagonal block in `MatSOR()`, see `PCSOR`
 - -matmult_vecscatter_view <viewer> - View the vecscatter (i.e., communication pattern) used in `MatMult()` of sparse parallel matrices.
                                       See viewer types in manual of `MatView()`. Of them, ascii_matlab, draw or binary cause the `VecScatter`
                                       to be viewed as a matrix. Entry (i,j) is the size of message (in bytes) rank i sends to rank j in one `MatMult()` call.
@@ -6774,7 +6815,9 @@ static PetscErrorCode MatSetValuesCOO_MPIAIJ(Mat mat, const PetscScalar v[], Ins
    MATMPIAIJ - MATMPIAIJ = "mpiaij" - A matrix type to be used for parallel sparse matrices.
 
    Options Database Keys:
-. -mat_type mpiaij - sets the matrix type to `MATMPIAIJ` during a call to `MatSetFromOptions()`
++ -mat_type mpiaij           - sets the matrix type to `MATMPIAIJ` during a call to `MatSetFromOptions()`
+- -matstash_progressive <n> - with `ADD_VALUES`, `MatSetValues()` sends the values destined to other MPI processes each time `n` of them are
+                              stashed, and adds those received so far, instead of leaving all this communication to `MatAssemblyBegin()` and `MatAssemblyEnd()`
 
    Level: beginner
 
@@ -1225,6 +1225,7 @@ static PetscErrorCode MatReset_SeqAIJ(Mat A)
   PetscCall(PetscFree(a->ilen));
   PetscCall(PetscFree(a->ipre));
   PetscCall(PetscFree3(a->idiag, a->mdiag, a->ssor_work));
+  PetscCall(PetscFree2(a->sor_colorptr, a->sor_colorrows));
   PetscCall(PetscFree(a->solve_work));
   PetscCall(ISDestroy(&a->icol));
   PetscCall(PetscFree(a->saved_values));
@@ -1920,6 +1921,109 @@ static PetscErrorCode MatInvertDiagonal_SeqAIJ(Mat A, PetscScalar omega, PetscSc
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/* Groups the rows by the colors of a distance one coloring of the graph of A + A^T */
+static PetscErrorCode MatSORMulticolorSetUp_SeqAIJ(Mat A)
+{
+  Mat_SeqAIJ *a = (Mat_SeqAIJ *)A->data;
+  Mat         G = A;
+  MatColoring mc;
+  ISColoring  iscoloring;
+  IS         *isc;
+  PetscInt    nc;
+
+  PetscFunctionBegin;
+  if (a->sor_colorptr && a->sor_nonzerostate == A->nonzerostate) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(PetscFree2(a->sor_colorptr, a->sor_colorrows));
+  if (A->structurally_symmetric != PETSC_BOOL3_TRUE) {
+    Mat At;
+
+    PetscCall(MatTranspose(A, MAT_INITIAL_MATRIX, &At));
+    PetscCall(MatDuplicate(A, MAT_COPY_VALUES, &G));
+    PetscCall(MatAXPY(G, 1.0, At, DIFFERENT_NONZERO_PATTERN));
+    PetscCall(MatDestroy(&At));
+  }
+  PetscCall(MatColoringCreate(G, &mc));
+  PetscCall(MatColoringSetDistance(mc, 1));
+  PetscCall(MatColoringSetType(mc, MATCOLORINGGREEDY));
+  PetscCall(MatColoringApply(mc, &iscoloring));
+  PetscCall(MatColoringDestroy(&mc));
+  if (G != A) PetscCall(MatDestroy(&G));
+
+  PetscCall(ISColoringGetIS(iscoloring, PETSC_USE_POINTER, &nc, &isc));
+  PetscCall(PetscMalloc2(nc + 1, &a->sor_colorptr, A->rmap->n, &a->sor_colorrows));
+  a->sor_colorptr[0] = 0;
+  for (PetscInt c = 0; c < nc; c++) {
+    const PetscInt *rows;
+    PetscInt        n;
+
+    PetscCall(ISGetLocalSize(isc[c], &n));
+    PetscCall(ISGetIndices(isc[c], &rows));
+    PetscCall(PetscArraycpy(a->sor_colorrows + a->sor_colorptr[c], rows, n));
+    PetscCall(ISRestoreIndices(isc[c], &rows));
+    a->sor_colorptr[c + 1] = a->sor_colorptr[c] + n;
+  }
+  PetscCall(ISColoringRestoreIS(iscoloring, PETSC_USE_POINTER, &isc));
+  PetscCall(ISColoringDestroy(&iscoloring));
+  a->sor_ncolors      = nc;
+  a->sor_nonzerostate = A->nonzerostate;
+  PetscCall(PetscInfo(A, "Using %" PetscInt_FMT " colors for multicolor SOR\n", nc));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/* The rows of one color are not coupled to each other, so they are updated in parallel */
+static inline void MatSORMulticolorSweepColor_Private(const PetscInt ai[], const PetscInt aj[], const MatScalar aa[], const PetscScalar mdiag[], const PetscScalar idiag[], const PetscScalar b[], PetscReal omega, PetscInt n, const PetscInt rows[], PetscScalar x[])
+{
+  PetscPragmaOMP(parallel for schedule(static))
+  for (PetscInt r = 0; r < n; r++) {
+    const PetscInt   i   = rows[r];
+    const PetscInt   nz  = ai[i + 1] - ai[i];
+    const PetscInt  *idx = aj + ai[i];
+    const MatScalar *v   = aa + ai[i];
+    PetscScalar      sum = b[i];
+
+    PetscSparseDenseMinusDot(sum, x, v, idx, nz);
+    x[i] = (1. - omega) * x[i] + (sum + mdiag[i] * x[i]) * idiag[i]; /* omega in idiag */
+  }
+}
+
+static PetscErrorCode MatSORMulticolor_SeqAIJ(Mat A, Vec bb, PetscReal omega, MatSORType flag, PetscReal fshift, PetscInt its, PetscInt lits, Vec xx)
+{
+  Mat_SeqAIJ        *a = (Mat_SeqAIJ *)A->data;
+  const PetscInt    *ptr, *rows;
+  const MatScalar   *aa;
+  const PetscScalar *b;
+  PetscScalar       *x;
+
+  PetscFunctionBegin;
+  PetscCall(MatSORMulticolorSetUp_SeqAIJ(A));
+  if (fshift != a->fshift || omega != a->omega) a->idiagvalid = PETSC_FALSE; /* must recompute idiag[] */
+  if (!a->idiagvalid) PetscCall(MatInvertDiagonal_SeqAIJ(A, omega, fshift));
+  a->fshift = fshift;
+  a->omega  = omega;
+  ptr       = a->sor_colorptr;
+  rows      = a->sor_colorrows;
+
+  if (flag & SOR_ZERO_INITIAL_GUESS) PetscCall(VecSet(xx, 0.0));
+  its = its * lits;
+  PetscCall(MatSeqAIJGetArrayRead(A, &aa));
+  PetscCall(VecGetArray(xx, &x));
+  PetscCall(VecGetArrayRead(bb, &b));
+  while (its--) {
+    if (flag & SOR_FORWARD_SWEEP || flag & SOR_LOCAL_FORWARD_SWEEP) {
+      for (PetscInt c = 0; c < a->sor_ncolors; c++) MatSORMulticolorSweepColor_Private(a->i, a->j, aa, a->mdiag, a->idiag, b, omega, ptr[c + 1] - ptr[c], rows + ptr[c], x);
+      PetscCall(PetscLogFlops(2.0 * a->nz));
+    }
+    if (flag & SOR_BACKWARD_SWEEP || flag & SOR_LOCAL_BACKWARD_SWEEP) {
+      for (PetscInt c = a->sor_ncolors - 1; c >= 0; c--) MatSORMulticolorSweepColor_Private(a->i, a->j, aa, a->mdiag, a->idiag, b, omega, ptr[c + 1] - ptr[c], rows + ptr[c], x);
+      PetscCall(PetscLogFlops(2.0 * a->nz));
+    }
+  }
+  PetscCall(MatSeqAIJRestoreArrayRead(A, &aa));
+  PetscCall(VecRestoreArray(xx, &x));
+  PetscCall(VecRestoreArrayRead(bb, &b));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 PetscErrorCode MatSOR_SeqAIJ(Mat A, Vec bb, PetscReal omega, MatSORType flag, PetscReal fshift, PetscInt its, PetscInt lits, Vec xx)
 {
   Mat_SeqAIJ        *a = (Mat_SeqAIJ *)A->data;
@@ -1930,6 +2034,10 @@ PetscErrorCode MatSOR_SeqAIJ(Mat A, Vec bb, PetscReal omega, MatSORType flag, Pe
   const PetscInt    *idx, *diag;
 
   PetscFunctionBegin;
+  if (a->sor_multicolor && flag != SOR_APPLY_UPPER && flag != SOR_APPLY_LOWER && !(flag & SOR_EISENSTAT)) {
+    PetscCall(MatSORMulticolor_SeqAIJ(A, bb, omega, flag, fshift, its, lits, xx));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   if (a->inode.use && a->inode.checked && omega == 1.0 && fshift == 0.0) {
     PetscCall(MatSOR_SeqAIJ_Inode(A, bb, omega, flag, fshift, its, lits, xx));
     PetscFunctionReturn(PETSC_SUCCESS);
@@ -3856,7 +3964,8 @@ PetscErrorCode MatRetrieveValues(Mat mat)
 
   Options Database Keys:
 + -mat_no_inode            - Do not use inodes
-- -mat_inode_limit <limit> - Sets inode limit (max limit=5)
+. -mat_inode_limit <limit> - Sets inode limit (max limit=5)
+- -mat_sor_multicolor      - Sweep over a multicolor ordering of the rows in `MatSOR()`, see `PCSOR`
 
   Level: intermediate
 
@@ -3907,7 +4016,8 @@ PetscErrorCode MatCreateSeqAIJ(MPI_Comm comm, PetscInt m, PetscInt n, PetscInt n
 
   Options Database Keys:
 + -mat_no_inode            - Do not use inodes
-- -mat_inode_limit <limit> - Sets inode limit (max limit=5)
+. -mat_inode_limit <limit> - Sets inode limit (max limit=5)
+- -mat_sor_multicolor      - Sweep over a multicolor ordering of the rows in `MatSOR()`, see `PCSOR`
 
   Level: intermediate
 
@@ -5024,6 +5134,7 @@ PetscErrorCode MatDuplicateNoCreate_SeqAIJ(Mat C, Mat A, MatDuplicateOption cpva
     c->idiag              = NULL;
     c->ssor_work          = NULL;
     c->keepnonzeropattern = a->keepnonzeropattern;
+    c->sor_multicolor     = a->sor_multicolor;
 
     c->rmax  = a->rmax;
     c->nz    = a->nz;
@@ -157,6 +157,12 @@ typedef struct {
   PetscBool    diagonaldense;             /* all entries along the diagonal have been set; i.e. no missing diagonal terms */
   PetscScalar  fshift, omega;             /* last used omega and fshift */
 
+  /* multicolor MatSOR(), rows of color c are sor_colorrows[sor_colorptr[c]] to sor_colorrows[sor_colorptr[c + 1] - 1] */
+  PetscBool        sor_multicolor;   /* sweep by colors so the rows of each color can be updated in parallel */
+  PetscInt         sor_ncolors;      /* number of colors */
+  PetscInt        *sor_colorptr, *sor_colorrows;
+  PetscObjectState sor_nonzerostate; /* nonzero state of the matrix the coloring was computed for */
+
   /* MatSetValues() via hash related fields */
   PetscHMapIJV   ht;
   PetscInt      *dnz;
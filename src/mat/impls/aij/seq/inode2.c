@@ -74,6 +74,7 @@ PetscErrorCode MatCreate_SeqAIJ_Inode(Mat B)
   PetscCall(PetscOptionsBool("-mat_no_inode", "Do not optimize for inodes -slower-", NULL, no_inode, &no_inode, NULL));
   if (no_inode) PetscCall(PetscInfo(B, "Not using Inode routines due to -mat_no_inode\n"));
   PetscCall(PetscOptionsInt("-mat_inode_limit", "Do not use inodes larger then this value", NULL, b->inode.limit, &b->inode.limit, NULL));
+  PetscCall(PetscOptionsBool("-mat_sor_multicolor", "Sweep over a multicolor ordering of the rows in MatSOR() so each color can be updated in parallel", "MatSOR", b->sor_multicolor, &b->sor_multicolor, NULL));
   PetscOptionsEnd();
 
   b->inode.use = (PetscBool)(!(no_unroll || no_inode));
@@ -188,9 +188,16 @@ PetscErrorCode MatFDColoringSetParameters(MatFDColoring matfd, PetscReal error,
 . brows - number of rows in the block
 - bcols - number of columns in the block
 
+  Options Database Keys:
++ -mat_fd_coloring_brows <brows> - number of rows in the block
+- -mat_fd_coloring_bcols <bcols> - number of columns in the block
+
   Level: intermediate
 
-.seealso: `Mat`, `MatFDColoring`, `MatFDColoringCreate()`, `MatFDColoringSetFromOptions()`
+  Note:
+  `bcols` is also the number of perturbed points passed at once to the function set with `MatFDColoringSetBatchFunction()`
+
+.seealso: `Mat`, `MatFDColoring`, `MatFDColoringCreate()`, `MatFDColoringSetFromOptions()`, `MatFDColoringSetBatchFunction()`
 @*/
 PetscErrorCode MatFDColoringSetBlockSize(MatFDColoring matfd, PetscInt brows, PetscInt bcols)
 {
@@ -296,6 +303,64 @@ PetscErrorCode MatFDColoringSetFunction(MatFDColoring matfd, MatFDColoringFn *f,
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@C
+  MatFDColoringSetBatchFunction - Sets a function that computes the function being differenced at several perturbed points with one call
+
+  Logically Collective; No Fortran Support
+
+  Input Parameters:
++ matfd - the coloring context
+. f     - the function, see `MatFDColoringBatchFn` for the calling sequence
+- fctx  - the optional user-defined function context
+
+  Level: advanced
+
+  Notes:
+  `MatFDColoringApply()` processes the colors in blocks of `bcols` colors, see `MatFDColoringSetBlockSize()`. When a batch function is
+  set, the points perturbed along the columns of all the colors of a block are passed to `f` together, instead of calling the
+  function set with `MatFDColoringSetFunction()` once for each color. The implementation of `f` can then, for example, overlap the
+  ghost point update of one input with the evaluation at another, or traverse the mesh data once for the whole batch.
+
+  The function set with `MatFDColoringSetFunction()` is still required, it computes the unperturbed function value and is used for the
+  matrix formats that difference one color at a time, such as `MATBAIJ`.
+
+.seealso: `Mat`, `MatFDColoring`, `MatFDColoringBatchFn`, `MatFDColoringSetFunction()`, `MatFDColoringGetBatchFunction()`, `MatFDColoringSetBlockSize()`,
+          `MatFDColoringApply()`
+@*/
+PetscErrorCode MatFDColoringSetBatchFunction(MatFDColoring matfd, MatFDColoringBatchFn *f, void *fctx)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(matfd, MAT_FDCOLORING_CLASSID, 1);
+  matfd->fbatch    = f;
+  matfd->fbatchctx = fctx;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@C
+  MatFDColoringGetBatchFunction - Gets the function set with `MatFDColoringSetBatchFunction()`
+
+  Not Collective; No Fortran Support
+
+  Input Parameter:
+. matfd - the coloring context
+
+  Output Parameters:
++ f    - the function, see `MatFDColoringBatchFn` for the calling sequence
+- fctx - the optional user-defined function context
+
+  Level: advanced
+
+.seealso: `Mat`, `MatFDColoring`, `MatFDColoringBatchFn`, `MatFDColoringSetBatchFunction()`
+@*/
+PetscErrorCode MatFDColoringGetBatchFunction(MatFDColoring matfd, MatFDColoringBatchFn **f, void **fctx)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(matfd, MAT_FDCOLORING_CLASSID, 1);
+  if (f) *f = matfd->fbatch;
+  if (fctx) *fctx = matfd->fbatchctx;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
   MatFDColoringSetFromOptions - Sets coloring finite difference parameters from
   the options database.
@@ -512,6 +577,8 @@ PetscErrorCode MatFDColoringDestroy(MatFDColoring *c)
   PetscCall(VecDestroy(&color->w1));
   PetscCall(VecDestroy(&color->w2));
   PetscCall(VecDestroy(&color->w3));
+  PetscCall(VecDestroyVecs(color->nbatch, &color->xbatch));
+  PetscCall(VecDestroyVecs(color->nbatch, &color->ybatch));
   PetscCall(PetscHeaderDestroy(c));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
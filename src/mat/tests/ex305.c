@@ -0,0 +1,61 @@
+static char help[] = "Tests MatSOR() with the multicolor ordering of MATSEQAIJ.\n\n";
+
+#include <petscmat.h>
+
+int main(int argc, char **args)
+{
+  Mat            A;
+  Vec            b, x, y;
+  PetscInt       n = 10, Istart, Iend;
+  PetscReal      norm;
+  PetscErrorCode ierr;
+
+  PetscFunctionBeginUser;
+  PetscCall(PetscInitialize(&argc, &args, NULL, help));
+  PetscCall(PetscOptionsGetInt(NULL, NULL, "-n", &n, NULL));
+  PetscCall(MatCreate(PETSC_COMM_SELF, &A));
+  PetscCall(MatSetSizes(A, n, n, n, n));
+  PetscCall(MatSetType(A, MATSEQAIJ));
+  PetscCall(MatSetFromOptions(A));
+  PetscCall(MatSeqAIJSetPreallocation(A, 3, NULL));
+  PetscCall(MatGetOwnershipRange(A, &Istart, &Iend));
+  for (PetscInt i = Istart; i < Iend; i++) {
+    if (i > 0) PetscCall(MatSetValue(A, i, i - 1, -1.0, INSERT_VALUES));
+    if (i < n - 1) PetscCall(MatSetValue(A, i, i + 1, -1.0, INSERT_VALUES));
+    PetscCall(MatSetValue(A, i, i, 2.0, INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(A, MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A, MAT_FINAL_ASSEMBLY));
+  PetscCall(MatCreateVecs(A, &x, &b));
+  PetscCall(VecDuplicate(x, &y));
+  PetscCall(VecSet(b, 1.0));
+
+  /* Symmetric sweeps must reduce the residual in either ordering */
+  PetscCall(MatSOR(A, b, 1.0, SOR_SYMMETRIC_SWEEP | SOR_ZERO_INITIAL_GUESS, 0.0, 20, 1, x));
+  PetscCall(MatMult(A, x, y));
+  PetscCall(VecAXPY(y, -1.0, b));
+  PetscCall(VecNorm(y, NORM_2, &norm));
+  PetscCall(PetscPrintf(PETSC_COMM_SELF, "Residual reduced by the symmetric sweeps: %s\n", norm < PetscSqrtReal((PetscReal)n) ? "yes" : "no"));
+
+  /* SOR_APPLY_LOWER is not implemented and must not be silently ignored */
+  PetscCall(VecSet(x, 0.0));
+  PetscCall(PetscPushErrorHandler(PetscReturnErrorHandler, NULL));
+  ierr = MatSOR(A, b, 1.0, SOR_APPLY_LOWER, 0.0, 1, 1, x);
+  PetscCall(PetscPopErrorHandler());
+  PetscCheck(ierr == PETSC_ERR_SUP, PETSC_COMM_SELF, PETSC_ERR_PLIB, "MatSOR() with SOR_APPLY_LOWER returned %d instead of PETSC_ERR_SUP", (int)ierr);
+  PetscCall(PetscPrintf(PETSC_COMM_SELF, "SOR_APPLY_LOWER is reported as not supported\n"));
+
+  PetscCall(VecDestroy(&y));
+  PetscCall(VecDestroy(&x));
+  PetscCall(VecDestroy(&b));
+  PetscCall(MatDestroy(&A));
+  PetscCall(PetscFinalize());
+  return 0;
+}
+
+/*TEST
+
+  test:
+    args: -mat_sor_multicolor {{0 1}} -mat_no_inode
+
+TEST*/
@@ -9,6 +9,7 @@ PETSC_INTERN PetscErrorCode MatStashScatterEnd_Ref(MatStash *);
 static PetscErrorCode MatStashScatterBegin_BTS(Mat, MatStash *, PetscInt *);
 static PetscErrorCode MatStashScatterGetMesg_BTS(MatStash *, PetscMPIInt *, PetscInt **, PetscInt **, PetscScalar **, PetscInt *);
 static PetscErrorCode MatStashScatterEnd_BTS(MatStash *);
+static PetscErrorCode MatStashProgressEnd_Private(MatStash *);
 #endif
 
 /*
@@ -76,6 +77,8 @@ PetscErrorCode MatStashCreate_Private(MPI_Comm comm, PetscInt bs, MatStash *stas
   stash->reproduce   = PETSC_FALSE;
   stash->blocktype   = MPI_DATATYPE_NULL;
 
+  stash->progress_size = 0;
+
   PetscCall(PetscOptionsGetBool(NULL, NULL, "-matstash_reproduce", &stash->reproduce, NULL));
 #if !defined(PETSC_HAVE_MPIUNI)
   flg = PETSC_FALSE;
@@ -85,6 +88,11 @@ PetscErrorCode MatStashCreate_Private(MPI_Comm comm, PetscInt bs, MatStash *stas
     stash->ScatterGetMesg = MatStashScatterGetMesg_BTS;
     stash->ScatterEnd     = MatStashScatterEnd_BTS;
     stash->ScatterDestroy = MatStashScatterDestroy_BTS;
+    PetscCall(PetscOptionsGetInt(NULL, NULL, "-matstash_progressive", &stash->progress_size, NULL));
+    if (stash->progress_size > 0) {
+      PetscCall(PetscCommGetNewTag(stash->comm, &stash->progress_tag[0]));
+      PetscCall(PetscCommGetNewTag(stash->comm, &stash->progress_tag[1]));
+    }
   } else {
 #endif
     stash->ScatterBegin   = MatStashScatterBegin_Ref;
@@ -107,6 +115,8 @@ PetscErrorCode MatStashDestroy_Private(MatStash *stash)
   if (stash->ScatterDestroy) PetscCall((*stash->ScatterDestroy)(stash));
   stash->space = NULL;
   PetscCall(PetscFree(stash->flg_v));
+  PetscCall(PetscFree(stash->progress_nsent));
+  PetscCall(PetscFree(stash->progress_buffer));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -972,6 +982,7 @@ static PetscErrorCode MatStashScatterGetMesg_BTS(MatStash *stash, PetscMPIInt *n
 static PetscErrorCode MatStashScatterEnd_BTS(MatStash *stash)
 {
   PetscFunctionBegin;
+  if (stash->progress_size > 0) PetscCall(MatStashProgressEnd_Private(stash));
   PetscCallMPI(MPI_Waitall(stash->nsendranks, stash->sendreqs, MPI_STATUSES_IGNORE));
   if (stash->first_assembly_done) { /* Reuse the communication contexts, so consolidate and reset segrecvblocks  */
     PetscCall(PetscSegBufferExtractInPlace(stash->segrecvblocks, NULL));
@@ -1017,4 +1028,166 @@ PetscErrorCode MatStashScatterDestroy_BTS(MatStash *stash)
   PetscCall(PetscFree2(stash->some_indices, stash->some_statuses));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
+
+/*
+  MatStashProgressSend_Private - Sends the stashed entries to their owners while the local values are still being set
+
+  Input Parameters:
++ stash  - the stash
+- owners - the ownership ranges
+
+  Notes:
+  With -matstash_progressive <n> the MATMPIAIJ MatSetValues() calls this routine each time n entries are stashed, and inserts
+  the entries received from the other ranks with MatStashProgressGetMesg_Private() as it goes, so that little is left to
+  communicate and insert in MatAssemblyBegin() and MatAssemblyEnd().
+
+  The entries are sorted, compressed and packed as in MatStashScatterBegin_BTS(), but sent with plain point-to-point messages
+  since the rendezvous of PetscCommBuildTwoSided() is collective. MatStashProgressCount_Private() tells each rank how many of
+  these messages to wait for in MatAssemblyEnd(). Only ADD_VALUES may be sent this way, the order in which INSERT_VALUES from
+  different ranks reach their owner is not defined.
+*/
+PetscErrorCode MatStashProgressSend_Private(MatStash *stash, PetscInt owners[])
+{
+  PetscCount    nblocks, b, rowstart;
+  MatStashChunk chunk;
+
+  PetscFunctionBegin;
+  if (!stash->n) PetscFunctionReturn(PETSC_SUCCESS);
+  if (!stash->progress_nsent) PetscCall(PetscCalloc1(stash->size, &stash->progress_nsent));
+  PetscCall(MatStashBlockTypeSetUp(stash));
+  PetscCall(MatStashSortCompress_Private(stash, ADD_VALUES));
+  PetscCall(PetscSegBufferGetSize(stash->segsendblocks, &nblocks));
+  PetscCall(PetscNew(&chunk));
+  PetscCall(PetscSegBufferExtractAlloc(stash->segsendblocks, &chunk->buffer));
+  PetscCall(PetscMalloc1(PetscMin(nblocks, stash->size), &chunk->reqs));
+  for (rowstart = 0; rowstart < nblocks; rowstart = b) {
+    MatStashBlock *sendblock_rowstart = (MatStashBlock *)&chunk->buffer[rowstart * stash->blocktype_size];
+    PetscInt       iowner;
+    PetscMPIInt    owner;
+
+    PetscCall(PetscFindInt(sendblock_rowstart->row, stash->size + 1, owners, &iowner));
+    if (iowner < 0) iowner = -(iowner + 2);
+    PetscCall(PetscMPIIntCast(iowner, &owner));
+    for (b = rowstart + 1; b < nblocks; b++) { /* Move forward through a run of blocks with the same owner */
+      MatStashBlock *sendblock_b = (MatStashBlock *)&chunk->buffer[b * stash->blocktype_size];
+
+      if (sendblock_b->row >= owners[owner + 1]) break;
+    }
+    PetscCallMPI(MPIU_Isend(sendblock_rowstart, b - rowstart, stash->blocktype, owner, stash->progress_tag[stash->progress_round], stash->comm, &chunk->reqs[chunk->nreqs++]));
+    stash->progress_nsent[owner]++;
+  }
+  chunk->next           = stash->progress_sends;
+  stash->progress_sends = chunk;
+
+  /* Empty the stash, the entries now live in chunk->buffer */
+  stash->nmax = 0;
+  stash->n    = 0;
+  PetscCall(PetscMatStashSpaceDestroy(&stash->space_head));
+  stash->space = NULL;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/* Frees the progressive messages that have been sent, waiting for all of them if requested */
+static PetscErrorCode MatStashProgressTestSends_Private(MatStash *stash, PetscBool wait)
+{
+  MatStashChunk *link = &stash->progress_sends;
+
+  PetscFunctionBegin;
+  while (*link) {
+    MatStashChunk chunk = *link;
+    PetscMPIInt   done  = 1;
+
+    if (wait) PetscCallMPI(MPI_Waitall(chunk->nreqs, chunk->reqs, MPI_STATUSES_IGNORE));
+    else PetscCallMPI(MPI_Testall(chunk->nreqs, chunk->reqs, &done, MPI_STATUSES_IGNORE));
+    if (done) {
+      *link = chunk->next;
+      PetscCall(PetscFree(chunk->buffer));
+      PetscCall(PetscFree(chunk->reqs));
+      PetscCall(PetscFree(chunk));
+    } else link = &chunk->next;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+  MatStashProgressGetMesg_Private - Gets the next entry sent with MatStashProgressSend_Private()
+
+  Input Parameters:
++ stash - the stash
+- wait  - wait for all the progressive messages of this assembly (only after MatStashProgressCount_Private()), or only
+          process those that have already arrived
+
+  Output Parameters:
++ row - the global row of the entry
+. col - the global column of the entry
+. val - the bs2 values of the entry, to be added
+- flg - 0 if there is no entry left
+*/
+PetscErrorCode MatStashProgressGetMesg_Private(MatStash *stash, PetscBool wait, PetscInt **row, PetscInt **col, PetscScalar **val, PetscInt *flg)
+{
+  MatStashBlock *block;
+
+  PetscFunctionBegin;
+  *flg = 0;
+  while (stash->progress_i == stash->progress_count) {
+    PetscMPIInt tag = stash->progress_tag[stash->progress_round], found = 1;
+    MPI_Status  status;
+
+    PetscCall(PetscFree(stash->progress_buffer));
+    stash->progress_i     = 0;
+    stash->progress_count = 0;
+    if (wait) {
+      if (stash->progress_nrecv == stash->progress_nexpected) PetscFunctionReturn(PETSC_SUCCESS); /* Done */
+      PetscCallMPI(MPI_Probe(MPI_ANY_SOURCE, tag, stash->comm, &status));
+    } else {
+      PetscCall(MatStashProgressTestSends_Private(stash, PETSC_FALSE));
+      PetscCallMPI(MPI_Iprobe(MPI_ANY_SOURCE, tag, stash->comm, &found, &status));
+      if (!found) PetscFunctionReturn(PETSC_SUCCESS);
+    }
+    PetscCall(MatStashBlockTypeSetUp(stash));
+    PetscCallMPI(MPI_Get_count(&status, stash->blocktype, &stash->progress_count));
+    PetscCall(PetscMalloc(stash->progress_count * stash->blocktype_size, &stash->progress_buffer));
+    PetscCallMPI(MPI_Recv(stash->progress_buffer, stash->progress_count, stash->blocktype, status.MPI_SOURCE, tag, stash->comm, MPI_STATUS_IGNORE));
+    stash->progress_nrecv++;
+  }
+  block = (MatStashBlock *)&stash->progress_buffer[stash->progress_i * stash->blocktype_size];
+  *row  = &block->row;
+  *col  = &block->col;
+  *val  = block->vals;
+  stash->progress_i++;
+  *flg = 1;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+  MatStashProgressCount_Private - Ends the progressive sends and receives of MatSetValues() and counts the progressive messages
+  this rank must still wait for
+
+  Collective, called in MatAssemblyBegin() before MatStashScatterBegin_Private()
+*/
+PetscErrorCode MatStashProgressCount_Private(MatStash *stash)
+{
+  PetscFunctionBegin;
+  if (!stash->progress_nsent) PetscCall(PetscCalloc1(stash->size, &stash->progress_nsent));
+  PetscCallMPI(MPI_Reduce_scatter_block(stash->progress_nsent, &stash->progress_nexpected, 1, MPI_INT, MPI_SUM, stash->comm));
+  stash->progress_busy = PETSC_TRUE;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MatStashProgressEnd_Private(MatStash *stash)
+{
+  PetscFunctionBegin;
+  PetscCheck(stash->progress_nrecv == stash->progress_nexpected, PETSC_COMM_SELF, PETSC_ERR_PLIB, "Received %d progressive messages, but expected %d", stash->progress_nrecv, stash->progress_nexpected);
+  PetscCall(MatStashProgressTestSends_Private(stash, PETSC_TRUE));
+  PetscCall(PetscFree(stash->progress_buffer));
+  if (stash->progress_nsent) PetscCall(PetscArrayzero(stash->progress_nsent, stash->size));
+  stash->progress_busy      = PETSC_FALSE;
+  stash->progress_calls     = 0;
+  stash->progress_round     = !stash->progress_round;
+  stash->progress_nrecv     = 0;
+  stash->progress_nexpected = 0;
+  stash->progress_i         = 0;
+  stash->progress_count     = 0;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
 #endif
@@ -1,4 +1,5 @@
 #include <petsc/private/snesimpl.h> /*I   "petscsnes.h"   I*/
+#include <petsc/private/sfimpl.h>
 #include <petscdm.h>
 
 typedef struct {
@@ -18,6 +19,10 @@ typedef struct {
   PetscBool   finaljacobian; /* compute the jacobian of the converged solution */
   PetscReal   damping;       /* damping parameter for updates from the blocks */
   PetscBool   weight_set;    /* use a weight in the overlap updates */
+  PetscBool   threaded;      /* solve the subdomain problems concurrently on OpenMP threads */
+  VecScatter  combine;       /* scatter from all the subdomain steps to the global step, in one pass */
+  Vec         ycombine;      /* the subdomain steps, concatenated */
+  PetscInt   *yoffset;       /* offset of each subdomain step in ycombine */
 
   /* logging events */
   PetscLogEvent eventrestrictinterp;
@@ -64,6 +69,10 @@ static PetscErrorCode SNESReset_NASM(SNES snes)
 
   if (nasm->weight_set) PetscCall(VecDestroy(&nasm->weight));
 
+  PetscCall(VecScatterDestroy(&nasm->combine));
+  PetscCall(VecDestroy(&nasm->ycombine));
+  PetscCall(PetscFree(nasm->yoffset));
+
   nasm->eventrestrictinterp = 0;
   nasm->eventsubsolve       = 0;
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -153,6 +162,21 @@ static PetscErrorCode SNESSetUp_NASM(SNES snes)
       PetscCall(DMGlobalToLocalHookAdd(subdm, DMGlobalToLocalSubDomainDirichletHook_Private, NULL, nasm->xl[i]));
     }
   }
+  if (nasm->threaded) {
+    if (!PetscDefined(HAVE_OPENMP) || !PetscDefined(HAVE_THREADSAFETY)) {
+      PetscCall(PetscInfo(snes, "Solving the subdomain problems sequentially, threads require PETSc configured with OpenMP and thread safety\n"));
+      nasm->threaded = PETSC_FALSE;
+    }
+    for (i = 0; i < nasm->n && nasm->threaded; i++) {
+      PetscMPIInt size;
+
+      PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)nasm->subsnes[i]), &size));
+      if (size > 1) {
+        PetscCall(PetscInfo(snes, "Solving the subdomain problems sequentially, threads require sequential subdomain solvers\n"));
+        nasm->threaded = PETSC_FALSE;
+      }
+    }
+  }
   if (nasm->finaljacobian) {
     PetscCall(SNESSetUpMatrices(snes));
     if (nasm->fjtype == 2) PetscCall(VecDuplicate(snes->vec_sol, &nasm->xinit));
@@ -178,6 +202,7 @@ static PetscErrorCode SNESSetFromOptions_NASM(SNES snes, PetscOptionItems PetscO
   PetscCall(PetscOptionsDeprecated("-snes_nasm_sub_view", NULL, "3.15", "Use -snes_view ::ascii_info_detail"));
   PetscCall(PetscOptionsBool("-snes_nasm_finaljacobian", "Compute the global jacobian of the final iterate (for ASPIN)", "", nasm->finaljacobian, &nasm->finaljacobian, NULL));
   PetscCall(PetscOptionsEList("-snes_nasm_finaljacobian_type", "The type of the final jacobian computed.", "", SNESNASMFJTypes, 3, SNESNASMFJTypes[0], &nasm->fjtype, NULL));
+  PetscCall(PetscOptionsBool("-snes_nasm_threaded", "Solve the subdomain problems concurrently on OpenMP threads", "", nasm->threaded, &nasm->threaded, NULL));
   PetscCall(PetscOptionsBool("-snes_nasm_log", "Log times for subSNES solves and restriction", "", monflg, &monflg, &flg));
   if (flg) {
     PetscCall(PetscLogEventRegister("SNESNASMSubSolve", ((PetscObject)snes)->classid, &nasm->eventsubsolve));
@@ -207,6 +232,7 @@ static PetscErrorCode SNESView_NASM(SNES snes, PetscViewer viewer)
   PetscCallMPI(MPIU_Allreduce(&nasm->n, &N, 1, MPIU_INT, MPI_SUM, comm));
   if (iascii) {
     PetscCall(PetscViewerASCIIPrintf(viewer, "  total subdomain blocks = %" PetscInt_FMT "\n", N));
+    if (nasm->threaded) PetscCall(PetscViewerASCIIPrintf(viewer, "  subdomain problems solved concurrently on threads\n"));
     PetscCall(PetscViewerGetFormat(viewer, &format));
     if (format != PETSC_VIEWER_ASCII_INFO_DETAIL) {
       if (nasm->subsnes) {
@@ -280,6 +306,10 @@ static PetscErrorCode SNESNASMSetType_NASM(SNES snes, PCASMType type)
 
   PetscFunctionBegin;
   PetscCheck(type == PC_ASM_BASIC || type == PC_ASM_RESTRICT, PetscObjectComm((PetscObject)snes), PETSC_ERR_ARG_OUTOFRANGE, "SNESNASM only supports basic and restrict types");
+  if (type != nasm->type) { /* the combined scatter depends on the type */
+    PetscCall(VecScatterDestroy(&nasm->combine));
+    PetscCall(VecDestroy(&nasm->ycombine));
+  }
   nasm->type = type;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -574,6 +604,118 @@ static PetscErrorCode SNESNASMGetDamping_NASM(SNES snes, PetscReal *dmp)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+  Sets up the scatter of all the subdomain steps, concatenated in ycombine, to the global step. It adds the steps of all the
+  subdomains in a single communication instead of one per subdomain, which matters with many small subdomains per process.
+  Scatters with different block sizes, or different numbers of subdomains on the processes, cannot be concatenated and are
+  then applied one after the other.
+*/
+static PetscErrorCode SNESNASMSetUpCombine_Private(SNES snes)
+{
+  SNES_NASM  *nasm     = (SNES_NASM *)snes->data;
+  VecScatter *scatters = nasm->type == PC_ASM_RESTRICT ? nasm->iscatter : nasm->oscatter;
+  PetscInt    i, n, bs, range[4] = {PETSC_INT_MIN, PETSC_INT_MIN, -nasm->n, nasm->n}, *leafoffsets;
+  MPI_Comm    comm;
+
+  PetscFunctionBegin;
+  if (nasm->ycombine) PetscFunctionReturn(PETSC_SUCCESS);
+  if (!nasm->yoffset) {
+    PetscCall(PetscMalloc1(nasm->n + 1, &nasm->yoffset));
+    nasm->yoffset[0] = 0;
+    for (i = 0; i < nasm->n; i++) {
+      PetscCall(VecGetLocalSize(nasm->y[i], &n));
+      nasm->yoffset[i + 1] = nasm->yoffset[i] + n;
+    }
+  }
+  PetscCall(VecCreateSeq(PETSC_COMM_SELF, nasm->yoffset[nasm->n], &nasm->ycombine));
+
+  /* the graphs of the scatters are in units of their block size, which must be the same everywhere */
+  for (i = 0; i < nasm->n; i++) {
+    range[0] = PetscMax(range[0], -PetscMax(scatters[i]->vscat.bs, 1));
+    range[1] = PetscMax(range[1], PetscMax(scatters[i]->vscat.bs, 1));
+  }
+  PetscCall(PetscObjectGetComm((PetscObject)snes, &comm));
+  PetscCallMPI(MPIU_Allreduce(MPI_IN_PLACE, range, 4, MPIU_INT, MPI_MAX, comm));
+  bs = range[1];
+  if (bs == PETSC_INT_MIN || -range[0] != bs || -range[2] != range[3]) {
+    PetscCall(PetscInfo(snes, "Adding the subdomain steps one subdomain at a time\n"));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+
+  /* all the scatters have the global vector as roots, their leaves are shifted to the steps of their subdomain */
+  PetscCall(PetscMalloc1(nasm->n, &leafoffsets));
+  for (i = 0; i < nasm->n; i++) leafoffsets[i] = nasm->yoffset[i] / bs;
+  PetscCall(PetscSFConcatenate(comm, nasm->n, scatters, PETSCSF_CONCATENATE_ROOTMODE_SHARED, leafoffsets, &nasm->combine));
+  PetscCall(PetscFree(leafoffsets));
+  nasm->combine->vscat.bs = bs;
+  if (bs > 1) {
+    PetscMPIInt ibs;
+
+    PetscCall(PetscMPIIntCast(bs, &ibs));
+    PetscCallMPI(MPI_Type_contiguous(ibs, MPIU_SCALAR, &nasm->combine->vscat.unit));
+    PetscCallMPI(MPI_Type_commit(&nasm->combine->vscat.unit));
+  }
+  PetscCall(VecScatterSetUp(nasm->combine));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+  Calls f(snes, i, ctx) for all the subdomains i, concurrently on OpenMP threads if requested with -snes_nasm_threaded. The
+  dynamic schedule balances the subdomains whose nonlinear solves take more iterations than the others.
+*/
+static PetscErrorCode SNESNASMForEachSubdomain_Private(SNES snes, PetscErrorCode (*f)(SNES, PetscInt, void *), void *ctx)
+{
+  SNES_NASM *nasm = (SNES_NASM *)snes->data;
+
+  PetscFunctionBegin;
+#if defined(PETSC_HAVE_OPENMP) && defined(PETSC_HAVE_THREADSAFETY)
+  if (nasm->threaded) {
+    PetscErrorCode ierr = PETSC_SUCCESS;
+
+    PetscPragmaOMP(parallel for schedule(dynamic))
+    for (PetscInt i = 0; i < nasm->n; i++) {
+      PetscErrorCode ierr_i = (*f)(snes, i, ctx);
+
+      if (ierr_i) {
+        PetscPragmaOMP(atomic write)
+        ierr = ierr_i;
+      }
+    }
+    PetscCheck(!ierr, PETSC_COMM_SELF, ierr, "Error in a subdomain solved on a thread");
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+#endif
+  for (PetscInt i = 0; i < nasm->n; i++) PetscCall((*f)(snes, i, ctx));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+typedef struct {
+  PetscBool    rhs;      /* the subdomain problems have a right-hand side */
+  PetscScalar *ycombine; /* array of the concatenated subdomain steps, if they are added in one pass */
+} SNESNASMSubSolveCtx;
+
+static PetscErrorCode SNESNASMSubSolve_Private(SNES snes, PetscInt i, void *ctx)
+{
+  SNES_NASM           *nasm = (SNES_NASM *)snes->data;
+  SNESNASMSubSolveCtx *sctx = (SNESNASMSubSolveCtx *)ctx;
+  Vec                  Xl   = nasm->x[i];
+  Vec                  Yl   = nasm->y[i];
+
+  PetscFunctionBegin;
+  PetscCall(VecCopy(Xl, Yl));
+  PetscCall(SNESSolve(nasm->subsnes[i], sctx->rhs ? nasm->b[i] : NULL, Xl));
+  PetscCall(VecAYPX(Yl, -1.0, Xl));
+  PetscCall(VecScale(Yl, nasm->damping));
+  if (sctx->ycombine) {
+    const PetscScalar *y;
+
+    PetscCall(VecGetArrayRead(Yl, &y));
+    PetscCall(PetscArraycpy(sctx->ycombine + nasm->yoffset[i], y, nasm->yoffset[i + 1] - nasm->yoffset[i]));
+    PetscCall(VecRestoreArrayRead(Yl, &y));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
   Input Parameters:
 + snes - The solver
@@ -583,22 +725,26 @@ static PetscErrorCode SNESNASMGetDamping_NASM(SNES snes, PetscReal *dmp)
   Output Parameter:
 . Y - The solution update
 
-  TODO: All scatters should be packed into one
+  The subdomain states are restricted first, then the subdomain problems are solved, concurrently if requested, and
+  their steps are finally added to Y in one pass.
 */
 static PetscErrorCode SNESNASMSolveLocal_Private(SNES snes, Vec B, Vec Y, Vec X)
 {
-  SNES_NASM *nasm = (SNES_NASM *)snes->data;
-  SNES       subsnes;
-  PetscInt   i;
-  PetscReal  dmp;
-  Vec        Xl, Bl, Yl, Xlloc;
-  VecScatter iscat, oscat, gscat, oscat_copy;
-  DM         dm, subdm;
-  PCASMType  type;
+  SNES_NASM          *nasm = (SNES_NASM *)snes->data;
+  SNES                subsnes;
+  PetscInt            i;
+  PetscReal           dmp;
+  Vec                 Xl, Bl, Xlloc;
+  VecScatter          iscat, oscat, gscat, oscat_copy;
+  DM                  dm, subdm;
+  PCASMType           type;
+  SNESNASMSubSolveCtx sctx;
 
   PetscFunctionBegin;
   PetscCall(SNESNASMGetType(snes, &type));
+  PetscCheck(type == PC_ASM_BASIC || type == PC_ASM_RESTRICT, PetscObjectComm((PetscObject)snes), PETSC_ERR_ARG_WRONGSTATE, "Only basic and restrict types are supported for SNESNASM");
   PetscCall(SNESGetDM(snes, &dm));
+  PetscCall(SNESNASMSetUpCombine_Private(snes));
   PetscCall(VecSet(Y, 0));
   if (nasm->eventrestrictinterp) PetscCall(PetscLogEventBegin(nasm->eventrestrictinterp, snes, 0, 0, 0));
   for (i = 0; i < nasm->n; i++) { /* scatter the global solution to the overlap solution and the local solution */
@@ -619,16 +765,13 @@ static PetscErrorCode SNESNASMSolveLocal_Private(SNES snes, Vec B, Vec Y, Vec X)
   if (nasm->eventrestrictinterp) PetscCall(PetscLogEventEnd(nasm->eventrestrictinterp, snes, 0, 0, 0));
 
   if (nasm->eventsubsolve) PetscCall(PetscLogEventBegin(nasm->eventsubsolve, snes, 0, 0, 0));
-  for (i = 0; i < nasm->n; i++) {
+  for (i = 0; i < nasm->n; i++) { /* the restriction may communicate on the communicator of the SNES, it is not threaded */
     PetscErrorCode (*bl)(DM, Vec, void *);
     void *bctx;
 
-    Xl      = nasm->x[i];
-    Xlloc   = nasm->xl[i];
-    Yl      = nasm->y[i];
-    subsnes = nasm->subsnes[i];
-    PetscCall(SNESGetDM(subsnes, &subdm));
-    iscat      = nasm->iscatter[i];
+    Xl         = nasm->x[i];
+    Xlloc      = nasm->xl[i];
+    subsnes    = nasm->subsnes[i];
     oscat      = nasm->oscatter[i];
     oscat_copy = nasm->oscatter_copy[i];
     gscat      = nasm->gscatter[i];
@@ -637,27 +780,32 @@ static PetscErrorCode SNESNASMSolveLocal_Private(SNES snes, Vec B, Vec Y, Vec X)
     if (B) {
       Bl = nasm->b[i];
       PetscCall(VecScatterEnd(oscat_copy, B, Bl, INSERT_VALUES, SCATTER_FORWARD));
-    } else Bl = NULL;
+    }
 
     PetscCall(SNESGetDM(subsnes, &subdm));
     PetscCall(DMSNESGetBoundaryLocal(subdm, &bl, &bctx));
     if (bl) PetscCall((*bl)(subdm, Xlloc, bctx));
 
     PetscCall(DMSubDomainRestrict(dm, oscat, gscat, subdm));
-    PetscCall(VecCopy(Xl, Yl));
-    PetscCall(SNESSolve(subsnes, Bl, Xl));
-    PetscCall(VecAYPX(Yl, -1.0, Xl));
-    PetscCall(VecScale(Yl, nasm->damping));
-    if (type == PC_ASM_BASIC) {
-      PetscCall(VecScatterBegin(oscat, Yl, Y, ADD_VALUES, SCATTER_REVERSE));
-      PetscCall(VecScatterEnd(oscat, Yl, Y, ADD_VALUES, SCATTER_REVERSE));
-    } else if (type == PC_ASM_RESTRICT) {
-      PetscCall(VecScatterBegin(iscat, Yl, Y, ADD_VALUES, SCATTER_REVERSE));
-      PetscCall(VecScatterEnd(iscat, Yl, Y, ADD_VALUES, SCATTER_REVERSE));
-    } else SETERRQ(PetscObjectComm((PetscObject)snes), PETSC_ERR_ARG_WRONGSTATE, "Only basic and restrict types are supported for SNESNASM");
   }
+  sctx.rhs      = B ? PETSC_TRUE : PETSC_FALSE;
+  sctx.ycombine = NULL;
+  if (nasm->combine) PetscCall(VecGetArrayWrite(nasm->ycombine, &sctx.ycombine));
+  PetscCall(SNESNASMForEachSubdomain_Private(snes, SNESNASMSubSolve_Private, &sctx));
+  if (nasm->combine) PetscCall(VecRestoreArrayWrite(nasm->ycombine, &sctx.ycombine));
   if (nasm->eventsubsolve) PetscCall(PetscLogEventEnd(nasm->eventsubsolve, snes, 0, 0, 0));
+
   if (nasm->eventrestrictinterp) PetscCall(PetscLogEventBegin(nasm->eventrestrictinterp, snes, 0, 0, 0));
+  if (nasm->combine) {
+    PetscCall(VecScatterBegin(nasm->combine, nasm->ycombine, Y, ADD_VALUES, SCATTER_REVERSE));
+    PetscCall(VecScatterEnd(nasm->combine, nasm->ycombine, Y, ADD_VALUES, SCATTER_REVERSE));
+  } else {
+    for (i = 0; i < nasm->n; i++) {
+      iscat = type == PC_ASM_RESTRICT ? nasm->iscatter[i] : nasm->oscatter[i];
+      PetscCall(VecScatterBegin(iscat, nasm->y[i], Y, ADD_VALUES, SCATTER_REVERSE));
+      PetscCall(VecScatterEnd(iscat, nasm->y[i], Y, ADD_VALUES, SCATTER_REVERSE));
+    }
+  }
   if (nasm->weight_set) PetscCall(VecPointwiseMult(Y, Y, nasm->weight));
   if (nasm->eventrestrictinterp) PetscCall(PetscLogEventEnd(nasm->eventrestrictinterp, snes, 0, 0, 0));
   PetscCall(SNESNASMGetDamping(snes, &dmp));
@@ -665,13 +813,27 @@ static PetscErrorCode SNESNASMSolveLocal_Private(SNES snes, Vec B, Vec Y, Vec X)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode SNESNASMSubJacobian_Private(SNES snes, PetscInt i, void *ctx)
+{
+  SNES_NASM *nasm    = (SNES_NASM *)snes->data;
+  SNES       subsnes = nasm->subsnes[i];
+  PetscInt   lag     = subsnes->lagjacobian;
+
+  PetscFunctionBegin;
+  if (subsnes->lagjacobian == -1) subsnes->lagjacobian = -2;
+  PetscCall(SNESComputeFunction(subsnes, nasm->x[i], subsnes->vec_func));
+  PetscCall(SNESComputeJacobian(subsnes, nasm->x[i], subsnes->jacobian, subsnes->jacobian_pre));
+  if (lag > 1) subsnes->lagjacobian = lag;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode SNESNASMComputeFinalJacobian_Private(SNES snes, Vec Xfinal)
 {
   Vec        X    = Xfinal;
   SNES_NASM *nasm = (SNES_NASM *)snes->data;
   SNES       subsnes;
-  PetscInt   i, lag = 1;
-  Vec        Xlloc, Xl, Fl, F;
+  PetscInt   i;
+  Vec        Xlloc, Xl, F;
   VecScatter oscat, gscat;
   DM         dm, subdm;
 
@@ -691,7 +853,6 @@ static PetscErrorCode SNESNASMComputeFinalJacobian_Private(SNES snes, Vec Xfinal
   }
   if (nasm->eventrestrictinterp) PetscCall(PetscLogEventEnd(nasm->eventrestrictinterp, snes, 0, 0, 0));
   for (i = 0; i < nasm->n; i++) {
-    Fl      = nasm->subsnes[i]->vec_func;
     Xl      = nasm->x[i];
     Xlloc   = nasm->xl[i];
     subsnes = nasm->subsnes[i];
@@ -704,12 +865,9 @@ static PetscErrorCode SNESNASMComputeFinalJacobian_Private(SNES snes, Vec Xfinal
       PetscCall(DMLocalToGlobalBegin(subdm, Xlloc, INSERT_VALUES, Xl));
       PetscCall(DMLocalToGlobalEnd(subdm, Xlloc, INSERT_VALUES, Xl));
     }
-    if (subsnes->lagjacobian == -1) subsnes->lagjacobian = -2;
-    else if (subsnes->lagjacobian > 1) lag = subsnes->lagjacobian;
-    PetscCall(SNESComputeFunction(subsnes, Xl, Fl));
-    PetscCall(SNESComputeJacobian(subsnes, Xl, subsnes->jacobian, subsnes->jacobian_pre));
-    if (lag > 1) subsnes->lagjacobian = lag;
   }
+  /* the subdomain residuals and Jacobians are evaluated in one batch, concurrently if requested */
+  PetscCall(SNESNASMForEachSubdomain_Private(snes, SNESNASMSubJacobian_Private, NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -804,6 +962,7 @@ static PetscErrorCode SNESSolve_NASM(SNES snes)
 .  -snes_nasm_damping <dmp>                                      - the new solution is obtained as old solution plus dmp times (sum of the solutions on the subdomains)
 .  -snes_nasm_finaljacobian                                      - compute the local and global Jacobians of the final iterate
 .  -snes_nasm_finaljacobian_type <finalinner,finalouter,initial> - pick state the Jacobian is calculated at
+.  -snes_nasm_threaded                                           - solve the subdomain problems, and compute their final Jacobians, concurrently on OpenMP threads
 .  -sub_snes_                                                    - options prefix of the subdomain nonlinear solves
 .  -sub_ksp_                                                     - options prefix of the subdomain Krylov solver
 -  -sub_pc_                                                      - options prefix of the subdomain preconditioner
@@ -814,6 +973,10 @@ static PetscErrorCode SNESSolve_NASM(SNES snes)
    This is not often used directly as a solver, it converges too slowly. However it works well as a nonlinear preconditioner for
    the `SNESASPIN` solver
 
+   With many small subdomains per MPI process, -snes_nasm_threaded solves the subdomain problems concurrently on OpenMP threads.
+   This requires PETSc configured with OpenMP and thread safety, sequential subdomain solvers, and thread-safe user callbacks;
+   otherwise the subdomain problems are solved one after the other.
+
    Developer Note:
    This is a non-Newton based nonlinear solver that does not directly require a Jacobian; hence the flag snes->usesksp is set to
    false and `SNESView()` and -snes_view do not display a `KSP` object. However, if the flag nasm->finaljacobian is set (for example, if
@@ -851,6 +1014,7 @@ PETSC_EXTERN PetscErrorCode SNESCreate_NASM(SNES snes)
   nasm->type          = PC_ASM_BASIC;
   nasm->finaljacobian = PETSC_FALSE;
   nasm->weight_set    = PETSC_FALSE;
+  nasm->threaded      = PETSC_FALSE;
 
   snes->ops->destroy        = SNESDestroy_NASM;
   snes->ops->setup          = SNESSetUp_NASM;
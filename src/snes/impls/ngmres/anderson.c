@@ -11,6 +11,7 @@ static PetscErrorCode SNESSetFromOptions_Anderson(SNES snes, PetscOptionItems Pe
   PetscCall(PetscOptionsReal("-snes_anderson_beta", "Mixing parameter", "SNES", ngmres->andersonBeta, &ngmres->andersonBeta, NULL));
   PetscCall(PetscOptionsInt("-snes_anderson_restart", "Iterations before forced restart", "SNES", ngmres->restart_periodic, &ngmres->restart_periodic, NULL));
   PetscCall(PetscOptionsInt("-snes_anderson_restart_it", "Tolerance iterations before restart", "SNES", ngmres->restart_it, &ngmres->restart_it, NULL));
+  PetscCall(PetscOptionsBool("-snes_anderson_tsqr", "Solve the least squares problem with a tall-skinny QR of the residuals", "SNES", ngmres->tsqr, &ngmres->tsqr, NULL));
   PetscCall(PetscOptionsEnum("-snes_anderson_restart_type", "Restart type", "SNESNGMRESSetRestartType", SNESNGMRESRestartTypes, (PetscEnum)ngmres->restart_type, (PetscEnum *)&ngmres->restart_type, NULL));
   PetscCall(PetscOptionsBool("-snes_anderson_monitor", "Monitor steps of Anderson Mixing", "SNES", ngmres->monitor ? PETSC_TRUE : PETSC_FALSE, &monitor, NULL));
   if (monitor) ngmres->monitor = PETSC_VIEWER_STDOUT_(PetscObjectComm((PetscObject)snes));
@@ -179,6 +180,7 @@ static PetscErrorCode SNESSolve_Anderson(SNES snes)
 .  -snes_anderson_restart_type     - Type of restart (see `SNESNGMRES`)
 .  -snes_anderson_restart_it       - Number of iterations of restart conditions before restart
 .  -snes_anderson_restart          - Number of iterations before periodic restart
+.  -snes_anderson_tsqr             - Solve the least squares problem with a tall-skinny QR of the residuals, see `SNESNGMRES`
 -  -snes_anderson_monitor          - Prints relevant information about the Anderson mixing iteration
 
    Notes:
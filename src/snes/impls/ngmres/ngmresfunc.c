@@ -35,6 +35,245 @@ PetscErrorCode SNESNGMRESUpdateSubspace_Private(SNES snes, PetscInt ivec, PetscI
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/* Rotation [c s; -conj(s) c], with c real, of two rows whose leading entries are a and b, that zeroes b */
+static inline void SNESNGMRESGivens_Private(PetscScalar a, PetscScalar b, PetscReal *c, PetscScalar *s)
+{
+  const PetscReal absa = PetscAbsScalar(a), absb = PetscAbsScalar(b);
+
+  if (absb == 0.0) {
+    *c = 1.0;
+    *s = 0.0;
+  } else if (absa == 0.0) {
+    *c = 0.0;
+    *s = PetscConj(b) / absb;
+  } else {
+    const PetscReal r = PetscHypotReal(absa, absb);
+
+    *c = absa / r;
+    *s = (a / absa) * PetscConj(b) / r;
+  }
+}
+
+/*
+  Reduction of the triangular factors of two blocks of rows. A packed factor with N columns is N, then N entries of workspace,
+  then the N x N factor. The rows of the factor of in are added one at a time to the factor of inout with Givens rotations.
+*/
+static void MPIAPI SNESNGMRESTSQRReduce_Private(void *in, void *inout, PetscMPIInt *cnt, MPI_Datatype *datatype)
+{
+  PetscScalar *a = (PetscScalar *)in, *b = (PetscScalar *)inout;
+  PetscMPIInt  size;
+
+  PetscCallMPIAbort(PETSC_COMM_SELF, MPI_Type_size(*datatype, &size));
+  for (PetscMPIInt c = 0; c < *cnt; c++) {
+    const PetscInt     N  = (PetscInt)PetscRealPart(a[0]);
+    const PetscScalar *Ra = a + 1 + N;
+    PetscScalar       *v = b + 1, *R = b + 1 + N;
+
+    for (PetscInt i = 0; i < N; i++) {
+      for (PetscInt j = i; j < N; j++) v[j] = Ra[i + j * N];
+      for (PetscInt k = i; k < N; k++) {
+        PetscReal   cs;
+        PetscScalar sn;
+
+        SNESNGMRESGivens_Private(R[k + k * N], v[k], &cs, &sn);
+        for (PetscInt j = k; j < N; j++) {
+          const PetscScalar x = R[k + j * N], y = v[j];
+
+          R[k + j * N] = cs * x + sn * y;
+          v[j]         = -PetscConj(sn) * x + cs * y;
+        }
+      }
+    }
+    a += size / (PetscMPIInt)sizeof(PetscScalar);
+    b += size / (PetscMPIInt)sizeof(PetscScalar);
+  }
+}
+
+/*
+  Orthogonalizes w against the first k columns of the local Q with classical Gram-Schmidt, repeated as long as a pass cancels
+  more than 1 - 1/sqrt(2) of the norm of w. The coefficients are returned in r and the norm of what remains in rho; when w lies
+  in the span of the columns to working precision it is zeroed and rho is zero.
+*/
+static PetscErrorCode SNESNGMRESTSQROrthogonalize_Private(SNES_NGMRES *ngmres, PetscInt n, PetscInt k, PetscScalar *w, PetscScalar *r, PetscReal *rho)
+{
+  PetscBLASInt n_, k_, one = 1;
+  PetscScalar  sone = 1.0, smone = -1.0, szero = 0.0, *s = ngmres->tsqr_work;
+  PetscReal    nrm;
+
+  PetscFunctionBegin;
+  PetscCall(PetscArrayzero(r, k));
+  *rho = 0.0;
+  if (n == 0) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(PetscBLASIntCast(n, &n_));
+  PetscCall(PetscBLASIntCast(k, &k_));
+  nrm = BLASnrm2_(&n_, w, &one);
+  if (k == 0 || nrm == 0.0) {
+    *rho = nrm;
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  for (PetscInt pass = 0; pass < 3; pass++) {
+    PetscReal nrmw;
+
+    PetscCallBLAS("BLASgemv", BLASgemv_("C", &n_, &k_, &sone, ngmres->tsqr_q, &n_, w, &one, &szero, s, &one));
+    PetscCallBLAS("BLASgemv", BLASgemv_("N", &n_, &k_, &smone, ngmres->tsqr_q, &n_, s, &one, &sone, w, &one));
+    for (PetscInt i = 0; i < k; i++) r[i] += s[i];
+    PetscCall(PetscLogFlops(4.0 * n * k + 2.0 * n));
+    nrmw = BLASnrm2_(&n_, w, &one);
+    if (PETSC_SQRT2 * nrmw > nrm) {
+      *rho = nrmw;
+      PetscFunctionReturn(PETSC_SUCCESS);
+    }
+    nrm = nrmw;
+  }
+  PetscCall(PetscArrayzero(w, n));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/* Appends the residual Fdot[i] as the last column of the local factor Q R of the history */
+static PetscErrorCode SNESNGMRESTSQRAppend_Private(SNES_NGMRES *ngmres, PetscInt n, PetscInt i)
+{
+  const PetscInt     k = ngmres->tsqr_k;
+  PetscScalar       *q = ngmres->tsqr_q + k * n, *r = ngmres->tsqr_r + k * ngmres->msize;
+  const PetscScalar *f;
+  PetscReal          rho;
+
+  PetscFunctionBegin;
+  PetscCall(VecGetArrayRead(ngmres->Fdot[i], &f));
+  PetscCall(PetscArraycpy(q, f, n));
+  PetscCall(VecRestoreArrayRead(ngmres->Fdot[i], &f));
+  PetscCall(SNESNGMRESTSQROrthogonalize_Private(ngmres, n, k, q, r, &rho));
+  r[k] = rho;
+  if (rho > 0.0) {
+    for (PetscInt j = 0; j < n; j++) q[j] /= rho;
+    PetscCall(PetscLogFlops(n));
+  }
+  ngmres->tsqr_col[k] = i;
+  PetscCall(PetscObjectStateGet((PetscObject)ngmres->Fdot[i], &ngmres->tsqr_state[k]));
+  ngmres->tsqr_k++;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+  Removes column j of the local factor Q R of the history. The following columns of R are shifted left and the resulting
+  subdiagonal is eliminated with Givens rotations, which are applied to the columns of Q as well.
+*/
+static PetscErrorCode SNESNGMRESTSQRDelete_Private(SNES_NGMRES *ngmres, PetscInt n, PetscInt j)
+{
+  const PetscInt k = ngmres->tsqr_k, ld = ngmres->msize;
+  PetscScalar   *Q = ngmres->tsqr_q, *R = ngmres->tsqr_r;
+
+  PetscFunctionBegin;
+  for (PetscInt c = j; c < k - 1; c++) {
+    PetscCall(PetscArraycpy(R + c * ld, R + (c + 1) * ld, c + 2));
+    ngmres->tsqr_col[c]   = ngmres->tsqr_col[c + 1];
+    ngmres->tsqr_state[c] = ngmres->tsqr_state[c + 1];
+  }
+  for (PetscInt c = j; c < k - 1; c++) {
+    PetscScalar *qc = Q + c * n, *qd = Q + (c + 1) * n, sn;
+    PetscReal    cs;
+
+    SNESNGMRESGivens_Private(R[c + c * ld], R[c + 1 + c * ld], &cs, &sn);
+    if (sn == (PetscScalar)0.0) continue;
+    for (PetscInt i = c; i < k - 1; i++) {
+      const PetscScalar x = R[c + i * ld], y = R[c + 1 + i * ld];
+
+      R[c + i * ld]     = cs * x + sn * y;
+      R[c + 1 + i * ld] = -PetscConj(sn) * x + cs * y;
+    }
+    R[c + 1 + c * ld] = 0.0;
+    for (PetscInt i = 0; i < n; i++) {
+      const PetscScalar x = qc[i], y = qd[i];
+
+      qc[i] = cs * x + PetscConj(sn) * y;
+      qd[i] = -sn * x + cs * y;
+    }
+  }
+  PetscCall(PetscLogFlops(6.0 * (n + k) * (k - 1 - j)));
+  ngmres->tsqr_k--;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+  Computes the coefficients minimizing || F_M - sum_i alpha_i (F_M - F_i) || from the triangular factor R of [F_0 ... F_{l-1} F_M],
+  obtained by a tall-skinny QR: each process keeps a QR factorization of its rows of the history, which is updated as residuals are
+  replaced, the current residual is appended to it, and the local factors are combined in one MPI_Allreduce().
+  The least squares problem is then solved with R, whose condition number is that of the residuals, not its square.
+*/
+static PetscErrorCode SNESNGMRESLeastSquaresTSQR_Private(SNES snes, PetscInt l, Vec FM, PetscScalar *alpha)
+{
+  SNES_NGMRES       *ngmres = (SNES_NGMRES *)snes->data;
+  PetscInt           N = l + 1, M = ngmres->msize + 1, size = 1 + M + M * M, n;
+  PetscScalar       *rloc, *r, *Rloc, *A, *b;
+  const PetscScalar *f;
+  PetscReal          rho;
+  PetscBLASInt       M_, N_;
+
+  PetscFunctionBegin;
+  PetscCall(VecGetLocalSize(FM, &n));
+  if (!ngmres->tsqr_q) {
+    PetscMPIInt count;
+
+    PetscCall(PetscMalloc6(n * M, &ngmres->tsqr_q, ngmres->msize * ngmres->msize, &ngmres->tsqr_r, ngmres->msize, &ngmres->tsqr_col, ngmres->msize, &ngmres->tsqr_state, 2 * size, &ngmres->tsqr_buf, M, &ngmres->tsqr_work));
+    ngmres->tsqr_k = 0;
+    PetscCall(PetscMPIIntCast(size, &count));
+    PetscCallMPI(MPI_Type_contiguous(count, MPIU_SCALAR, &ngmres->tsqr_type));
+    PetscCallMPI(MPI_Type_commit(&ngmres->tsqr_type));
+    PetscCallMPI(MPI_Op_create(SNESNGMRESTSQRReduce_Private, 0, &ngmres->tsqr_op));
+  }
+
+  /* bring the local factor up to date with F_0, ..., F_{l-1}, usually by removing the replaced residual and appending its new value */
+  for (PetscInt j = ngmres->tsqr_k - 1; j >= 0; j--) {
+    PetscObjectState state = -1;
+
+    if (ngmres->tsqr_col[j] < l) PetscCall(PetscObjectStateGet((PetscObject)ngmres->Fdot[ngmres->tsqr_col[j]], &state));
+    if (state != ngmres->tsqr_state[j]) PetscCall(SNESNGMRESTSQRDelete_Private(ngmres, n, j));
+  }
+  for (PetscInt i = 0; i < l; i++) {
+    PetscBool found = PETSC_FALSE;
+
+    for (PetscInt j = 0; j < ngmres->tsqr_k && !found; j++) found = (PetscBool)(ngmres->tsqr_col[j] == i);
+    if (!found) PetscCall(SNESNGMRESTSQRAppend_Private(ngmres, n, i));
+  }
+
+  /* local factor of [F_{col[0]} ... F_{col[l-1]} F_M], F_M is orthogonalized in the work column of Q and not kept */
+  rloc    = ngmres->tsqr_buf;
+  r       = ngmres->tsqr_buf + size;
+  rloc[0] = (PetscScalar)N;
+  Rloc    = rloc + 1 + N;
+  PetscCall(PetscArrayzero(Rloc, N * N));
+  for (PetscInt j = 0; j < l; j++) PetscCall(PetscArraycpy(Rloc + j * N, ngmres->tsqr_r + j * ngmres->msize, j + 1));
+  PetscCall(VecGetArrayRead(FM, &f));
+  PetscCall(PetscArraycpy(ngmres->tsqr_q + l * n, f, n));
+  PetscCall(VecRestoreArrayRead(FM, &f));
+  PetscCall(SNESNGMRESTSQROrthogonalize_Private(ngmres, n, l, ngmres->tsqr_q + l * n, Rloc + l * N, &rho));
+  Rloc[l + l * N] = rho;
+  PetscCallMPI(MPI_Allreduce(rloc, r, 1, ngmres->tsqr_type, ngmres->tsqr_op, PetscObjectComm((PetscObject)snes)));
+  r += 1 + N;
+
+  /* the columns of the factor of F_M - F_i and the factor of F_M */
+  PetscCall(PetscMalloc2(N * l, &A, N, &b));
+  for (PetscInt j = 0; j < l; j++) {
+    for (PetscInt i = 0; i < N; i++) A[i + j * N] = r[i + l * N] - r[i + j * N];
+  }
+  for (PetscInt i = 0; i < N; i++) b[i] = r[i + l * N];
+  PetscCall(PetscBLASIntCast(N, &M_));
+  PetscCall(PetscBLASIntCast(l, &N_));
+  ngmres->info  = 0;
+  ngmres->rcond = -1.;
+  PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
+#if defined(PETSC_USE_COMPLEX)
+  PetscCallBLAS("LAPACKgelss", LAPACKgelss_(&M_, &N_, &ngmres->nrhs, A, &M_, b, &M_, ngmres->s, &ngmres->rcond, &ngmres->rank, ngmres->work, &ngmres->lwork, ngmres->rwork, &ngmres->info));
+#else
+  PetscCallBLAS("LAPACKgelss", LAPACKgelss_(&M_, &N_, &ngmres->nrhs, A, &M_, b, &M_, ngmres->s, &ngmres->rcond, &ngmres->rank, ngmres->work, &ngmres->lwork, &ngmres->info));
+#endif
+  PetscCall(PetscFPTrapPop());
+  PetscCheck(ngmres->info >= 0, PetscObjectComm((PetscObject)snes), PETSC_ERR_LIB, "Bad argument to GELSS");
+  PetscCheck(ngmres->info <= 0, PetscObjectComm((PetscObject)snes), PETSC_ERR_LIB, "SVD failed to converge");
+  for (PetscInt j = 0; j < l; j++) alpha[ngmres->tsqr_col[j]] = b[j];
+  PetscCall(PetscFree2(A, b));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 PetscErrorCode SNESNGMRESFormCombinedSolution_Private(SNES snes, PetscInt ivec, PetscInt l, Vec XM, Vec FM, PetscReal fMnorm, Vec X, Vec XA, Vec FA)
 {
   SNES_NGMRES *ngmres = (SNES_NGMRES *)snes->data;
@@ -51,44 +290,48 @@ PetscErrorCode SNESNGMRESFormCombinedSolution_Private(SNES snes, PetscInt ivec,
   PetscFunctionBegin;
   nu = fMnorm * fMnorm;
 
-  /* construct the right-hand side and xi factors */
-  if (l > 0) {
-    PetscCall(VecMDotBegin(FM, l, Fdot, xi));
-    PetscCall(VecMDotBegin(Fdot[ivec], l, Fdot, beta));
-    PetscCall(VecMDotEnd(FM, l, Fdot, xi));
-    PetscCall(VecMDotEnd(Fdot[ivec], l, Fdot, beta));
-    for (i = 0; i < l; i++) {
-      Q(i, ivec) = beta[i];
-      Q(ivec, i) = beta[i];
-    }
+  if (ngmres->tsqr) {
+    if (l > 0) PetscCall(SNESNGMRESLeastSquaresTSQR_Private(snes, l, FM, beta));
   } else {
-    Q(0, 0) = ngmres->fnorms[ivec] * ngmres->fnorms[ivec];
-  }
+    /* construct the right-hand side and xi factors */
+    if (l > 0) {
+      PetscCall(VecMDotBegin(FM, l, Fdot, xi));
+      PetscCall(VecMDotBegin(Fdot[ivec], l, Fdot, beta));
+      PetscCall(VecMDotEnd(FM, l, Fdot, xi));
+      PetscCall(VecMDotEnd(Fdot[ivec], l, Fdot, beta));
+      for (i = 0; i < l; i++) {
+        Q(i, ivec) = beta[i];
+        Q(ivec, i) = beta[i];
+      }
+    } else {
+      Q(0, 0) = ngmres->fnorms[ivec] * ngmres->fnorms[ivec];
+    }
 
-  for (i = 0; i < l; i++) beta[i] = nu - xi[i];
+    for (i = 0; i < l; i++) beta[i] = nu - xi[i];
 
-  /* construct h */
-  for (j = 0; j < l; j++) {
-    for (i = 0; i < l; i++) H(i, j) = Q(i, j) - xi[i] - xi[j] + nu;
-  }
-  if (l == 1) {
-    /* simply set alpha[0] = beta[0] / H[0, 0] */
-    if (H(0, 0) != 0.) beta[0] = beta[0] / H(0, 0);
-    else beta[0] = 0.;
-  } else {
-    PetscCall(PetscBLASIntCast(l, &ngmres->m));
-    PetscCall(PetscBLASIntCast(l, &ngmres->n));
-    ngmres->info  = 0;
-    ngmres->rcond = -1.;
-    PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
+    /* construct h */
+    for (j = 0; j < l; j++) {
+      for (i = 0; i < l; i++) H(i, j) = Q(i, j) - xi[i] - xi[j] + nu;
+    }
+    if (l == 1) {
+      /* simply set alpha[0] = beta[0] / H[0, 0] */
+      if (H(0, 0) != 0.) beta[0] = beta[0] / H(0, 0);
+      else beta[0] = 0.;
+    } else {
+      PetscCall(PetscBLASIntCast(l, &ngmres->m));
+      PetscCall(PetscBLASIntCast(l, &ngmres->n));
+      ngmres->info  = 0;
+      ngmres->rcond = -1.;
+      PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
 #if defined(PETSC_USE_COMPLEX)
-    PetscCallBLAS("LAPACKgelss", LAPACKgelss_(&ngmres->m, &ngmres->n, &ngmres->nrhs, ngmres->h, &ngmres->lda, ngmres->beta, &ngmres->ldb, ngmres->s, &ngmres->rcond, &ngmres->rank, ngmres->work, &ngmres->lwork, ngmres->rwork, &ngmres->info));
+      PetscCallBLAS("LAPACKgelss", LAPACKgelss_(&ngmres->m, &ngmres->n, &ngmres->nrhs, ngmres->h, &ngmres->lda, ngmres->beta, &ngmres->ldb, ngmres->s, &ngmres->rcond, &ngmres->rank, ngmres->work, &ngmres->lwork, ngmres->rwork, &ngmres->info));
 #else
-    PetscCallBLAS("LAPACKgelss", LAPACKgelss_(&ngmres->m, &ngmres->n, &ngmres->nrhs, ngmres->h, &ngmres->lda, ngmres->beta, &ngmres->ldb, ngmres->s, &ngmres->rcond, &ngmres->rank, ngmres->work, &ngmres->lwork, &ngmres->info));
+      PetscCallBLAS("LAPACKgelss", LAPACKgelss_(&ngmres->m, &ngmres->n, &ngmres->nrhs, ngmres->h, &ngmres->lda, ngmres->beta, &ngmres->ldb, ngmres->s, &ngmres->rcond, &ngmres->rank, ngmres->work, &ngmres->lwork, &ngmres->info));
 #endif
-    PetscCall(PetscFPTrapPop());
-    PetscCheck(ngmres->info >= 0, PetscObjectComm((PetscObject)snes), PETSC_ERR_LIB, "Bad argument to GELSS");
-    PetscCheck(ngmres->info <= 0, PetscObjectComm((PetscObject)snes), PETSC_ERR_LIB, "SVD failed to converge");
+      PetscCall(PetscFPTrapPop());
+      PetscCheck(ngmres->info >= 0, PetscObjectComm((PetscObject)snes), PETSC_ERR_LIB, "Bad argument to GELSS");
+      PetscCheck(ngmres->info <= 0, PetscObjectComm((PetscObject)snes), PETSC_ERR_LIB, "SVD failed to converge");
+    }
   }
   for (i = 0; i < l; i++) PetscCheck(!PetscIsInfOrNanScalar(beta[i]), PetscObjectComm((PetscObject)snes), PETSC_ERR_LIB, "SVD generated inconsistent output");
   alph_total = 0.;
@@ -12,6 +12,11 @@ PetscErrorCode SNESReset_NGMRES(SNES snes)
   PetscFunctionBegin;
   PetscCall(VecDestroyVecs(ngmres->msize, &ngmres->Fdot));
   PetscCall(VecDestroyVecs(ngmres->msize, &ngmres->Xdot));
+  if (ngmres->tsqr_q) {
+    PetscCall(PetscFree6(ngmres->tsqr_q, ngmres->tsqr_r, ngmres->tsqr_col, ngmres->tsqr_state, ngmres->tsqr_buf, ngmres->tsqr_work));
+    PetscCallMPI(MPI_Op_free(&ngmres->tsqr_op));
+    PetscCallMPI(MPI_Type_free(&ngmres->tsqr_type));
+  }
   PetscCall(SNESLineSearchDestroy(&ngmres->additive_linesearch));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -88,6 +93,7 @@ static PetscErrorCode SNESSetFromOptions_NGMRES(SNES snes, PetscOptionItems Pets
   PetscCall(PetscOptionsEnum("-snes_ngmres_restart_type", "Restart type", "SNESNGMRESSetRestartType", SNESNGMRESRestartTypes, (PetscEnum)ngmres->restart_type, (PetscEnum *)&ngmres->restart_type, NULL));
   PetscCall(PetscOptionsBool("-snes_ngmres_candidate", "Use candidate storage", "SNES", ngmres->candidate, &ngmres->candidate, NULL));
   PetscCall(PetscOptionsBool("-snes_ngmres_approxfunc", "Linearly approximate the function", "SNES", ngmres->approxfunc, &ngmres->approxfunc, NULL));
+  PetscCall(PetscOptionsBool("-snes_ngmres_tsqr", "Solve the least squares problem with a tall-skinny QR of the residuals", "SNES", ngmres->tsqr, &ngmres->tsqr, NULL));
   PetscCall(PetscOptionsInt("-snes_ngmres_m", "Number of directions", "SNES", ngmres->msize, &ngmres->msize, NULL));
   PetscCall(PetscOptionsInt("-snes_ngmres_restart", "Iterations before forced restart", "SNES", ngmres->restart_periodic, &ngmres->restart_periodic, NULL));
   PetscCall(PetscOptionsInt("-snes_ngmres_restart_it", "Tolerance iterations before restart", "SNES", ngmres->restart_it, &ngmres->restart_it, NULL));
@@ -116,6 +122,7 @@ PetscErrorCode SNESView_NGMRES(SNES snes, PetscViewer viewer)
   PetscCall(PetscObjectTypeCompare((PetscObject)viewer, PETSCVIEWERASCII, &iascii));
   if (iascii) {
     PetscCall(PetscViewerASCIIPrintf(viewer, "  Number of stored past updates: %" PetscInt_FMT "\n", ngmres->msize));
+    if (ngmres->tsqr) PetscCall(PetscViewerASCIIPrintf(viewer, "  Least squares problem solved with a tall-skinny QR of the residuals\n"));
     if (ngmres->select_type == SNES_NGMRES_SELECT_DIFFERENCE) {
       PetscCall(PetscViewerASCIIPrintf(viewer, "  Residual selection: gammaA=%1.0e, gammaC=%1.0e\n", (double)ngmres->gammaA, (double)ngmres->gammaC));
       PetscCall(PetscViewerASCIIPrintf(viewer, "  Difference restart: epsilonB=%1.0e, deltaB=%1.0e\n", (double)ngmres->epsilonB, (double)ngmres->deltaB));
@@ -461,6 +468,7 @@ static PetscErrorCode SNESNGMRESSetRestartType_NGMRES(SNES snes, SNESNGMRESResta
 .  -snes_ngmres_restart_type<difference,none,periodic>  - choose the restart conditions
 .  -snes_ngmres_candidate                               - Use `SNESNGMRES` variant which combines candidate solutions instead of actual solutions
 .  -snes_ngmres_m                                       - Number of stored previous solutions and residuals
+.  -snes_ngmres_tsqr                                    - Solve the least squares problem with a tall-skinny QR of the residuals instead of their inner products
 .  -snes_ngmres_restart_it                              - Number of iterations the restart conditions hold before restart
 .  -snes_ngmres_gammaA                                  - Residual tolerance for solution select between the candidate and combination
 .  -snes_ngmres_gammaC                                  - Residual tolerance for restart
@@ -480,6 +488,13 @@ static PetscErrorCode SNESNGMRESSetRestartType_NGMRES(SNES snes, SNESNGMRESResta
    Unlike the linear GMRES algorithm this algorithm does not compute a Krylov subspace using the Arnoldi process. Instead it stores a
    collection of previous solutions and the residuals $ F(x) - b $ at those solutions.
 
+   By default the small least squares problem is formed from the inner products of the stored residuals, that is from its normal
+   equations, whose condition number is the square of that of the residuals. With `-snes_ngmres_tsqr` the triangular factor of a QR
+   factorization of the residuals is computed instead, by factoring the locally owned rows on each MPI process and combining the factors
+   in a single `MPI_Allreduce()`, and the least squares problem is solved with it. This is more robust when the stored residuals are
+   nearly linearly dependent. The local factorization is updated as residuals enter and leave the history, so each iteration costs
+   a few passes over the local rows of the history, like the inner products it replaces.
+
    This algorithm ignores any Jacobian provided with `SNESSetJacobian()`
 
    Only supports left non-linear preconditioning.
@@ -54,6 +54,18 @@ typedef struct {
   PetscBLASInt lwork; /* the size of the work vector */
   PetscBLASInt info;  /* the output condition */
 
+  /* Tall-skinny QR of the residual history, used instead of its inner products */
+  PetscBool         tsqr;       /* solve the least squares problem with the triangular factor of the residuals */
+  PetscInt          tsqr_k;     /* number of residuals in the local factor Q R of the history */
+  PetscScalar      *tsqr_q;     /* local rows of Q, with a work column for the current residual */
+  PetscScalar      *tsqr_r;     /* R, msize x msize */
+  PetscInt         *tsqr_col;   /* index in Fdot of each column of the local factor */
+  PetscObjectState *tsqr_state; /* state of these residuals when they were added to the local factor */
+  PetscScalar      *tsqr_buf;   /* local and reduced packed factors of the history and the current residual */
+  PetscScalar      *tsqr_work;  /* projections on the columns of Q */
+  MPI_Datatype      tsqr_type;  /* packed factor */
+  MPI_Op            tsqr_op;    /* reduction of two packed factors */
+
   PetscBool setup_called; /* indicates whether SNESSetUp_NGMRES() has been called  */
 } SNES_NGMRES;
 
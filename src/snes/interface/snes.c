@@ -435,6 +435,11 @@ PetscErrorCode SNESView(SNES snes, PetscViewer viewer)
         PetscCall(PetscViewerASCIIPrintf(viewer, "    gamma=%g, alpha=%g, alpha2=%g\n", (double)kctx->gamma, (double)kctx->alpha, (double)kctx->alpha2));
       }
     }
+    if (snes->lagjac_adaptive) {
+      PetscCall(PetscViewerASCIIPrintf(viewer, "  Jacobian and preconditioner are rebuilt when the extra linear iterations cost more than a rebuild\n"));
+    } else if (snes->lagpre_adaptive) {
+      PetscCall(PetscViewerASCIIPrintf(viewer, "  Preconditioner is rebuilt when the extra linear iterations cost more than a rebuild\n"));
+    }
     if (snes->lagpreconditioner == -1) {
       PetscCall(PetscViewerASCIIPrintf(viewer, "  Preconditioned is never rebuilt\n"));
     } else if (snes->lagpreconditioner > 1) {
@@ -1017,6 +1022,10 @@ PetscErrorCode SNESSetFromOptions(SNES snes)
   }
   PetscCall(PetscOptionsBool("-snes_lag_jacobian_persists", "Jacobian lagging through multiple SNES solves", "SNESSetLagJacobianPersists", snes->lagjac_persist, &persist, &flg));
   if (flg) PetscCall(SNESSetLagJacobianPersists(snes, persist));
+  PetscCall(PetscOptionsBool("-snes_lag_jacobian_adaptive", "Rebuild the Jacobian when the extra linear iterations cost more than a rebuild", "SNESSetLagJacobianAdaptive", snes->lagjac_adaptive, &persist, &flg));
+  if (flg) PetscCall(SNESSetLagJacobianAdaptive(snes, persist));
+  PetscCall(PetscOptionsBool("-snes_lag_preconditioner_adaptive", "Rebuild the preconditioner when the extra linear iterations cost more than a rebuild", "SNESSetLagPreconditionerAdaptive", snes->lagpre_adaptive, &persist, &flg));
+  if (flg) PetscCall(SNESSetLagPreconditionerAdaptive(snes, persist));
 
   PetscCall(PetscOptionsInt("-snes_grid_sequence", "Use grid sequencing to generate initial guess", "SNESSetGridSequence", snes->gridsequence, &grids, &flg));
   if (flg) PetscCall(SNESSetGridSequence(snes, grids));
@@ -1854,6 +1863,7 @@ PetscErrorCode SNESCreate(MPI_Comm comm, SNES *outsnes)
   snes->lagpreconditioner    = 1;
   snes->pre_iter             = 0;
   snes->lagpre_persist       = PETSC_FALSE;
+  snes->lag_cost             = -1;
   snes->numbermonitors       = 0;
   snes->numberreasonviews    = 0;
   snes->data                 = NULL;
@@ -2882,6 +2892,67 @@ PetscErrorCode SNESTestJacobian(SNES snes, PetscReal *Jnorm, PetscReal *diffNorm
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+  Decides if the Jacobian (or only the preconditioner) must be rebuilt, from the times recorded by the log events since the last decision.
+  The linear iterations of the first solve after a rebuild are the baseline, the cost of the iterations beyond the baseline in the
+  following solves is accumulated and the Jacobian is rebuilt once it exceeds the cost of the last rebuild.
+*/
+static PetscErrorCode SNESLagAdaptiveCheck_Private(SNES snes, PetscBool jacobian, PetscBool *rebuild)
+{
+  KSP                ksp;
+  KSPConvergedReason reason;
+  PetscLogState      state;
+  PetscLogEvent      events[3];
+  PetscLogDouble     time[3], dtime[3];
+  PetscInt           its, dits, nstages = 0;
+
+  PetscFunctionBegin;
+  PetscCall(SNESGetKSP(snes, &ksp));
+  events[0] = SNES_JacobianEval;
+  PetscCall(PetscLogEventGetId("PCSetUp", &events[1]));
+  PetscCall(PetscLogEventGetId("KSPSolve", &events[2]));
+  PetscCall(PetscLogGetState(&state));
+  if (state) PetscCall(PetscLogStateGetNumStages(state, &nstages));
+  for (PetscInt i = 0; i < 3; i++) {
+    /* the solves may run in several stages, for instance in the stages pushed by the user around each time step */
+    time[i] = 0;
+    for (PetscLogStage stage = 0; stage < nstages; stage++) {
+      PetscEventPerfInfo info;
+
+      PetscCall(PetscLogEventGetPerfInfo(stage, events[i], &info));
+      time[i] += info.time;
+    }
+    dtime[i]          = PetscMax(time[i] - snes->lag_time[i], 0);
+    snes->lag_time[i] = time[i];
+  }
+  /* the decision must be the same on all processes */
+  PetscCallMPI(MPIU_Allreduce(MPI_IN_PLACE, dtime, 3, MPIU_PETSCLOGDOUBLE, MPI_MAX, PetscObjectComm((PetscObject)snes)));
+  PetscCall(KSPGetTotalIterations(ksp, &its));
+  dits          = its - snes->lag_its;
+  snes->lag_its = its;
+  PetscCall(KSPGetConvergedReason(ksp, &reason));
+  /* a stale Jacobian slows down the nonlinear convergence, which the linear iterations do not show */
+  if (jacobian && snes->iter > 0 && snes->norm > 0.1 * snes->lag_fnorm) snes->lag_cost = -1;
+  snes->lag_fnorm = snes->norm;
+
+  if (snes->lag_cost < 0 || reason < 0) {
+    *rebuild = PETSC_TRUE;
+  } else if (snes->lag_rebuilt) {
+    /* the interval since the last decision contains the rebuild and the first solve with it */
+    snes->lag_cost     = (jacobian ? dtime[0] : 0) + dtime[1];
+    snes->lag_base_its = dits;
+    snes->lag_extra    = 0;
+    *rebuild           = snes->lag_cost > 0 ? PETSC_FALSE : PETSC_TRUE; /* always rebuild if the events are not logged */
+  } else {
+    if (dits > snes->lag_base_its) snes->lag_extra += (dits - snes->lag_base_its) * (dtime[2] / dits);
+    *rebuild = snes->lag_extra > snes->lag_cost ? PETSC_TRUE : PETSC_FALSE;
+  }
+  PetscCall(PetscInfo(snes, "%s %s, %" PetscInt_FMT " linear iterations for a baseline of %" PetscInt_FMT ", extra iterations cost %g s and the last rebuild %g s\n", *rebuild ? "Rebuilding" : "Reusing", jacobian ? "Jacobian/preconditioner" : "preconditioner", dits, snes->lag_base_its, (double)snes->lag_extra, (double)snes->lag_cost));
+  if (*rebuild && snes->lag_cost < 0) snes->lag_cost = 0;
+  snes->lag_rebuilt = *rebuild;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
   SNESComputeJacobian - Computes the Jacobian matrix that has been set with `SNESSetJacobian()`.
 
@@ -2898,6 +2969,8 @@ PetscErrorCode SNESTestJacobian(SNES snes, PetscReal *Jnorm, PetscReal *diffNorm
   Options Database Keys:
 + -snes_lag_preconditioner <lag>           - how often to rebuild preconditioner
 . -snes_lag_jacobian <lag>                 - how often to rebuild Jacobian
+. -snes_lag_jacobian_adaptive              - rebuild the Jacobian when the extra linear iterations cost more than a rebuild, see `SNESSetLagJacobianAdaptive()`
+. -snes_lag_preconditioner_adaptive        - rebuild the preconditioner when the extra linear iterations cost more than a rebuild
 . -snes_test_jacobian <optional threshold> - compare the user provided Jacobian with one compute via finite differences to check for errors.  If a threshold is given, display only those entries whose difference is greater than the threshold.
 . -snes_test_jacobian_view                 - display the user provided Jacobian, the finite difference Jacobian and the difference between them to help users detect the location of errors in the user provided Jacobian
 . -snes_compare_explicit                   - Compare the computed Jacobian to the finite difference Jacobian and output the differences
@@ -2940,7 +3013,19 @@ PetscErrorCode SNESComputeJacobian(SNES snes, Vec X, Mat A, Mat B)
   PetscCall(DMGetDMSNES(dm, &sdm));
 
   /* make sure that MatAssemblyBegin/End() is called on A matrix if it is matrix-free */
-  if (snes->lagjacobian == -2) {
+  if (snes->lagjac_adaptive) {
+    PetscBool rebuild;
+
+    PetscCall(SNESLagAdaptiveCheck_Private(snes, PETSC_TRUE, &rebuild));
+    if (!rebuild) {
+      PetscCall(PetscObjectTypeCompare((PetscObject)A, MATMFFD, &flag));
+      if (flag) {
+        PetscCall(MatAssemblyBegin(A, MAT_FINAL_ASSEMBLY));
+        PetscCall(MatAssemblyEnd(A, MAT_FINAL_ASSEMBLY));
+      }
+      PetscFunctionReturn(PETSC_SUCCESS);
+    }
+  } else if (snes->lagjacobian == -2) {
     snes->lagjacobian = -1;
 
     PetscCall(PetscInfo(snes, "Recomputing Jacobian/preconditioner because lag is -2 (means compute Jacobian, but then never again) \n"));
@@ -2983,7 +3068,14 @@ PetscErrorCode SNESComputeJacobian(SNES snes, Vec X, Mat A, Mat B)
 
   /* the next line ensures that snes->ksp exists */
   PetscCall(SNESGetKSP(snes, &ksp));
-  if (snes->lagpreconditioner == -2) {
+  if (snes->lagjac_adaptive) {
+    PetscCall(KSPSetReusePreconditioner(snes->ksp, PETSC_FALSE));
+  } else if (snes->lagpre_adaptive) {
+    PetscBool rebuild;
+
+    PetscCall(SNESLagAdaptiveCheck_Private(snes, PETSC_FALSE, &rebuild));
+    PetscCall(KSPSetReusePreconditioner(snes->ksp, rebuild ? PETSC_FALSE : PETSC_TRUE));
+  } else if (snes->lagpreconditioner == -2) {
     PetscCall(PetscInfo(snes, "Rebuilding preconditioner exactly once since lag is -2\n"));
     PetscCall(KSPSetReusePreconditioner(snes->ksp, PETSC_FALSE));
     snes->lagpreconditioner = -1;
@@ -3399,8 +3491,10 @@ PetscErrorCode SNESSetUp(SNES snes)
   if (snes->mf) PetscCall(SNESSetUpMatrixFree_Private(snes, snes->mf_operator, snes->mf_version));
   if (snes->ops->usercompute && !snes->ctx) PetscCallBack("SNES callback compute application context", (*snes->ops->usercompute)(snes, &snes->ctx));
 
-  snes->jac_iter = 0;
-  snes->pre_iter = 0;
+  snes->jac_iter    = 0;
+  snes->pre_iter    = 0;
+  snes->lag_cost    = -1;
+  snes->lag_rebuilt = PETSC_FALSE;
 
   PetscTryTypeMethod(snes, setup);
 
@@ -3805,6 +3899,103 @@ PetscErrorCode SNESSetLagPreconditionerPersists(SNES snes, PetscBool flg)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+  SNESSetLagJacobianAdaptive - Set whether the Jacobian, and with it the preconditioner, is rebuilt according to the measured cost of
+  rebuilding it instead of a fixed lag
+
+  Logically Collective
+
+  Input Parameters:
++ snes - the `SNES` context
+- flg  - `PETSC_TRUE` to rebuild the Jacobian adaptively
+
+  Options Database Key:
+. -snes_lag_jacobian_adaptive <true,false> - rebuild the Jacobian adaptively
+
+  Level: advanced
+
+  Notes:
+  The linear iterations of the first linear solve after the Jacobian is rebuilt are the baseline. The Jacobian is then reused, and the
+  time of the linear iterations beyond the baseline in the following solves is accumulated. The Jacobian is rebuilt once this time
+  exceeds the time of the last rebuild, that is the time of its evaluation and of `PCSetUp()`, or when a linear solve fails.
+
+  The times are those recorded by the `SNES_JacobianEval`, `PC_SetUp`, and `KSP_Solve` log events, so this starts the default log handler
+  with `PetscLogDefaultBegin()` if it is not running. The Jacobian is rebuilt at every iteration if PETSc is configured without logging.
+
+  The state of the policy persists through multiple nonlinear solves, so that with implicit time-stepping the Jacobian is reused over
+  several time steps as long as it pays off. It is reset by `SNESReset()`, and `SNESResetLagAdaptive()` forces the next rebuild.
+
+  An inexact Jacobian also slows down the nonlinear convergence, so the Jacobian is rebuilt as well when the last nonlinear iteration did not
+  reduce the residual norm by at least a factor of 10. This overrides `SNESSetLagJacobian()` and `SNESSetLagPreconditioner()`.
+
+.seealso: [](ch_snes), `SNES`, `SNESSetLagPreconditionerAdaptive()`, `SNESResetLagAdaptive()`, `SNESSetLagJacobian()`, `SNESSetLagJacobianPersists()`, `PetscLogEventGetPerfInfo()`
+@*/
+PetscErrorCode SNESSetLagJacobianAdaptive(SNES snes, PetscBool flg)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(snes, SNES_CLASSID, 1);
+  PetscValidLogicalCollectiveBool(snes, flg, 2);
+  if (flg) PetscCall(PetscLogDefaultBegin());
+  snes->lagjac_adaptive = flg;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+  SNESSetLagPreconditionerAdaptive - Set whether the preconditioner is rebuilt according to the measured cost of rebuilding it instead
+  of a fixed lag
+
+  Logically Collective
+
+  Input Parameters:
++ snes - the `SNES` context
+- flg  - `PETSC_TRUE` to rebuild the preconditioner adaptively
+
+  Options Database Key:
+. -snes_lag_preconditioner_adaptive <true,false> - rebuild the preconditioner adaptively
+
+  Level: advanced
+
+  Note:
+  The Jacobian is computed as set by `SNESSetLagJacobian()` and the preconditioner is rebuilt once the time of the linear iterations beyond
+  those of the first solve after the last rebuild exceeds the time of `PCSetUp()`. See `SNESSetLagJacobianAdaptive()` for the details.
+
+.seealso: [](ch_snes), `SNES`, `SNESSetLagJacobianAdaptive()`, `SNESSetLagPreconditioner()`, `SNESSetLagPreconditionerPersists()`
+@*/
+PetscErrorCode SNESSetLagPreconditionerAdaptive(SNES snes, PetscBool flg)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(snes, SNES_CLASSID, 1);
+  PetscValidLogicalCollectiveBool(snes, flg, 2);
+  if (flg) PetscCall(PetscLogDefaultBegin());
+  snes->lagpre_adaptive = flg;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+  SNESResetLagAdaptive - Forces the next decision of the adaptive lagging to rebuild the Jacobian, or only the preconditioner
+
+  Logically Collective
+
+  Input Parameter:
+. snes - the `SNES` context
+
+  Level: developer
+
+  Note:
+  This is called by `TSAdaptChoose()` when a time step is rejected, since an inexact Jacobian may have caused the rejection. The
+  linear iterations of the first solve after the rebuild become the new baseline. It has no effect unless `SNESSetLagJacobianAdaptive()`
+  or `SNESSetLagPreconditionerAdaptive()` is used.
+
+.seealso: [](ch_snes), `SNES`, `SNESSetLagJacobianAdaptive()`, `SNESSetLagPreconditionerAdaptive()`
+@*/
+PetscErrorCode SNESResetLagAdaptive(SNES snes)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(snes, SNES_CLASSID, 1);
+  snes->lag_cost = -1;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
   SNESSetForceIteration - force `SNESSolve()` to take at least one iteration regardless of the initial residual norm
 
@@ -4873,6 +5064,7 @@ PetscErrorCode SNESSolve(SNES snes, Vec b, Vec x)
 
     if (snes->lagjac_persist) snes->jac_iter += snes->iter;
     if (snes->lagpre_persist) snes->pre_iter += snes->iter;
+    if (snes->reason < 0) PetscCall(SNESResetLagAdaptive(snes)); /* an adaptively lagged Jacobian is rebuilt after a failure */
 
     PetscCall(PetscOptionsCreateViewer(PetscObjectComm((PetscObject)snes), ((PetscObject)snes)->options, ((PetscObject)snes)->prefix, "-snes_test_local_min", NULL, NULL, &flg));
     if (flg && !PetscPreLoadingOn) PetscCall(SNESTestLocalMin(snes));
@@ -334,6 +334,11 @@ PetscErrorCode FormJacobian(SNES snes, Vec x, Mat jac, Mat B, void *dummy)
       requires: kokkos_kernels
       args: -mat_type aijkokkos -vec_type kokkos
 
+   test:
+      suffix: interleave
+      args: -snes_monitor_short -snes_view -ksp_monitor -pc_vpbjacobi_interleave
+      filter: grep -v "type: seqaij"
+
    # this is just a test for SNESKSPTRASPOSEONLY and KSPSolveTranspose to behave properly
    # the solution is wrong on purpose
    test:
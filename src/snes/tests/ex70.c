@@ -0,0 +1,113 @@
+static char help[] = "Tests the adaptive lagging of the preconditioner when the linear iterations grow with a stale preconditioner.\n\n";
+
+/*
+  Solves F(x) = A x + x^3 - b = 0, with A = tridiag(-1, 2, -1) and b = 10, from x = 0. The Jacobian A + 3 diag(x^2) moves
+  away from A during the Newton iterations, so that a lagged preconditioner needs more and more linear iterations.
+
+  The operator is a MATSHELL applying the Jacobian, and each of its products sleeps -mult_sleep seconds. The linear
+  iterations beyond the baseline therefore cost much more than setting up the preconditioner again, and the decisions
+  of -snes_lag_preconditioner_adaptive do not depend on the speed of the machine.
+*/
+
+#include <petscsnes.h>
+
+typedef struct {
+  Mat       J;     /* assembled Jacobian, also used to construct the preconditioner */
+  PetscReal sleep; /* time spent in each product with the operator */
+} AppCtx;
+
+static PetscErrorCode FormFunction(SNES snes, Vec X, Vec F, void *ctx)
+{
+  const PetscScalar *x;
+  PetscScalar       *f;
+  PetscInt           n;
+
+  PetscFunctionBeginUser;
+  PetscCall(VecGetLocalSize(X, &n));
+  PetscCall(VecGetArrayRead(X, &x));
+  PetscCall(VecGetArray(F, &f));
+  for (PetscInt i = 0; i < n; i++) {
+    const PetscScalar xl = i > 0 ? x[i - 1] : 0, xr = i < n - 1 ? x[i + 1] : 0;
+
+    f[i] = 2 * x[i] - xl - xr + x[i] * x[i] * x[i] - 10;
+  }
+  PetscCall(VecRestoreArrayRead(X, &x));
+  PetscCall(VecRestoreArray(F, &f));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode FormJacobian(SNES snes, Vec X, Mat A, Mat B, void *ctx)
+{
+  const PetscScalar *x;
+  PetscInt           n;
+
+  PetscFunctionBeginUser;
+  PetscCall(VecGetLocalSize(X, &n));
+  PetscCall(VecGetArrayRead(X, &x));
+  for (PetscInt i = 0; i < n; i++) {
+    const PetscScalar v[3] = {-1, 2 + 3 * x[i] * x[i], -1};
+    const PetscInt    j[3] = {i - 1, i, i < n - 1 ? i + 1 : -1}; /* negative columns are ignored */
+
+    PetscCall(MatSetValues(B, 1, &i, 3, j, v, INSERT_VALUES));
+  }
+  PetscCall(VecRestoreArrayRead(X, &x));
+  PetscCall(MatAssemblyBegin(B, MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(B, MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyBegin(A, MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A, MAT_FINAL_ASSEMBLY));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MatMult_Slow(Mat A, Vec X, Vec Y)
+{
+  AppCtx *user;
+
+  PetscFunctionBeginUser;
+  PetscCall(MatShellGetContext(A, &user));
+  PetscCall(MatMult(user->J, X, Y));
+  PetscCall(PetscSleep(user->sleep));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+int main(int argc, char **argv)
+{
+  AppCtx   user;
+  SNES     snes;
+  Mat      A;
+  Vec      x;
+  PetscInt n = 64;
+
+  PetscFunctionBeginUser;
+  PetscCall(PetscInitialize(&argc, &argv, NULL, help));
+  user.sleep = 0.005;
+  PetscCall(PetscOptionsGetInt(NULL, NULL, "-n", &n, NULL));
+  PetscCall(PetscOptionsGetReal(NULL, NULL, "-mult_sleep", &user.sleep, NULL));
+
+  PetscCall(VecCreateSeq(PETSC_COMM_SELF, n, &x));
+  PetscCall(MatCreateSeqAIJ(PETSC_COMM_SELF, n, n, 3, NULL, &user.J));
+  PetscCall(MatCreateShell(PETSC_COMM_SELF, n, n, n, n, &user, &A));
+  PetscCall(MatShellSetOperation(A, MATOP_MULT, (void (*)(void))MatMult_Slow));
+
+  PetscCall(SNESCreate(PETSC_COMM_SELF, &snes));
+  PetscCall(SNESSetFunction(snes, NULL, FormFunction, NULL));
+  PetscCall(SNESSetJacobian(snes, A, user.J, FormJacobian, NULL));
+  PetscCall(SNESSetFromOptions(snes));
+  PetscCall(VecSet(x, 0));
+  PetscCall(SNESSolve(snes, NULL, x));
+
+  PetscCall(SNESDestroy(&snes));
+  PetscCall(MatDestroy(&A));
+  PetscCall(MatDestroy(&user.J));
+  PetscCall(VecDestroy(&x));
+  PetscCall(PetscFinalize());
+  return 0;
+}
+
+/*TEST
+
+  test:
+    requires: !single
+    args: -snes_lag_preconditioner_adaptive -ksp_type gmres -pc_type lu -snes_converged_reason -info :snes
+    filter: grep -E "Rebuilding|Reusing|CONVERGED" | cut -d, -f1-2
+
+TEST*/
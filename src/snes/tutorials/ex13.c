@@ -541,6 +541,16 @@ int main(int argc, char **argv)
     # Using -dm_refine 2 -convest_num_refine 3 we get L_2 convergence rate: 2.9
     suffix: 2d_q2_conv
     args: -dm_plex_simplex 0 -potential_petscspace_degree 2 -snes_convergence_estimate -convest_num_refine 2
+  test:
+    # Without OpenMP and thread safety the thread ranges are integrated one after another
+    suffix: 2d_q2_conv_threads
+    output_file: output/ex13_2d_q2_conv.out
+    args: -dm_plex_simplex 0 -potential_petscspace_degree 2 -snes_convergence_estimate -convest_num_refine 2 -dm_plex_fem_num_threads 3
+  test:
+    suffix: 2d_q2_conv_threads_omp
+    requires: openmp threadsafety
+    output_file: output/ex13_2d_q2_conv.out
+    args: -dm_plex_simplex 0 -potential_petscspace_degree 2 -snes_convergence_estimate -convest_num_refine 2 -dm_plex_fem_num_threads 3 -omp_num_threads 3
   test:
     # Using -dm_refine 2 -convest_num_refine 3 we get L_2 convergence rate: 3.9
     suffix: 2d_q3_conv
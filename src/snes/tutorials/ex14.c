@@ -51,6 +51,7 @@ typedef struct {
 */
 extern PetscErrorCode FormFunctionLocal(SNES, Vec, Vec, void *);
 extern PetscErrorCode FormFunction(SNES, Vec, Vec, void *);
+extern PetscErrorCode FormFunctionBatch(SNES, PetscInt, Vec[], Vec[], void *);
 extern PetscErrorCode FormInitialGuess(AppCtx *, Vec);
 extern PetscErrorCode FormJacobian(SNES, Vec, Mat, Mat, void *);
 
@@ -62,7 +63,7 @@ int main(int argc, char **argv)
   AppCtx        user;     /* user-defined work context */
   PetscInt      its;      /* iterations for convergence */
   MatFDColoring matfdcoloring = NULL;
-  PetscBool     matrix_free = PETSC_FALSE, coloring = PETSC_FALSE, coloring_ds = PETSC_FALSE, local_coloring = PETSC_FALSE;
+  PetscBool     matrix_free = PETSC_FALSE, coloring = PETSC_FALSE, coloring_ds = PETSC_FALSE, local_coloring = PETSC_FALSE, batch_coloring = PETSC_FALSE;
   PetscReal     bratu_lambda_max = 6.81, bratu_lambda_min = 0., fnorm;
 
   /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -113,6 +114,7 @@ int main(int argc, char **argv)
                          but use matrix-free approx for Jacobian-vector
                          products within Newton-Krylov method
      -fdcoloring : using finite differences with coloring to compute the Jacobian
+     -fdcoloring_batch : evaluate the function at the perturbed points of several colors at once
 
      Note one can use -matfd_coloring wp or ds the only reason for the -fdcoloring_ds option
      below is to test the call to MatFDColoringSetType().
@@ -121,6 +123,7 @@ int main(int argc, char **argv)
   PetscCall(PetscOptionsGetBool(NULL, NULL, "-fdcoloring", &coloring, NULL));
   PetscCall(PetscOptionsGetBool(NULL, NULL, "-fdcoloring_ds", &coloring_ds, NULL));
   PetscCall(PetscOptionsGetBool(NULL, NULL, "-fdcoloring_local", &local_coloring, NULL));
+  PetscCall(PetscOptionsGetBool(NULL, NULL, "-fdcoloring_batch", &batch_coloring, NULL));
   if (!matrix_free) {
     PetscCall(DMSetMatType(user.da, MATAIJ));
     PetscCall(DMCreateMatrix(user.da, &J));
@@ -130,6 +133,7 @@ int main(int argc, char **argv)
         PetscCall(DMCreateColoring(user.da, IS_COLORING_GLOBAL, &iscoloring));
         PetscCall(MatFDColoringCreate(J, iscoloring, &matfdcoloring));
         PetscCall(MatFDColoringSetFunction(matfdcoloring, (MatFDColoringFn *)FormFunction, &user));
+        if (batch_coloring) PetscCall(MatFDColoringSetBatchFunction(matfdcoloring, (MatFDColoringBatchFn *)FormFunctionBatch, &user));
       } else {
         PetscCall(DMCreateColoring(user.da, IS_COLORING_LOCAL, &iscoloring));
         PetscCall(MatFDColoringCreate(J, iscoloring, &matfdcoloring));
@@ -367,6 +371,42 @@ PetscErrorCode FormFunction(SNES snes, Vec X, Vec F, void *ptr)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 /* ------------------------------------------------------------------- */
+/*
+   FormFunctionBatch - Evaluates nonlinear function, F(x) on the entire domain, at several points
+
+   The ghost point update of each point overlaps the evaluation at the previous point,
+   see MatFDColoringSetBatchFunction().
+
+   Input Parameters:
+.  snes - the SNES context
+.  n - the number of points
+.  X - input vectors
+.  ptr - optional user-defined context, as set by MatFDColoringSetBatchFunction()
+
+   Output Parameter:
+.  F - function vectors
+ */
+PetscErrorCode FormFunctionBatch(SNES snes, PetscInt n, Vec X[], Vec F[], void *ptr)
+{
+  Vec *localX;
+  DM   da;
+
+  PetscFunctionBeginUser;
+  PetscCall(SNESGetDM(snes, &da));
+  PetscCall(PetscMalloc1(n, &localX));
+  for (PetscInt i = 0; i < n; i++) PetscCall(DMGetLocalVector(da, &localX[i]));
+  /* the ghost update of the next point is in transit while the function is evaluated at the current one */
+  if (n) PetscCall(DMGlobalToLocalBegin(da, X[0], INSERT_VALUES, localX[0]));
+  for (PetscInt i = 0; i < n; i++) {
+    PetscCall(DMGlobalToLocalEnd(da, X[i], INSERT_VALUES, localX[i]));
+    if (i + 1 < n) PetscCall(DMGlobalToLocalBegin(da, X[i + 1], INSERT_VALUES, localX[i + 1]));
+    PetscCall(FormFunctionLocal(snes, localX[i], F[i], ptr));
+    PetscCall(DMRestoreLocalVector(da, &localX[i]));
+  }
+  PetscCall(PetscFree(localX));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+/* ------------------------------------------------------------------- */
 /*
    FormJacobian - Evaluates Jacobian matrix.
 
@@ -523,6 +563,18 @@ PetscErrorCode FormJacobian(SNES snes, Vec X, Mat J, Mat jac, void *ptr)
       nsize: 4
       args: -fdcoloring -snes_monitor_short -ksp_gmres_cgs_refinement_type refine_always
 
+   test:
+      suffix: 3_batch
+      nsize: 4
+      args: -fdcoloring -fdcoloring_batch -mat_fd_coloring_bcols {{3 7}} -snes_monitor_short -ksp_gmres_cgs_refinement_type refine_always
+      output_file: output/ex14_3.out
+
+   test:
+      suffix: 3_ds_batch
+      nsize: 4
+      args: -fdcoloring -fdcoloring_batch -fdcoloring_ds -mat_fd_coloring_bcols 3 -snes_monitor_short -ksp_gmres_cgs_refinement_type refine_always
+      output_file: output/ex14_3_ds.out
+
    test:
       suffix: 3_ds
       nsize: 4
@@ -886,6 +886,20 @@ PetscErrorCode NonlinearGS(SNES snes, Vec X, Vec B, void *ctx)
       args: -ksp_type fgmres -pc_type fieldsplit -pc_fieldsplit_block_size 4 -pc_fieldsplit_type additive -pc_fieldsplit_0_fields 0,1,2 -pc_fieldsplit_1_fields 3 -fieldsplit_0_pc_type lu -fieldsplit_1_pc_type lu -snes_monitor_short -ksp_monitor_short
       requires: !single
 
+   test:
+      suffix: fieldsplit_subcomm
+      nsize: 3
+      args: -ksp_type fgmres -pc_type fieldsplit -pc_fieldsplit_block_size 4 -pc_fieldsplit_type additive -pc_fieldsplit_0_fields 0,1,2 -pc_fieldsplit_1_fields 3 -fieldsplit_0_pc_type redundant -fieldsplit_1_pc_type redundant -pc_fieldsplit_subcomm {{0 1}} -snes_monitor_short -ksp_monitor_short
+      output_file: output/ex19_fieldsplit_3.out
+      requires: !single
+
+   test:
+      suffix: fieldsplit_subcomm_view
+      nsize: 3
+      args: -ksp_type fgmres -pc_type fieldsplit -pc_fieldsplit_block_size 4 -pc_fieldsplit_type additive -pc_fieldsplit_0_fields 0,1,2 -pc_fieldsplit_1_fields 3 -fieldsplit_0_pc_type redundant -fieldsplit_1_pc_type redundant -pc_fieldsplit_subcomm -snes_view
+      filter: grep -E "Split number|KSP Object: \(fieldsplit_[01]_\)|sub-communicators"
+      requires: !single
+
    test:
       suffix: fieldsplit_4
       args: -ksp_type fgmres -pc_type fieldsplit -pc_fieldsplit_block_size 4 -pc_fieldsplit_type SCHUR -pc_fieldsplit_0_fields 0,1,2 -pc_fieldsplit_1_fields 3 -fieldsplit_0_pc_type lu -fieldsplit_1_pc_type lu -snes_monitor_short -ksp_monitor_short
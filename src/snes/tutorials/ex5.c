@@ -459,6 +459,44 @@ static PetscErrorCode FormJacobianLocal(DMDALocalInfo *info, PetscScalar **x, Ma
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   FormJacobianTangentLocal - Evaluates the derivatives of FormFunctionLocal() along k directions at once on local process patch
+*/
+static PetscErrorCode FormJacobianTangentLocal(DMDALocalInfo *info, PetscInt k, PetscScalar **x, PetscScalar ***dx, PetscScalar ***df, AppCtx *user)
+{
+  PetscInt    i, j, c;
+  PetscReal   lambda, hx, hy, hxdhy, hydhx;
+  PetscScalar sc, du, due, duw, dun, dus;
+
+  PetscFunctionBeginUser;
+  lambda = user->param;
+  hx     = 1.0 / (PetscReal)(info->mx - 1);
+  hy     = 1.0 / (PetscReal)(info->my - 1);
+  hxdhy  = hx / hy;
+  hydhx  = hy / hx;
+  for (j = info->ys; j < info->ys + info->ym; j++) {
+    for (i = info->xs; i < info->xs + info->xm; i++) {
+      if (i == 0 || j == 0 || i == info->mx - 1 || j == info->my - 1) {
+        for (c = 0; c < k; c++) df[j][i][c] = 2.0 * (hydhx + hxdhy) * dx[j][i][c];
+      } else {
+        sc = hx * hy * lambda * PetscExpScalar(x[j][i]);
+        for (c = 0; c < k; c++) {
+          /* the boundary values of the neighbors do not depend on the state */
+          du  = dx[j][i][c];
+          duw = i - 1 == 0 ? 0.0 : dx[j][i - 1][c];
+          due = i + 1 == info->mx - 1 ? 0.0 : dx[j][i + 1][c];
+          dun = j - 1 == 0 ? 0.0 : dx[j - 1][i][c];
+          dus = j + 1 == info->my - 1 ? 0.0 : dx[j + 1][i][c];
+
+          df[j][i][c] = (2.0 * du - duw - due) * hydhx + (2.0 * du - dun - dus) * hxdhy - sc * du;
+        }
+      }
+    }
+  }
+  PetscCall(PetscLogFlops((11.0 * k + 1.0) * info->ym * info->xm));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode FormFunctionMatlab(SNES snes, Vec X, Vec F, void *ptr)
 {
 #if PetscDefined(HAVE_MATLAB)
@@ -620,7 +658,7 @@ int main(int argc, char **argv)
   PetscReal bratu_lambda_max = 6.81;
   PetscReal bratu_lambda_min = 0.;
   PetscInt  MMS              = 1;
-  PetscBool flg              = PETSC_FALSE, setMMS;
+  PetscBool flg              = PETSC_FALSE, setMMS, tangent = PETSC_FALSE;
   DM        da;
   Vec       r = NULL;
   KSP       ksp;
@@ -697,9 +735,14 @@ int main(int argc, char **argv)
   default:
     SETERRQ(PETSC_COMM_WORLD, PETSC_ERR_USER, "Unknown MMS type %" PetscInt_FMT, MMS);
   }
-  PetscCall(DMDASNESSetFunctionLocal(da, INSERT_VALUES, (DMDASNESFunctionFn *)FormFunctionLocal, &user));
+  PetscCall(PetscOptionsGetBool(NULL, NULL, "-split", &flg, NULL));
+  if (flg) PetscCall(DMDASNESSetFunctionLocalSplit(da, (DMDASNESFunctionFn *)FormFunctionLocal, NULL, &user));
+  else PetscCall(DMDASNESSetFunctionLocal(da, INSERT_VALUES, (DMDASNESFunctionFn *)FormFunctionLocal, &user));
+  flg = PETSC_FALSE;
   PetscCall(PetscOptionsGetBool(NULL, NULL, "-fd", &flg, NULL));
-  if (!flg) PetscCall(DMDASNESSetJacobianLocal(da, (DMDASNESJacobianFn *)FormJacobianLocal, &user));
+  PetscCall(PetscOptionsGetBool(NULL, NULL, "-tangent", &tangent, NULL));
+  if (tangent) PetscCall(DMDASNESSetJacobianLocalTangent(da, (DMDASNESTangentFn *)FormJacobianTangentLocal, &user));
+  else if (!flg) PetscCall(DMDASNESSetJacobianLocal(da, (DMDASNESJacobianFn *)FormJacobianLocal, &user));
 
   PetscCall(PetscOptionsGetBool(NULL, NULL, "-obj", &flg, NULL));
   if (flg) PetscCall(DMDASNESSetObjectiveLocal(da, (DMDASNESObjectiveFn *)FormObjectiveLocal, &user));
@@ -853,10 +896,26 @@ int main(int argc, char **argv)
      nsize: 2
      args: -snes_grid_sequence 2 -snes_monitor_short -ksp_converged_reason -snes_converged_reason -snes_view -pc_type mg -snes_atol 0 -ksp_atol 0
 
+   test:
+     suffix: split
+     nsize: 4
+     args: -da_grid_x 33 -da_grid_y 33 -snes_monitor_short -ksp_converged_reason -snes_converged_reason -pc_type mg -pc_mg_levels 3 -split
+
+   test:
+     suffix: cheby_refresh
+     nsize: 2
+     args: -da_grid_x 33 -da_grid_y 33 -par 6 -snes_monitor_short -ksp_converged_reason -snes_converged_reason -pc_type mg -pc_mg_levels 4 -mg_levels_ksp_chebyshev_esteig_refresh 3 -pc_mg_smooths_autotune 4
+
    test:
      suffix: 5_anderson
      args: -da_grid_x 81 -da_grid_y 81 -snes_monitor_short -snes_max_it 50 -par 6.0 -snes_type anderson
 
+   test:
+     suffix: 5_anderson_tsqr
+     nsize: {{1 2}}
+     args: -da_grid_x 81 -da_grid_y 81 -snes_monitor_short -snes_max_it 50 -par 6.0 -snes_type anderson -snes_anderson_tsqr
+     output_file: output/ex5_5_anderson.out
+
    test:
      suffix: 5_aspin
      nsize: 4
@@ -884,6 +943,12 @@ int main(int argc, char **argv)
      suffix: 5_ls
      args: -da_grid_x 81 -da_grid_y 81 -snes_monitor_short -snes_max_it 50 -par 6.0 -snes_type newtonls
 
+   test:
+     suffix: 5_ls_tangent
+     nsize: {{1 2}}
+     args: -da_grid_x 81 -da_grid_y 81 -snes_monitor_short -snes_max_it 50 -par 6.0 -snes_type newtonls -tangent
+     output_file: output/ex5_5_ls.out
+
    test:
      suffix: 5_ls_sell_sor
      args: -da_grid_x 81 -da_grid_y 81 -snes_monitor_short -snes_max_it 50 -par 6.0 -snes_type newtonls -dm_mat_type sell -pc_type sor
@@ -894,6 +959,34 @@ int main(int argc, char **argv)
      nsize: 4
      args: -snes_monitor_short -snes_converged_reason -da_refine 4 -da_overlap 3 -snes_type nasm -snes_nasm_type restrict -snes_max_it 10
 
+   test:
+     # Without OpenMP and thread safety -snes_nasm_threaded 1 solves the subdomain problems one after another
+     suffix: 5_nasm_subdomains
+     nsize: 2
+     args: -snes_monitor_short -snes_converged_reason -da_refine 3 -da_overlap 1 -da_local_subdomains 8 -snes_type nasm -snes_nasm_type restrict -snes_max_it 10 -snes_nasm_threaded {{0 1}}
+     output_file: output/ex5_5_nasm_subdomains.out
+
+   test:
+     suffix: 5_nasm_subdomains_omp
+     requires: openmp threadsafety
+     nsize: 2
+     args: -snes_monitor_short -snes_converged_reason -da_refine 3 -da_overlap 1 -da_local_subdomains 8 -snes_type nasm -snes_nasm_type restrict -snes_max_it 10 -snes_nasm_threaded -omp_num_threads 4
+     output_file: output/ex5_5_nasm_subdomains.out
+
+   test:
+     # Without OpenMP and thread safety -npc_snes_nasm_threaded 1 solves the subdomain problems one after another
+     suffix: 5_aspin_subdomains
+     nsize: 2
+     args: -snes_monitor_short -snes_converged_reason -da_refine 3 -da_overlap 1 -da_local_subdomains 8 -snes_type aspin -npc_sub_pc_type lu -npc_sub_ksp_type preonly -npc_snes_nasm_threaded {{0 1}}
+     output_file: output/ex5_5_aspin_subdomains.out
+
+   test:
+     suffix: 5_aspin_subdomains_omp
+     requires: openmp threadsafety
+     nsize: 2
+     args: -snes_monitor_short -snes_converged_reason -da_refine 3 -da_overlap 1 -da_local_subdomains 8 -snes_type aspin -npc_sub_pc_type lu -npc_sub_ksp_type preonly -npc_snes_nasm_threaded -omp_num_threads 4
+     output_file: output/ex5_5_aspin_subdomains.out
+
    test:
      suffix: 5_ncg
      args: -da_grid_x 81 -da_grid_y 81 -snes_monitor_short -snes_max_it 50 -par 6.0 -snes_type ncg -snes_ncg_type fr
@@ -914,6 +1007,12 @@ int main(int argc, char **argv)
      suffix: 5_ngmres
      args: -da_grid_x 81 -da_grid_y 81 -snes_monitor_short -snes_max_it 50 -par 6.0 -snes_type ngmres -snes_ngmres_m 10
 
+   test:
+     suffix: 5_ngmres_tsqr
+     nsize: {{1 2}}
+     args: -da_grid_x 81 -da_grid_y 81 -snes_monitor_short -snes_max_it 50 -par 6.0 -snes_type ngmres -snes_ngmres_m 10 -snes_ngmres_tsqr
+     output_file: output/ex5_5_ngmres.out
+
    test:
      suffix: 5_ngmres_fas
      args: -snes_rtol 1.e-4 -snes_type ngmres -npc_fas_coarse_snes_max_it 1 -npc_fas_coarse_snes_type newtonls -npc_fas_coarse_pc_type lu -npc_fas_coarse_ksp_type preonly -snes_ngmres_m 10 -snes_monitor_short -npc_snes_max_it 1 -npc_snes_type fas -npc_fas_coarse_ksp_type richardson -da_refine 6
@@ -935,6 +1034,12 @@ int main(int argc, char **argv)
      suffix: 5_qn
      args: -da_grid_x 81 -da_grid_y 81 -snes_monitor_short -snes_max_it 50 -par 6.0 -snes_type qn -snes_linesearch_type cp -snes_qn_m 10
 
+   test:
+     suffix: 5_qn_compact_dense
+     nsize: {{1 2}}
+     args: -da_grid_x 81 -da_grid_y 81 -snes_monitor_short -snes_max_it 50 -par 6.0 -snes_type qn -snes_linesearch_type cp -snes_qn_m 10 -qn_mat_lmvm_mult_algorithm compact_dense
+     output_file: output/ex5_5_qn.out
+
    test:
      suffix: 6
      nsize: 4
@@ -8,6 +8,7 @@ typedef struct {
   DMDASNESFunctionFn  *residuallocal;
   DMDASNESJacobianFn  *jacobianlocal;
   DMDASNESObjectiveFn *objectivelocal;
+  DMDASNESTangentFn   *jacobianlocaltangent;
 
   /* Vec version for vector data */
   DMDASNESFunctionVecFn  *residuallocalvec;
@@ -20,6 +21,10 @@ typedef struct {
   void      *objectivelocalctx;
   InsertMode residuallocalimode;
 
+  /* split-phase residual, residuallocal is then the interior kernel */
+  PetscBool           residuallocalsplit;
+  DMDASNESFunctionFn *residuallocalboundary;
+
   /*   For Picard iteration defined locally */
   PetscErrorCode (*rhsplocal)(DMDALocalInfo *, void *, void *, void *);
   PetscErrorCode (*jacobianplocal)(DMDALocalInfo *, void *, Mat, Mat, void *);
@@ -54,6 +59,79 @@ static PetscErrorCode DMDASNESGetContext(DM dm, DMSNES sdm, DMSNES_DA **dmdasnes
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/* Restrict the owned box of info to [xs, xe) x [ys, ye) x [zs, ze) */
+static void DMDALocalInfoRestrict_Private(const DMDALocalInfo *info, PetscInt xs, PetscInt xe, PetscInt ys, PetscInt ye, PetscInt zs, PetscInt ze, DMDALocalInfo *sub)
+{
+  *sub    = *info;
+  sub->xs = xs;
+  sub->xm = xe - xs;
+  sub->ys = ys;
+  sub->ym = ye - ys;
+  sub->zs = zs;
+  sub->zm = ze - zs;
+}
+
+/*
+  Evaluates the residual in two phases: the interior kernel runs on the owned points that are at least a stencil width away from
+  any neighboring process, reading the owned part of X, while the ghost values are communicated. The boundary kernel then runs on
+  the remaining strips of the owned box, reading the ghosted local vector.
+*/
+static PetscErrorCode SNESComputeFunction_DMDA_Split(SNES snes, DM dm, DMSNES_DA *dmdasnes, Vec X, Vec F, void *rctx)
+{
+  DMDASNESFunctionFn *bfunc = dmdasnes->residuallocalboundary ? dmdasnes->residuallocalboundary : dmdasnes->residuallocal;
+  DMDALocalInfo       info, sub, strips[6];
+  PetscInt            xs, xe, ys, ye, zs, ze, ixs, ixe, iys, iye, izs, ize, Ns = 0;
+  Vec                 Xloc;
+  void               *x, *f;
+
+  PetscFunctionBegin;
+  PetscCheck(dmdasnes->residuallocalimode == INSERT_VALUES, PetscObjectComm((PetscObject)snes), PETSC_ERR_ARG_INCOMP, "Split-phase residual evaluation requires INSERT_VALUES");
+  PetscCall(DMDAGetLocalInfo(dm, &info));
+  xs  = info.xs;
+  xe  = info.xs + info.xm;
+  ys  = info.ys;
+  ye  = info.ys + info.ym;
+  zs  = info.zs;
+  ze  = info.zs + info.zm;
+  ixs = info.gxs < xs ? xs + info.sw : xs;
+  ixe = info.gxs + info.gxm > xe ? xe - info.sw : xe;
+  iys = info.gys < ys ? ys + info.sw : ys;
+  iye = info.gys + info.gym > ye ? ye - info.sw : ye;
+  izs = info.gzs < zs ? zs + info.sw : zs;
+  ize = info.gzs + info.gzm > ze ? ze - info.sw : ze;
+  if (ixs >= ixe || iys >= iye || izs >= ize) {
+    /* no interior, the whole owned box is one strip */
+    DMDALocalInfoRestrict_Private(&info, xs, xe, ys, ye, zs, ze, &strips[Ns++]);
+    ixs = ixe = xs;
+  } else {
+    if (xs < ixs) DMDALocalInfoRestrict_Private(&info, xs, ixs, ys, ye, zs, ze, &strips[Ns++]);
+    if (ixe < xe) DMDALocalInfoRestrict_Private(&info, ixe, xe, ys, ye, zs, ze, &strips[Ns++]);
+    if (ys < iys) DMDALocalInfoRestrict_Private(&info, ixs, ixe, ys, iys, zs, ze, &strips[Ns++]);
+    if (iye < ye) DMDALocalInfoRestrict_Private(&info, ixs, ixe, iye, ye, zs, ze, &strips[Ns++]);
+    if (zs < izs) DMDALocalInfoRestrict_Private(&info, ixs, ixe, iys, iye, zs, izs, &strips[Ns++]);
+    if (ize < ze) DMDALocalInfoRestrict_Private(&info, ixs, ixe, iys, iye, ize, ze, &strips[Ns++]);
+  }
+
+  PetscCall(DMGetLocalVector(dm, &Xloc));
+  PetscCall(PetscLogEventBegin(SNES_FunctionEval, snes, X, F, 0));
+  PetscCall(DMGlobalToLocalBegin(dm, X, INSERT_VALUES, Xloc));
+  PetscCall(DMDAVecGetArray(dm, F, &f));
+  if (ixs < ixe) {
+    DMDALocalInfoRestrict_Private(&info, ixs, ixe, iys, iye, izs, ize, &sub);
+    PetscCall(DMDAVecGetArrayRead(dm, X, &x));
+    PetscCallBack("SNES DMDA local callback function", (*dmdasnes->residuallocal)(&sub, x, f, rctx));
+    PetscCall(DMDAVecRestoreArrayRead(dm, X, &x));
+  }
+  PetscCall(DMGlobalToLocalEnd(dm, X, INSERT_VALUES, Xloc));
+  PetscCall(DMDAVecGetArrayRead(dm, Xloc, &x));
+  for (PetscInt s = 0; s < Ns; ++s) PetscCallBack("SNES DMDA local callback function", (*bfunc)(&strips[s], x, f, rctx));
+  PetscCall(DMDAVecRestoreArrayRead(dm, Xloc, &x));
+  PetscCall(DMDAVecRestoreArray(dm, F, &f));
+  PetscCall(PetscLogEventEnd(SNES_FunctionEval, snes, X, F, 0));
+  PetscCall(DMRestoreLocalVector(dm, &Xloc));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode SNESComputeFunction_DMDA(SNES snes, Vec X, Vec F, void *ctx)
 {
   DM            dm;
@@ -68,11 +146,16 @@ static PetscErrorCode SNESComputeFunction_DMDA(SNES snes, Vec X, Vec F, void *ct
   PetscValidHeaderSpecific(F, VEC_CLASSID, 3);
   PetscCheck(dmdasnes->residuallocal || dmdasnes->residuallocalvec, PetscObjectComm((PetscObject)snes), PETSC_ERR_PLIB, "Corrupt context");
   PetscCall(SNESGetDM(snes, &dm));
+  rctx = dmdasnes->residuallocalctx ? dmdasnes->residuallocalctx : snes->ctx;
+  if (dmdasnes->residuallocalsplit) {
+    PetscCall(SNESComputeFunction_DMDA_Split(snes, dm, dmdasnes, X, F, rctx));
+    PetscCall(VecFlag(F, snes->domainerror));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   PetscCall(DMGetLocalVector(dm, &Xloc));
   PetscCall(DMGlobalToLocalBegin(dm, X, INSERT_VALUES, Xloc));
   PetscCall(DMGlobalToLocalEnd(dm, X, INSERT_VALUES, Xloc));
   PetscCall(DMDAGetLocalInfo(dm, &info));
-  rctx = dmdasnes->residuallocalctx ? dmdasnes->residuallocalctx : snes->ctx;
   switch (dmdasnes->residuallocalimode) {
   case INSERT_VALUES: {
     PetscCall(PetscLogEventBegin(SNES_FunctionEval, snes, X, F, 0));
@@ -143,6 +226,93 @@ static PetscErrorCode SNESComputeObjective_DMDA(SNES snes, Vec X, PetscReal *ob,
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+  Assembles B from the directional derivatives of the residual along the seed directions of a local coloring of dm, all
+  computed by one call to the tangent callback. The tangents of each point are stored innermost in a DMDA with dof*k
+  fields, so that df is directly the compressed color format expected by MatFDColoringSetValues() once transposed.
+  The coloring is only computed at the first call, the MatFDColoring, the DMDA of the tangents and the seed directions
+  built from it are kept on dm.
+*/
+static PetscErrorCode SNESComputeJacobian_DMDA_Tangent(SNES snes, DM dm, Vec X, Mat B, DMSNES_DA *dmdasnes, void *jctx)
+{
+  DM                 tdm;
+  MatFDColoring      fdcoloring;
+  DMDALocalInfo      info;
+  Vec                Xloc, dXloc, dF;
+  PetscInt           k, dof, tdof, m;
+  PetscScalar       *y;
+  const PetscScalar *df;
+  void              *x, *dxa, *dfa;
+
+  PetscFunctionBegin;
+  PetscCall(DMDAGetInfo(dm, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &dof, NULL, NULL, NULL, NULL, NULL));
+  PetscCall(PetscObjectQuery((PetscObject)dm, "DMDASNES_TANGENTCOLORING", (PetscObject *)&fdcoloring));
+  if (!fdcoloring) {
+    ISColoring             coloring;
+    const ISColoringValue *colors;
+    PetscInt               n, nl;
+    PetscScalar           *dx;
+
+    PetscCall(DMCreateColoring(dm, IS_COLORING_LOCAL, &coloring));
+    PetscCall(ISColoringGetColors(coloring, &nl, &k, &colors));
+    PetscCall(DMGetLocalVector(dm, &Xloc));
+    PetscCall(VecGetLocalSize(Xloc, &n));
+    PetscCall(DMRestoreLocalVector(dm, &Xloc));
+    PetscCheck(n == nl, PetscObjectComm((PetscObject)snes), PETSC_ERR_SUP, "DMDASNESSetJacobianLocalTangent() requires a coloring of each degree of freedom, not of the blocks");
+    PetscCall(MatFDColoringCreate(B, coloring, &fdcoloring));
+    PetscCall(MatFDColoringSetBlockSize(fdcoloring, PETSC_DEFAULT, k));
+    PetscCall(MatFDColoringSetUp(B, coloring, fdcoloring));
+    PetscCall(PetscObjectCompose((PetscObject)dm, "DMDASNES_TANGENTCOLORING", (PetscObject)fdcoloring));
+    PetscCall(PetscObjectDereference((PetscObject)fdcoloring));
+    PetscCall(DMDACreateCompatibleDMDA(dm, dof * k, &tdm));
+    PetscCall(PetscObjectCompose((PetscObject)dm, "DMDASNES_TANGENTDM", (PetscObject)tdm));
+    PetscCall(PetscObjectDereference((PetscObject)tdm));
+
+    /* seed direction c with the unit vectors of all the degrees of freedom of color c, ghost points included */
+    PetscCall(DMCreateLocalVector(tdm, &dXloc));
+    PetscCall(VecGetArrayWrite(dXloc, &dx));
+    for (PetscInt i = 0; i < n; i++) {
+      for (PetscInt c = 0; c < k; c++) dx[i * k + c] = 0.0;
+      dx[i * k + colors[i]] = 1.0;
+    }
+    PetscCall(VecRestoreArrayWrite(dXloc, &dx));
+    PetscCall(PetscObjectCompose((PetscObject)dm, "DMDASNES_TANGENTSEED", (PetscObject)dXloc));
+    PetscCall(VecDestroy(&dXloc));
+    PetscCall(ISColoringDestroy(&coloring));
+  }
+  PetscCall(PetscObjectQuery((PetscObject)dm, "DMDASNES_TANGENTDM", (PetscObject *)&tdm));
+  PetscCall(PetscObjectQuery((PetscObject)dm, "DMDASNES_TANGENTSEED", (PetscObject *)&dXloc));
+  PetscCall(DMDAGetInfo(tdm, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &tdof, NULL, NULL, NULL, NULL, NULL));
+  k = tdof / dof;
+
+  PetscCall(DMGetLocalVector(dm, &Xloc));
+  PetscCall(DMGlobalToLocalBegin(dm, X, INSERT_VALUES, Xloc));
+  PetscCall(DMGlobalToLocalEnd(dm, X, INSERT_VALUES, Xloc));
+  PetscCall(DMGetGlobalVector(tdm, &dF));
+  PetscCall(DMDAGetLocalInfo(dm, &info));
+  PetscCall(DMDAVecGetArray(dm, Xloc, &x));
+  PetscCall(DMDAVecGetArrayDOF(tdm, dXloc, &dxa));
+  PetscCall(DMDAVecGetArrayDOF(tdm, dF, &dfa));
+  PetscCallBack("SNES DMDA local callback tangent", (*dmdasnes->jacobianlocaltangent)(&info, k, x, dxa, dfa, jctx));
+  PetscCall(DMDAVecRestoreArrayDOF(tdm, dF, &dfa));
+  PetscCall(DMDAVecRestoreArrayDOF(tdm, dXloc, &dxa));
+  PetscCall(DMDAVecRestoreArray(dm, Xloc, &x));
+  PetscCall(DMRestoreLocalVector(dm, &Xloc));
+
+  /* the tangents are interlaced per row, MatFDColoringSetValues() wants them one color per column */
+  PetscCall(MatGetLocalSize(B, &m, NULL));
+  PetscCall(PetscMalloc1(m * k, &y));
+  PetscCall(VecGetArrayRead(dF, &df));
+  for (PetscInt r = 0; r < m; r++) {
+    for (PetscInt c = 0; c < k; c++) y[c * m + r] = df[r * k + c];
+  }
+  PetscCall(VecRestoreArrayRead(dF, &df));
+  PetscCall(DMRestoreGlobalVector(tdm, &dF));
+  PetscCall(MatFDColoringSetValues(B, fdcoloring, y));
+  PetscCall(PetscFree(y));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /* Routine is called by example, hence must be labeled PETSC_EXTERN */
 PETSC_EXTERN PetscErrorCode SNESComputeJacobian_DMDA(SNES snes, Vec X, Mat A, Mat B, void *ctx)
 {
@@ -168,6 +338,8 @@ PETSC_EXTERN PetscErrorCode SNESComputeJacobian_DMDA(SNES snes, Vec X, Mat A, Ma
       PetscCall(DMDAVecRestoreArray(dm, Xloc, &x));
     }
     PetscCall(DMRestoreLocalVector(dm, &Xloc));
+  } else if (dmdasnes->jacobianlocaltangent) {
+    PetscCall(SNESComputeJacobian_DMDA_Tangent(snes, dm, X, B, dmdasnes, jctx));
   } else {
     MatFDColoring fdcoloring;
     PetscCall(PetscObjectQuery((PetscObject)dm, "DMDASNES_FDCOLORING", (PetscObject *)&fdcoloring));
@@ -242,6 +414,62 @@ PetscErrorCode DMDASNESSetFunctionLocal(DM dm, InsertMode imode, PetscErrorCode
   dmdasnes->residuallocalimode = imode;
   dmdasnes->residuallocal      = func;
   dmdasnes->residuallocalctx   = ctx;
+  dmdasnes->residuallocalsplit = PETSC_FALSE;
+
+  PetscCall(DMSNESSetFunction(dm, SNESComputeFunction_DMDA, dmdasnes));
+  if (!sdm->ops->computejacobian) { /* Call us for the Jacobian too, can be overridden by the user. */
+    PetscCall(DMSNESSetJacobian(dm, SNESComputeJacobian_DMDA, dmdasnes));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@C
+  DMDASNESSetFunctionLocalSplit - set local residual evaluation functions for use with `DMDA` that allow the interior of each
+  process's subdomain to be computed while the ghost values are being communicated
+
+  Logically Collective
+
+  Input Parameters:
++ dm       - `DM` to associate callback with
+. interior - local residual evaluation for the interior of the subdomain
+. boundary - local residual evaluation for the strips along the process boundary, or `NULL` to use `interior`
+- ctx      - optional context for local residual evaluation
+
+  Calling sequence of `interior` and `boundary`:
++ info - `DMDALocalInfo` whose owned box (`xs`, `xm`, etc.) is the part of the subdomain to evaluate the residual on
+. x    - dimensional pointer to state at which to evaluate residual (e.g. PetscScalar *x or **x or ***x)
+. f    - dimensional pointer to residual, write the residual here (e.g. PetscScalar *f or **f or ***f)
+- ctx  - optional context passed above
+
+  Level: intermediate
+
+  Notes:
+  The residual is computed at the owned points only, as with `INSERT_VALUES` in `DMDASNESSetFunctionLocal()`. Either function must
+  only write `f` at the points of the owned box in `info` and only read `x` within the stencil width of them.
+
+  After `DMGlobalToLocalBegin()` is started, `interior` is called on the owned points that are at least the stencil width away from
+  every neighboring process. There `x` is the owned (not ghosted) part of the state, so no ghost values may be read. After
+  `DMGlobalToLocalEnd()`, `boundary` is called on each of the remaining strips of the owned box with the ghosted state. A function
+  written for `DMDASNESSetFunctionLocal()` that loops over the owned box of `info` can be passed as both.
+
+.seealso: [](ch_snes), `DMDA`, `DMDASNESSetFunctionLocal()`, `DMDASNESSetJacobianLocal()`, `DMSNESSetFunction()`, `DMGlobalToLocalBegin()`
+@*/
+PetscErrorCode DMDASNESSetFunctionLocalSplit(DM dm, PetscErrorCode (*interior)(DMDALocalInfo *info, void *x, void *f, void *ctx), PetscErrorCode (*boundary)(DMDALocalInfo *info, void *x, void *f, void *ctx), void *ctx)
+{
+  DMSNES     sdm;
+  DMSNES_DA *dmdasnes;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(dm, DM_CLASSID, 1);
+  PetscCall(DMGetDMSNESWrite(dm, &sdm));
+  PetscCall(DMDASNESGetContext(dm, sdm, &dmdasnes));
+
+  dmdasnes->residuallocalimode    = INSERT_VALUES;
+  dmdasnes->residuallocal         = interior;
+  dmdasnes->residuallocalboundary = boundary;
+  dmdasnes->residuallocalvec      = NULL;
+  dmdasnes->residuallocalctx      = ctx;
+  dmdasnes->residuallocalsplit    = PETSC_TRUE;
 
   PetscCall(DMSNESSetFunction(dm, SNESComputeFunction_DMDA, dmdasnes));
   if (!sdm->ops->computejacobian) { /* Call us for the Jacobian too, can be overridden by the user. */
@@ -284,6 +512,7 @@ PetscErrorCode DMDASNESSetFunctionLocalVec(DM dm, InsertMode imode, PetscErrorCo
   dmdasnes->residuallocalimode = imode;
   dmdasnes->residuallocalvec   = func;
   dmdasnes->residuallocalctx   = ctx;
+  dmdasnes->residuallocalsplit = PETSC_FALSE;
 
   PetscCall(DMSNESSetFunction(dm, SNESComputeFunction_DMDA, dmdasnes));
   if (!sdm->ops->computejacobian) { /* Call us for the Jacobian too, can be overridden by the user. */
@@ -333,6 +562,62 @@ PetscErrorCode DMDASNESSetJacobianLocal(DM dm, PetscErrorCode (*func)(DMDALocalI
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@C
+  DMDASNESSetJacobianLocalTangent - set a local function computing directional derivatives of the residual, from which
+  the exact Jacobian is assembled for use with `DMDA`
+
+  Logically Collective
+
+  Input Parameters:
++ dm   - `DM` to associate callback with
+. func - local evaluation of the derivatives of the residual, in forward mode, along `k` directions at once
+- ctx  - optional context for `func`
+
+  Calling sequence of `func`:
++ info - `DMDALocalInfo` defining the subdomain to evaluate the derivatives on
+. k    - the number of directions
+. x    - dimensional pointer to state at which to evaluate the derivatives (e.g. PetscScalar *x or **x or ***x)
+. dx   - dimensional pointer to the ghosted directions, with `dof`*`k` values per grid point (e.g. PetscScalar **dx or ***dx or ****dx), must not be modified
+. df   - dimensional pointer to the derivatives of the residual, with `dof`*`k` values per grid point, write them here
+- ctx  - optional context passed above
+
+  Level: intermediate
+
+  Notes:
+  The entries for direction `c` of component `d` at grid point `i` (1d) are `dx[i][d*k+c]` and `df[i][d*k+c]`, that is the
+  arrays are those obtained with `DMDAVecGetArrayDOF()` for a `DMDA` with `dof`*`k` degrees of freedom, and `df` must be
+  set on the locally owned part of the grid, as with `DMDASNESSetFunctionLocal()` with `INSERT_VALUES`.
+
+  `func` is the forward mode derivative of the local residual: a convenient way of writing it is to evaluate the residual
+  with each value replaced by a number carrying its `k` derivatives (a vector-of-duals), which is what source
+  transformation or operator overloading automatic differentiation tools produce. The directions are the `k` colors of the
+  local coloring of the `DMDA`, see `DMCreateColoring()`, so that one call of `func` provides every entry of the Jacobian,
+  which is then inserted in the matrix with `MatFDColoringSetValues()`. Unlike the finite difference approximation used when
+  no Jacobian is provided, the result is exact and costs one evaluation instead of one per color.
+
+  Block matrix types such as `MATBAIJ` are not supported since their coloring is for the blocks.
+
+.seealso: [](ch_snes), `DMDA`, `DMDASNESSetFunctionLocal()`, `DMDASNESSetJacobianLocal()`, `MatFDColoringSetValues()`, `DMCreateColoring()`, `DMDAVecGetArrayDOF()`
+@*/
+PetscErrorCode DMDASNESSetJacobianLocalTangent(DM dm, PetscErrorCode (*func)(DMDALocalInfo *info, PetscInt k, void *x, void *dx, void *df, void *ctx), void *ctx)
+{
+  DMSNES     sdm;
+  DMSNES_DA *dmdasnes;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(dm, DM_CLASSID, 1);
+  PetscCall(DMGetDMSNESWrite(dm, &sdm));
+  PetscCall(DMDASNESGetContext(dm, sdm, &dmdasnes));
+
+  dmdasnes->jacobianlocal        = NULL;
+  dmdasnes->jacobianlocalvec     = NULL;
+  dmdasnes->jacobianlocaltangent = func;
+  dmdasnes->jacobianlocalctx     = ctx;
+
+  PetscCall(DMSNESSetJacobian(dm, SNESComputeJacobian_DMDA, dmdasnes));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@C
   DMDASNESSetJacobianLocalVec - set a local Jacobian evaluation function that operates on a local vector with `DMDA`
 
@@ -923,6 +923,8 @@ PetscErrorCode TSAdaptChoose(TSAdapt adapt, TS ts, PetscReal h, PetscInt *next_s
   PetscCheck(scheme >= 0 && (ncandidates <= 0 || scheme < ncandidates), PetscObjectComm((PetscObject)adapt), PETSC_ERR_ARG_OUTOFRANGE, "Chosen scheme %" PetscInt_FMT " not in valid range 0..%" PetscInt_FMT, scheme, ncandidates - 1);
   PetscCheck(*next_h >= 0, PetscObjectComm((PetscObject)adapt), PETSC_ERR_ARG_OUTOFRANGE, "Computed step size %g must be positive", (double)*next_h);
   if (next_sc) *next_sc = scheme;
+  /* the step may have been rejected because of an inexact Jacobian, rebuild an adaptively lagged one on the next attempt */
+  if (!*accept && ts->snes) PetscCall(SNESResetLagAdaptive(ts->snes));
 
   if (*accept && ts->exact_final_time == TS_EXACTFINALTIME_MATCHSTEP) {
     /* Increase/reduce step size if end time of next step is close to or overshoots max time */
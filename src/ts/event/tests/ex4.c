@@ -317,6 +317,41 @@ PetscErrorCode Postevent(TS ts, PetscInt nev_zero, PetscInt evs_zero[], PetscRea
     filter: grep "This test"
     nsize: 1
 
+  test:
+    suffix: 2interpolate
+    output_file: output/ex4_2.out
+    args: -dir 0
+    args: -F {{-1 0 1 2 3 4 5 6 7 8 9 10 11}}
+    args: -ts_event_dt_min 1e-6 -ts_dt 0.4 -ts_event_tol 1e-8
+    args: -ts_adapt_type {{none basic}}
+    args: -dtpost 0.35
+    args: -ts_type {{rk arkimex}} -ts_event_interpolate
+    filter: grep "This test"
+    nsize: 1
+
+  test:
+    suffix: 0interpolate
+    requires: !single
+    output_file: output/ex4_0.out
+    args: -dir 0
+    args: -ts_adapt_dt_min 1e-10 -ts_event_dt_min 1e-10
+    args: -ts_dt 0.25
+    args: -restart 0
+    args: -ts_event_tol {{1e-8 1e-15}}
+    args: -errtol 1e-7
+    args: -ts_adapt_type {{none basic}}
+    args: -dtpost 0
+    args: -ts_event_post_event_step -1
+    args: -ts_type rk -ts_event_interpolate
+    nsize: 2
+    filter: sort
+    filter_output: sort
+
+  test:
+    suffix: F7interpolate
+    args: -ts_event_monitor -F 7 -ts_dt 0.04 -ts_event_dt_min 0.016 -errtol 0.005 -ts_event_interpolate
+    nsize: 1
+
   test:
     suffix: 2pos
     output_file: output/ex4_2.out
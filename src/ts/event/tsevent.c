@@ -55,6 +55,7 @@ PetscErrorCode TSEventDestroy(TSEvent *event)
   PetscCall(PetscFree((*event)->terminate));
   PetscCall(PetscFree((*event)->events_zero));
   PetscCall(PetscFree((*event)->vtol));
+  PetscCall(VecDestroy(&(*event)->work));
 
   for (PetscInt i = 0; i < (*event)->recsize; i++) PetscCall(PetscFree((*event)->recorder.eventidx[i]));
   PetscCall(PetscFree((*event)->recorder.eventidx));
@@ -250,6 +251,46 @@ PetscErrorCode TSSetEventTolerances(TS ts, PetscReal tol, PetscReal vtol[])
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+  TSSetEventInterpolation - Set whether the events are located from the interpolated solution inside the time step
+
+  Logically Collective
+
+  Input Parameters:
++ ts  - time integration context
+- flg - `PETSC_TRUE` to locate the zero crossings of the indicator functions from the interpolated solution
+
+  Options Database Key:
+. -ts_event_interpolate <bool> - locate the events from the interpolated solution inside the step
+
+  Level: intermediate
+
+  Notes:
+  One must call `TSSetEventHandler()` before calling this function.
+
+  By default, once a zero crossing of an indicator function is detected in the step t0 -> t1, the event handler locates it by
+  rolling back the step and stepping again to each of the trial points of its bracket refinement, which costs one time step
+  (for implicit methods, one nonlinear solve) per iteration.
+  With this option the trial points are instead evaluated from the dense output of the accepted step t0 -> t1 with `TSInterpolate()`,
+  and the indicator functions, all of them at once, are computed on the interpolated solution. Once the zero crossing te is located,
+  the step is rolled back and a single step t0 -> te is taken, so that the post-event callback receives the solution computed by the integrator.
+  The cost of locating an event is thus a single time step, however many refinement iterations or indicator functions are involved.
+
+  The event is located with the accuracy of the interpolation formula of the method, which is usually of lower order than the method itself.
+  The `TSType` must provide `TSInterpolate()`, e.g. `TSRK` with a tableau having an interpolation formula, `TSARKIMEX` or `TSROSW`.
+
+.seealso: [](ch_ts), `TS`, `TSEvent`, `TSSetEventHandler()`, `TSInterpolate()`, `TSSetEventTolerances()`
+@*/
+PetscErrorCode TSSetEventInterpolation(TS ts, PetscBool flg)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(ts, TS_CLASSID, 1);
+  PetscValidLogicalCollectiveBool(ts, flg, 2);
+  PetscCheck(ts->event, PetscObjectComm((PetscObject)ts), PETSC_ERR_USER, "Must set the events first by calling TSSetEventHandler()");
+  ts->event->interpolate = flg;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@C
   TSSetEventHandler - Sets functions and parameters used for indicating events and handling them
 
@@ -291,7 +332,8 @@ PetscErrorCode TSSetEventTolerances(TS ts, PetscReal tol, PetscReal vtol[])
 . -ts_event_recorder_initial_size <recsize> - initial size of event recorder
 . -ts_event_post_event_step <dt1>           - first time step after event
 . -ts_event_post_event_second_step <dt2>    - second time step after event
-- -ts_event_dt_min <dt>                     - minimum time step considered for TSEvent
+. -ts_event_dt_min <dt>                     - minimum time step considered for TSEvent
+- -ts_event_interpolate                     - locate the events from the interpolated solution inside the step, see `TSSetEventInterpolation()`
 
   Level: intermediate
 
@@ -304,7 +346,7 @@ PetscErrorCode TSSetEventTolerances(TS ts, PetscReal tol, PetscReal vtol[])
   However, the `postevent()` callback invocation is performed synchronously on all processes, including
   those processes which have not currently triggered any events.
 
-.seealso: [](ch_ts), `TSEvent`, `TSCreate()`, `TSSetTimeStep()`, `TSSetConvergedReason()`
+.seealso: [](ch_ts), `TSEvent`, `TSCreate()`, `TSSetTimeStep()`, `TSSetConvergedReason()`, `TSSetEventInterpolation()`
 @*/
 PetscErrorCode TSSetEventHandler(TS ts, PetscInt nevents, PetscInt direction[], PetscBool terminate[], PetscErrorCode (*indicator)(TS ts, PetscReal t, Vec U, PetscReal fvalue[], void *ctx), PetscErrorCode (*postevent)(TS ts, PetscInt nevents_zero, PetscInt events_zero[], PetscReal t, Vec U, PetscBool forwardsolve, void *ctx), void *ctx)
 {
@@ -350,6 +392,8 @@ PetscErrorCode TSSetEventHandler(TS ts, PetscInt nevents, PetscInt direction[],
   event->iterctr                = 0;
   event->processing             = PETSC_FALSE;
   event->revisit_right          = PETSC_FALSE;
+  event->interpolate            = PETSC_FALSE;
+  event->ptime_left_interp      = PETSC_MIN_REAL;
   event->nevents                = nevents;
   event->indicator              = indicator;
   event->postevent              = postevent;
@@ -370,6 +414,7 @@ PetscErrorCode TSSetEventHandler(TS ts, PetscInt nevents, PetscInt direction[],
     PetscCall(PetscOptionsReal("-ts_event_post_event_step", "First time step after event", "", event->timestep_postevent, &event->timestep_postevent, NULL));
     PetscCall(PetscOptionsReal("-ts_event_post_event_second_step", "Second time step after event", "", event->timestep_2nd_postevent, &event->timestep_2nd_postevent, NULL));
     PetscCall(PetscOptionsReal("-ts_event_dt_min", "Minimum time step considered for TSEvent", "", event->timestep_min, &event->timestep_min, NULL));
+    PetscCall(PetscOptionsBool("-ts_event_interpolate", "Locate the events from the interpolated solution inside the step", "TSSetEventInterpolation", event->interpolate, &event->interpolate, NULL));
   }
   PetscOptionsEnd();
 
@@ -681,6 +726,105 @@ static inline PetscBool Not_PETSC_DECIDE(PetscReal dt)
   return dt == PETSC_DECIDE ? PETSC_FALSE : PETSC_TRUE;
 }
 
+/*
+  Computes the step from the left end of the bracket to the next trial point, when refining the bracket
+  to the left (minsideout == -1) or to the right (minsideout == +1) of the current point t.
+*/
+static PetscErrorCode TSEventRefineBracket(TS ts, PetscReal t, PetscInt minsideout, PetscReal bracket_size, PetscReal *dt_next)
+{
+  TSEvent event = ts->event;
+
+  PetscFunctionBegin;
+  if (bracket_size <= 2 * event->timestep_min) *dt_next = bracket_size / 2; // the bracket is almost small -> bisect it
+  else {                                                                    // the bracket is not small -> use Anderson-Bjorck
+    PetscReal dti_min = PETSC_MAX_REAL;
+    for (PetscInt i = 0; i < event->nevents; i++) {
+      if (event->side[i] == minsideout) { // only refine the appropriate brackets
+        PetscReal dti = RefineAndersonBjorck(event->ptime_prev, t, event->ptime_right, event->fvalue_prev[i], event->fvalue[i], event->fvalue_right[i], event->side[i], &event->side_prev[i], event->justrefined_AB[i], &event->gamma_AB[i]);
+        dti_min       = PetscMin(dti_min, dti);
+      }
+    }
+    PetscCallMPI(MPIU_Allreduce(&dti_min, dt_next, 1, MPIU_REAL, MPIU_MIN, PetscObjectComm((PetscObject)ts)));
+    if (*dt_next < event->timestep_min) *dt_next = event->timestep_min;
+    if (bracket_size - *dt_next < event->timestep_min) *dt_next = bracket_size - event->timestep_min;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+  Locates the zero-crossing in the bracket [ptime_prev, t] found at the end t of the accepted step, refining the bracket
+  as TSEventHandler() does, but evaluating the indicator functions at the trial points on the solution interpolated with
+  TSInterpolate() instead of stepping to them. Each trial point costs one interpolation and one indicator callback for all
+  the events, and the sides and the step are agreed on with one reduction each, as in TSEventHandler().
+  On exit the right end of the bracket holds the zero-crossing, the left end is restored to the start of the step,
+  and dt is the step from there to the zero-crossing, to be taken with 'revisit_right' set. The left end of the last
+  bracket is kept in 'ptime_left_interp' to be reported on revisiting the zero-crossing.
+*/
+static PetscErrorCode TSEventLocateInterpolated(TS ts, PetscReal t, PetscReal *dt)
+{
+  TSEvent    event  = ts->event;
+  PetscReal  tstart = event->ptime_prev, *fstart;
+  PetscInt  *sstart, minsidein, minsideout = -1;
+  PetscBool  at_right = PETSC_FALSE;
+  Vec        U;
+
+  PetscFunctionBegin;
+  PetscCall(PetscMalloc2(event->nevents, &fstart, event->nevents, &sstart));
+  PetscCall(PetscArraycpy(fstart, event->fvalue_prev, event->nevents));
+  PetscCall(PetscArraycpy(sstart, event->fsign_prev, event->nevents));
+  if (!event->work) {
+    PetscCall(TSGetSolution(ts, &U));
+    PetscCall(VecDuplicate(U, &event->work));
+  }
+  while (minsideout != 0) {
+    const PetscReal bracket_size = (minsideout == -1) ? t - event->ptime_prev : event->ptime_right - t;
+    PetscReal       dt_next;
+
+    if (minsideout == +1 && bracket_size <= event->timestep_min) { // the zero-crossing is taken at the right end of a small bracket
+      TSEvent_update_left(event, t);
+      at_right = PETSC_TRUE;
+      break;
+    }
+    PetscCall(TSEventRefineBracket(ts, t, minsideout, bracket_size, &dt_next));
+    if (minsideout == -1) TSEvent_update_right(event, t);
+    else TSEvent_update_left(event, t);
+    for (PetscInt i = 0; i < event->nevents; i++) {
+      event->justrefined_AB[i] = event->side[i] == minsideout ? PETSC_TRUE : PETSC_FALSE;
+      if (event->justrefined_AB[i] && event->monitor)
+        PetscCall(PetscViewerASCIIPrintf(event->monitor, "[%d] TSEvent: iter %" PetscInt_FMT " - Event %" PetscInt_FMT " refining the bracket with sign change [%g - %g], next interpolating at %g\n", PetscGlobalRank, event->iterctr, i, (double)event->ptime_prev,
+                                         (double)event->ptime_right, (double)(event->ptime_prev + dt_next)));
+    }
+    event->iterctr++;
+    t = event->ptime_prev + dt_next;
+
+    PetscCall(TSInterpolate(ts, t, event->work));
+    PetscCall(VecLockReadPush(event->work));
+    PetscCallBack("TSEvent indicator", (*event->indicator)(ts, t, event->work, event->fvalue, event->ctx));
+    PetscCall(VecLockReadPop(event->work));
+    TSEventCalcSigns(event->nevents, event->fvalue, event->vtol, event->fsign);
+    for (PetscInt i = 0; i < event->nevents; i++) event->side[i] = 2;
+    PetscCall(TSEventTestZero(ts, t));
+    minsidein = 2;
+    for (PetscInt i = 0; i < event->nevents; i++) {
+      if (event->side[i] != 0) event->side[i] = TSEventTestBracket(event->fsign_prev[i], event->fsign[i], event->fsign_right[i], event->direction[i], event->iterctr);
+      minsidein = PetscMin(minsidein, event->side[i]);
+    }
+    PetscCallMPI(MPIU_Allreduce(&minsidein, &minsideout, 1, MPIU_INT, MPI_MIN, PetscObjectComm((PetscObject)ts)));
+    PetscCheck(minsideout != 2, PetscObjectComm((PetscObject)ts), PETSC_ERR_PLIB, "Lost the bracket with sign change when locating the event by interpolation in TSEventHandler()");
+  }
+  if (!at_right) TSEvent_update_right(event, t);
+  event->ptime_left_interp = event->ptime_prev;
+  if (event->monitor)
+    PetscCall(PetscViewerASCIIPrintf(event->monitor, "[%d] TSEvent: iter %" PetscInt_FMT " - zero crossing located by interpolation at time %g in the bracket [%g - %g], stepping to it from %g\n", PetscGlobalRank, event->iterctr, (double)event->ptime_right, (double)event->ptime_prev,
+                                     (double)event->ptime_right, (double)tstart));
+  PetscCall(PetscArraycpy(event->fvalue_prev, fstart, event->nevents));
+  PetscCall(PetscArraycpy(event->fsign_prev, sstart, event->nevents));
+  event->ptime_prev = tstart;
+  *dt               = event->ptime_right - tstart;
+  PetscCall(PetscFree2(fstart, sstart));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 // PetscClangLinter pragma disable: -fdoc-section-spacing
 // PetscClangLinter pragma disable: -fdoc-section-header-unknown
 // PetscClangLinter pragma disable: -fdoc-section-header-spelling
@@ -770,6 +914,12 @@ static inline PetscBool Not_PETSC_DECIDE(PetscReal dt)
   If the solution is then changed by the postevent(), the indicator-function-signs will be recalculated.
 
   Whether the algorithm is revisiting a point in the current TSEventHandler() call is flagged by 'event->revisit_right'.
+
+  =Interpolation=
+  With TSSetEventInterpolation(), a bracket [t0, t10] found at the end of an accepted step is refined to the event location
+  t9 within the same TSEventHandler() call, on the solution interpolated inside the step (TSEventLocateInterpolated()).
+  The TS then rolls back and steps t0 -> t9 directly, which is handled as revisiting t9: the indicator functions are taken
+  from the interpolated solution, and the left end of the bracket is t0, where the step started.
 */
 PetscErrorCode TSEventHandler(TS ts)
 {
@@ -829,7 +979,13 @@ PetscErrorCode TSEventHandler(TS ts)
   */
   PetscCheck(!event->revisit_right || minsideout == 0, PetscObjectComm((PetscObject)ts), PETSC_ERR_PLIB, "minsideout != 0 when performing 'revisiting' in TSEventHandler()");
 
-  if (minsideout == -1 || minsideout == +1) {                                                           // this if-branch will refine the left/right bracket
+  if (minsideout == -1 && event->iterctr == 0 && event->interpolate && event->ptime_prev >= ts->ptime_prev) { // locate the event inside the accepted step, then step to it
+    PetscCall(TSEventLocateInterpolated(ts, t, &dt_next));
+    PetscCall(TSRollBack(ts));
+    PetscCall(TSSetConvergedReason(ts, TS_CONVERGED_ITERATING));
+    event->revisit_right = PETSC_TRUE;
+    event->processing    = PETSC_TRUE;
+  } else if (minsideout == -1 || minsideout == +1) {                                                    // this if-branch will refine the left/right bracket
     const PetscReal bracket_size = (minsideout == -1) ? t - event->ptime_prev : event->ptime_right - t; // sync on all ranks
 
     if (minsideout == +1 && bracket_size <= event->timestep_min) { // check if the bracket (right) is small
@@ -842,19 +998,7 @@ PetscErrorCode TSEventHandler(TS ts)
                                          (double)event->ptime_right, (double)(event->ptime_prev + dt_next)));
     } else { // the bracket is not very small -> refine it
       // [--------|-------------]
-      if (bracket_size <= 2 * event->timestep_min) dt_next = bracket_size / 2; // the bracket is almost small -> bisect it
-      else {                                                                   // the bracket is not small -> use Anderson-Bjorck
-        PetscReal dti_min = PETSC_MAX_REAL;
-        for (PetscInt i = 0; i < event->nevents; i++) {
-          if (event->side[i] == minsideout) { // only refine the appropriate brackets
-            PetscReal dti = RefineAndersonBjorck(event->ptime_prev, t, event->ptime_right, event->fvalue_prev[i], event->fvalue[i], event->fvalue_right[i], event->side[i], &event->side_prev[i], event->justrefined_AB[i], &event->gamma_AB[i]);
-            dti_min       = PetscMin(dti_min, dti);
-          }
-        }
-        PetscCallMPI(MPIU_Allreduce(&dti_min, &dt_next, 1, MPIU_REAL, MPIU_MIN, PetscObjectComm((PetscObject)ts)));
-        if (dt_next < event->timestep_min) dt_next = event->timestep_min;
-        if (bracket_size - dt_next < event->timestep_min) dt_next = bracket_size - event->timestep_min;
-      }
+      PetscCall(TSEventRefineBracket(ts, t, minsideout, bracket_size, &dt_next));
 
       if (minsideout == -1) { // minsideout == -1, update the right-end values, retain the left-end values
         TSEvent_update_right(event, t);
@@ -887,9 +1031,10 @@ PetscErrorCode TSEventHandler(TS ts)
           event->fsign[i] = 0; // sign = 0 is enforced further
           if (event->monitor)
             PetscCall(PetscViewerASCIIPrintf(event->monitor, "[%d] TSEvent: iter %" PetscInt_FMT " - Event %" PetscInt_FMT " accepting time %g as event location, due to reaching too small bracket [%g - %g]\n", PetscGlobalRank, event->iterctr, i, (double)t,
-                                             (double)event->ptime_prev, (double)t));
+                                             (double)PetscMax(event->ptime_prev, event->ptime_left_interp), (double)t));
         }
       }
+    event->ptime_left_interp = PETSC_MIN_REAL;
     event->iterctr++;
     event->processing = PETSC_TRUE;
   } else { // minsideout == 2: no brackets, no zero-crossings
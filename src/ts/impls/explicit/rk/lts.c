@@ -0,0 +1,367 @@
+/*
+  Code for local time-stepping with explicit Runge-Kutta methods
+
+  Notes:
+  1) The degrees of freedom are binned into levels l = 0, ..., L-1 from the user estimate of their largest stable time step,
+     the degrees of freedom on level l take steps of size h/2^l, where h is the time step of the TS. The binning is
+     recomputed every few steps, as the solution evolves.
+  2) Starting from level 0, a step of level l is an RK step for all the degrees of freedom of level l and finer, which completes
+     the step for level l, followed by two steps of level l+1 of half the size. The right-hand side only needs the rows of
+     level l and finer, the values of the coarser degrees of freedom at the stage times are given by the dense output
+     formula of the step of their own level, which contains the stage times of all the finer levels.
+  3) Unless the user provides a right-hand side restricted to a subset of the rows, the whole right-hand side is computed,
+     which keeps the scheme correct but removes the savings.
+*/
+
+#include <petsc/private/tsimpl.h>
+#include <../src/ts/impls/explicit/rk/rk.h>
+#include <../src/ts/impls/explicit/rk/lts.h>
+
+struct _n_TSRK_LTS {
+  TSRKLocalTimeStepFn    *dtlocal;   /* largest stable time step of each degree of freedom */
+  TSRKLocalRHSFunctionFn *rhs;       /* right-hand side restricted to a subset of the rows, optional */
+  void                   *ctx;       /* user context for dtlocal and rhs */
+  PetscInt                maxlevels; /* maximum number of levels */
+  PetscInt                rebin;     /* number of steps between two binnings */
+  PetscInt                lastbin;   /* step number of the last binning, -1 if none */
+  PetscInt                nlevels;   /* number of levels of the current binning */
+  PetscInt                nalloc;    /* number of levels with allocated work vectors */
+  PetscInt                s;         /* number of stages of the work vectors */
+  PetscInt               *level;     /* level of each local degree of freedom */
+  PetscInt               *count;     /* global number of degrees of freedom on each level */
+  IS                     *active;    /* degrees of freedom of each level and the finer ones */
+  Vec                     dt;        /* largest stable time step of each degree of freedom */
+  Vec                    *X0;        /* solution at the start of the current step of each level */
+  Vec                   **K;         /* stage derivatives of the current step of each level */
+  PetscReal              *tstart;    /* start time of the current step of each level */
+  PetscReal              *hstep;     /* step size of each level */
+  PetscScalar            *w;         /* stage weights of each level, maxlevels x s */
+};
+
+/*
+  Computes the level of each local degree of freedom, the smallest l with h/2^l <= dt, and the index sets of the levels,
+  erroring if some degree of freedom needs more than maxlevels levels
+*/
+static PetscErrorCode TSRKLTSBin(TS ts, PetscReal t, PetscReal h)
+{
+  TS_RK             *rk  = (TS_RK *)ts->data;
+  TSRK_LTS           lts = rk->lts;
+  PetscInt           n, rstart, lmax = 0, nlevels, *cnt, *idx;
+  PetscMPIInt        maxlevels;
+  const PetscScalar *dt;
+
+  PetscFunctionBegin;
+  PetscCall(VecGetLocalSize(ts->vec_sol, &n));
+  PetscCall(VecGetOwnershipRange(ts->vec_sol, &rstart, NULL));
+  if (!lts->dt) {
+    PetscCall(VecDuplicate(ts->vec_sol, &lts->dt));
+    PetscCall(PetscMalloc1(n, &lts->level));
+  }
+  PetscCallBack("TSRK local time step", (*lts->dtlocal)(ts, t, ts->vec_sol, lts->dt, lts->ctx));
+  PetscCall(VecGetArrayRead(lts->dt, &dt));
+  for (PetscInt j = 0; j < n; j++) {
+    PetscReal d = PetscRealPart(dt[j]), hl = h;
+    PetscInt  l = 0;
+
+    if (d > 0) {
+      while (l < lts->maxlevels && hl > d) { /* l == maxlevels flags a degree of freedom that needs more levels */
+        hl /= 2;
+        l++;
+      }
+    }
+    lts->level[j] = l;
+    lmax          = PetscMax(lmax, l);
+  }
+  PetscCall(VecRestoreArrayRead(lts->dt, &dt));
+  PetscCallMPI(MPIU_Allreduce(&lmax, &nlevels, 1, MPIU_INT, MPI_MAX, PetscObjectComm((PetscObject)ts)));
+  PetscCheck(nlevels < lts->maxlevels, PetscObjectComm((PetscObject)ts), PETSC_ERR_ARG_OUTOFRANGE, "Step %" PetscInt_FMT ": the local time steps need more than the maximum %" PetscInt_FMT " local time-stepping levels, increase it with -ts_rk_lts_max_levels or decrease the time step", ts->steps, lts->maxlevels);
+  lts->nlevels = nlevels + 1;
+  PetscCheck(lts->nlevels == 1 || rk->tableau->binterp, PetscObjectComm((PetscObject)ts), PETSC_ERR_SUP, "Local time-stepping requires a TSRK method with an interpolation formula, %s does not have one", rk->tableau->name);
+
+  PetscCall(PetscCalloc1(lts->maxlevels, &cnt));
+  for (PetscInt j = 0; j < n; j++) cnt[lts->level[j]]++;
+  PetscCall(PetscMPIIntCast(lts->maxlevels, &maxlevels));
+  PetscCallMPI(MPIU_Allreduce(cnt, lts->count, maxlevels, MPIU_INT, MPI_SUM, PetscObjectComm((PetscObject)ts)));
+  PetscCall(PetscFree(cnt));
+
+  PetscCall(PetscMalloc1(n, &idx));
+  for (PetscInt l = 0; l < lts->maxlevels; l++) PetscCall(ISDestroy(&lts->active[l]));
+  for (PetscInt l = 0; l < lts->nlevels; l++) {
+    PetscInt m = 0;
+
+    for (PetscInt j = 0; j < n; j++)
+      if (lts->level[j] >= l) idx[m++] = rstart + j;
+    PetscCall(ISCreateGeneral(PetscObjectComm((PetscObject)ts), m, idx, PETSC_COPY_VALUES, &lts->active[l]));
+  }
+  PetscCall(PetscFree(idx));
+
+  if (!lts->w) PetscCall(PetscMalloc1(lts->maxlevels * rk->tableau->s, &lts->w));
+  lts->s = rk->tableau->s;
+  for (; lts->nalloc < lts->nlevels; lts->nalloc++) {
+    PetscCall(VecDuplicate(ts->vec_sol, &lts->X0[lts->nalloc]));
+    PetscCall(VecDuplicateVecs(ts->vec_sol, rk->tableau->s, &lts->K[lts->nalloc]));
+  }
+  lts->lastbin = ts->steps;
+  PetscCall(PetscInfo(ts, "Step %" PetscInt_FMT ": %" PetscInt_FMT " local time-stepping levels, %" PetscInt_FMT " degrees of freedom on the finest\n", ts->steps, lts->nlevels, lts->count[lts->nlevels - 1]));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+  Stage value i of a step of level l: the degrees of freedom of level l and finer from the stages of this step,
+  the coarser ones from the dense output of the current step of their level
+*/
+static PetscErrorCode TSRKLTSStageValue(TS ts, PetscInt l, PetscInt i, PetscReal ti, Vec Y)
+{
+  TS_RK             *rk  = (TS_RK *)ts->data;
+  TSRK_LTS           lts = rk->lts;
+  RKTableau          tab = rk->tableau;
+  const PetscInt     s = tab->s, p = tab->p;
+  const PetscReal   *A = tab->A, *B = tab->binterp;
+  PetscScalar       *y, *w = lts->w;
+  const PetscScalar **x0, **k;
+  PetscInt           n;
+
+  PetscFunctionBegin;
+  for (PetscInt j = 0; j < i; j++) w[l * s + j] = lts->hstep[l] * A[i * s + j];
+  for (PetscInt m = 0; m < l; m++) {
+    PetscReal theta = (ti - lts->tstart[m]) / lts->hstep[m], tt;
+
+    for (PetscInt j = 0; j < s; j++) w[m * s + j] = 0;
+    tt = theta;
+    for (PetscInt q = 0; q < p; q++, tt *= theta) {
+      for (PetscInt j = 0; j < s; j++) w[m * s + j] += lts->hstep[m] * B[j * p + q] * tt;
+    }
+  }
+  PetscCall(PetscMalloc2(l + 1, &x0, (l + 1) * s, &k));
+  for (PetscInt m = 0; m <= l; m++) {
+    PetscCall(VecGetArrayRead(lts->X0[m], &x0[m]));
+    for (PetscInt j = 0; j < (m < l ? s : i); j++) PetscCall(VecGetArrayRead(lts->K[m][j], &k[m * s + j]));
+  }
+  PetscCall(VecGetLocalSize(Y, &n));
+  PetscCall(VecGetArrayWrite(Y, &y));
+  for (PetscInt r = 0; r < n; r++) {
+    const PetscInt m  = PetscMin(lts->level[r], l);
+    const PetscInt nk = m < l ? s : i;
+    PetscScalar    v  = x0[m][r];
+
+    for (PetscInt j = 0; j < nk; j++) v += w[m * s + j] * k[m * s + j][r];
+    y[r] = v;
+  }
+  PetscCall(VecRestoreArrayWrite(Y, &y));
+  for (PetscInt m = 0; m <= l; m++) {
+    PetscCall(VecRestoreArrayRead(lts->X0[m], &x0[m]));
+    for (PetscInt j = 0; j < (m < l ? s : i); j++) PetscCall(VecRestoreArrayRead(lts->K[m][j], &k[m * s + j]));
+  }
+  PetscCall(PetscFree2(x0, k));
+  PetscCall(PetscLogFlops(2.0 * n * s));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+  A step of level l from t with step size h, followed by two steps of level l+1
+*/
+static PetscErrorCode TSRKLTSAdvance(TS ts, PetscInt l, PetscReal t, PetscReal h)
+{
+  TS_RK             *rk  = (TS_RK *)ts->data;
+  TSRK_LTS           lts = rk->lts;
+  RKTableau          tab = rk->tableau;
+  const PetscInt     s   = tab->s;
+  const PetscReal   *b = tab->b, *c = tab->c;
+  Vec               *Y = rk->Y, *K = lts->K[l];
+  PetscScalar       *u, *x0;
+  const PetscScalar *u0, **k;
+  PetscInt           n, na;
+
+  PetscFunctionBegin;
+  lts->tstart[l] = t;
+  lts->hstep[l]  = h;
+  PetscCall(VecGetLocalSize(ts->vec_sol, &n));
+  PetscCall(VecGetArrayRead(ts->vec_sol, &u0));
+  PetscCall(VecGetArray(lts->X0[l], &x0));
+  for (PetscInt r = 0; r < n; r++)
+    if (lts->level[r] >= l) x0[r] = u0[r];
+  PetscCall(VecRestoreArray(lts->X0[l], &x0));
+  PetscCall(VecRestoreArrayRead(ts->vec_sol, &u0));
+
+  for (PetscInt i = 0; i < s; i++) {
+    const PetscReal ti = t + h * c[i];
+
+    if (l == 0) {
+      rk->stage_time = ti;
+      PetscCall(TSPreStage(ts, ti));
+    }
+    PetscCall(TSRKLTSStageValue(ts, l, i, ti, Y[i]));
+    if (l == 0) PetscCall(TSPostStage(ts, ti, i, Y));
+    if (lts->rhs) PetscCallBack("TSRK local right-hand side", (*lts->rhs)(ts, ti, Y[i], lts->active[l], K[i], lts->ctx));
+    else PetscCall(TSComputeRHSFunction(ts, ti, Y[i], K[i]));
+  }
+
+  /* complete the step of the degrees of freedom of this level */
+  PetscCall(PetscMalloc1(s, &k));
+  for (PetscInt i = 0; i < s; i++) PetscCall(VecGetArrayRead(K[i], &k[i]));
+  PetscCall(VecGetArrayRead(lts->X0[l], &u0));
+  PetscCall(VecGetArray(ts->vec_sol, &u));
+  na = 0;
+  for (PetscInt r = 0; r < n; r++) {
+    if (lts->level[r] == l) {
+      PetscScalar v = u0[r];
+
+      for (PetscInt i = 0; i < s; i++) v += h * b[i] * k[i][r];
+      u[r] = v;
+      na++;
+    }
+  }
+  PetscCall(VecRestoreArray(ts->vec_sol, &u));
+  PetscCall(VecRestoreArrayRead(lts->X0[l], &u0));
+  for (PetscInt i = 0; i < s; i++) PetscCall(VecRestoreArrayRead(K[i], &k[i]));
+  PetscCall(PetscFree(k));
+  PetscCall(PetscLogFlops(2.0 * na * s));
+
+  if (l + 1 < lts->nlevels) {
+    PetscCall(TSRKLTSAdvance(ts, l + 1, t, h / 2));
+    PetscCall(TSRKLTSAdvance(ts, l + 1, t + h / 2, h / 2));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode TSStep_RK_LTS(TS ts)
+{
+  TS_RK    *rk  = (TS_RK *)ts->data;
+  TSRK_LTS  lts = rk->lts;
+  PetscReal next_time_step = ts->time_step;
+  PetscBool accept;
+
+  PetscFunctionBegin;
+  rk->status = TS_STEP_INCOMPLETE;
+  if (lts->s && lts->s != rk->tableau->s) PetscCall(TSReset_RK_LTS(ts)); /* the RK type was changed */
+  if (lts->lastbin < 0 || ts->steps - lts->lastbin >= lts->rebin) PetscCall(TSRKLTSBin(ts, ts->ptime, ts->time_step));
+  PetscCall(TSRKLTSAdvance(ts, 0, ts->ptime, ts->time_step));
+  PetscCall(TSAdaptChoose(ts->adapt, ts, ts->time_step, NULL, &next_time_step, &accept));
+  rk->status = TS_STEP_COMPLETE;
+  ts->ptime += ts->time_step;
+  ts->time_step = next_time_step;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PetscErrorCode TSSetUp_RK_LTS(TS ts)
+{
+  TS_RK    *rk  = (TS_RK *)ts->data;
+  TSRK_LTS  lts = rk->lts;
+  PetscBool isnone;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectTypeCompare((PetscObject)ts->adapt, TSADAPTNONE, &isnone));
+  PetscCheck(isnone, PetscObjectComm((PetscObject)ts), PETSC_ERR_SUP, "Local time-stepping does not adapt the time step, use TSADAPTNONE");
+  PetscCheck(!rk->use_multirate, PetscObjectComm((PetscObject)ts), PETSC_ERR_SUP, "Local time-stepping cannot be combined with the multirate TSRK method");
+  PetscCheck(!ts->costintegralfwd, PetscObjectComm((PetscObject)ts), PETSC_ERR_SUP, "Local time-stepping does not support cost integrals");
+  PetscCheck(lts->dtlocal, PetscObjectComm((PetscObject)ts), PETSC_ERR_ARG_WRONGSTATE, "Must provide the local time step function with TSRKSetLocalTimeStepping()");
+  lts->lastbin         = -1;
+  ts->ops->step        = TSStep_RK_LTS;
+  ts->ops->interpolate = NULL;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PetscErrorCode TSReset_RK_LTS(TS ts)
+{
+  TS_RK   *rk  = (TS_RK *)ts->data;
+  TSRK_LTS lts = rk->lts;
+
+  PetscFunctionBegin;
+  for (PetscInt l = 0; l < lts->nalloc; l++) {
+    PetscCall(VecDestroy(&lts->X0[l]));
+    PetscCall(VecDestroyVecs(lts->s, &lts->K[l]));
+  }
+  for (PetscInt l = 0; l < lts->maxlevels; l++) PetscCall(ISDestroy(&lts->active[l]));
+  PetscCall(VecDestroy(&lts->dt));
+  PetscCall(PetscFree(lts->level));
+  PetscCall(PetscFree(lts->w));
+  lts->nalloc  = 0;
+  lts->s       = 0;
+  lts->nlevels = 0;
+  lts->lastbin = -1;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode TSRKLTSSetMaxLevels(TS ts, PetscInt maxlevels)
+{
+  TS_RK   *rk  = (TS_RK *)ts->data;
+  TSRK_LTS lts = rk->lts;
+
+  PetscFunctionBegin;
+  PetscCheck(maxlevels >= 1, PetscObjectComm((PetscObject)ts), PETSC_ERR_ARG_OUTOFRANGE, "Number of levels %" PetscInt_FMT " must be positive", maxlevels);
+  if (maxlevels == lts->maxlevels) PetscFunctionReturn(PETSC_SUCCESS);
+  if (lts->maxlevels) PetscCall(TSReset_RK_LTS(ts));
+  PetscCall(PetscFree6(lts->count, lts->active, lts->X0, lts->K, lts->tstart, lts->hstep));
+  lts->maxlevels = maxlevels;
+  PetscCall(PetscCalloc6(maxlevels, &lts->count, maxlevels, &lts->active, maxlevels, &lts->X0, maxlevels, &lts->K, maxlevels, &lts->tstart, maxlevels, &lts->hstep));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PetscErrorCode TSDestroy_RK_LTS(TS ts)
+{
+  TS_RK   *rk  = (TS_RK *)ts->data;
+  TSRK_LTS lts = rk->lts;
+
+  PetscFunctionBegin;
+  if (!lts) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(TSReset_RK_LTS(ts));
+  PetscCall(PetscFree6(lts->count, lts->active, lts->X0, lts->K, lts->tstart, lts->hstep));
+  PetscCall(PetscFree(rk->lts));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PetscErrorCode TSSetFromOptions_RK_LTS(TS ts, PetscOptionItems PetscOptionsObject)
+{
+  TS_RK   *rk  = (TS_RK *)ts->data;
+  TSRK_LTS lts = rk->lts;
+  PetscInt maxlevels = lts->maxlevels;
+
+  PetscFunctionBegin;
+  PetscCall(PetscOptionsBoundedInt("-ts_rk_lts_max_levels", "Maximum number of local time-stepping levels", "TSRKSetLocalTimeStepping", maxlevels, &maxlevels, NULL, 1));
+  PetscCall(TSRKLTSSetMaxLevels(ts, maxlevels));
+  PetscCall(PetscOptionsBoundedInt("-ts_rk_lts_rebin", "Number of steps between two binnings of the degrees of freedom into levels", "TSRKSetLocalTimeStepping", lts->rebin, &lts->rebin, NULL, 1));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PetscErrorCode TSView_RK_LTS(TS ts, PetscViewer viewer)
+{
+  TS_RK   *rk  = (TS_RK *)ts->data;
+  TSRK_LTS lts = rk->lts;
+
+  PetscFunctionBegin;
+  PetscCall(PetscViewerASCIIPrintf(viewer, "  Local time-stepping: at most %" PetscInt_FMT " levels, binned every %" PetscInt_FMT " steps%s\n", lts->maxlevels, lts->rebin, lts->rhs ? ", restricted right-hand side" : ""));
+  if (lts->nlevels) {
+    PetscCall(PetscViewerASCIIPushTab(viewer));
+    for (PetscInt l = 0; l < lts->nlevels; l++) PetscCall(PetscViewerASCIIPrintf(viewer, "  Level %" PetscInt_FMT ": %" PetscInt_FMT " degrees of freedom\n", l, lts->count[l]));
+    PetscCall(PetscViewerASCIIPopTab(viewer));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PetscErrorCode TSRKSetLocalTimeStepping_RK(TS ts, TSRKLocalTimeStepFn *dtlocal, TSRKLocalRHSFunctionFn *rhs, void *ctx)
+{
+  TS_RK *rk = (TS_RK *)ts->data;
+
+  PetscFunctionBegin;
+  if (!rk->lts) {
+    PetscCall(PetscNew(&rk->lts));
+    rk->lts->rebin = 1;
+    PetscCall(TSRKLTSSetMaxLevels(ts, 8));
+  }
+  ts->default_adapt_type = TSADAPTNONE;
+  rk->lts->dtlocal       = dtlocal;
+  rk->lts->rhs           = rhs;
+  rk->lts->ctx           = ctx;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PetscErrorCode TSRKGetLocalTimeSteppingLevels_RK(TS ts, PetscInt *nlevels, const PetscInt *count[])
+{
+  TS_RK *rk = (TS_RK *)ts->data;
+
+  PetscFunctionBegin;
+  PetscCheck(rk->lts, PetscObjectComm((PetscObject)ts), PETSC_ERR_ARG_WRONGSTATE, "Must call TSRKSetLocalTimeStepping() first");
+  if (nlevels) *nlevels = rk->lts->nlevels;
+  if (count) *count = rk->lts->count;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
@@ -0,0 +1,8 @@
+#pragma once
+PETSC_INTERN PetscErrorCode TSRKSetLocalTimeStepping_RK(TS, TSRKLocalTimeStepFn *, TSRKLocalRHSFunctionFn *, void *);
+PETSC_INTERN PetscErrorCode TSRKGetLocalTimeSteppingLevels_RK(TS, PetscInt *, const PetscInt *[]);
+PETSC_INTERN PetscErrorCode TSSetUp_RK_LTS(TS);
+PETSC_INTERN PetscErrorCode TSReset_RK_LTS(TS);
+PETSC_INTERN PetscErrorCode TSDestroy_RK_LTS(TS);
+PETSC_INTERN PetscErrorCode TSSetFromOptions_RK_LTS(TS, PetscOptionItems);
+PETSC_INTERN PetscErrorCode TSView_RK_LTS(TS, PetscViewer);
@@ -12,6 +12,7 @@
 #include <petscdm.h>
 #include <../src/ts/impls/explicit/rk/rk.h>
 #include <../src/ts/impls/explicit/rk/mrk.h>
+#include <../src/ts/impls/explicit/rk/lts.h>
 
 static TSRKType  TSRKDefault = TSRK3BS;
 static PetscBool TSRKRegisterAllCalled;
@@ -166,6 +167,30 @@ M*/
 
 .seealso: [](ch_ts), `TSRK`, `TSRKType`, `TSRKSetType()`
 M*/
+/*MC
+     TSRK3LS - Third order low-storage RK scheme of Williamson <https://doi.org/10.1016/0021-9991(80)90033-9>
+
+     This method has three stages. A step with its low-storage formula uses three vectors, the solution, the register du and the right-hand side, see `TSRKRegisterLowStorage()`.
+
+     Options Database Key:
+.     -ts_rk_type 3ls - use type 3ls
+
+     Level: advanced
+
+.seealso: [](ch_ts), `TSRK`, `TSRKType`, `TSRKSetType()`, `TSRKRegisterLowStorage()`, `TSRK4LS`
+M*/
+/*MC
+     TSRK4LS - Fourth order low-storage RK scheme RK4(3)5[2N] of Carpenter and Kennedy <https://ntrs.nasa.gov/citations/19940028444>
+
+     This method has five stages. A step with its low-storage formula uses three vectors, the solution, the register du and the right-hand side, see `TSRKRegisterLowStorage()`.
+
+     Options Database Key:
+.     -ts_rk_type 4ls - use type 4ls
+
+     Level: advanced
+
+.seealso: [](ch_ts), `TSRK`, `TSRKType`, `TSRKSetType()`, `TSRKRegisterLowStorage()`, `TSRK3LS`
+M*/
 
 /*@C
   TSRKRegisterAll - Registers all of the Runge-Kutta explicit methods in `TSRK`
@@ -341,6 +366,16 @@ PetscErrorCode TSRKRegisterAll(void)
     const PetscReal bembed[13] = {RC(4.5847111400495925878664730122010282095875e-02), 0, 0, 0, 0, RC(2.6231891404152387437443356584845803392392e-01), RC(1.9169372337852611904485738635688429008025e-01), RC(2.1709172327902618330978407422906448568196e-01), RC(1.2738189624833706796803169450656737867900e-01), RC(1.1510530385365326258240515750043192148894e-01), 0, 0, RC(4.0561327798437566841823391436583608050053e-02)};
     PetscCall(TSRKRegister(TSRK8VR, 8, 13, &A[0][0], b, NULL, bembed, 0, NULL));
   }
+  {
+    const PetscReal A[3] = {0, RC(-5.0) / RC(9.0), RC(-153.0) / RC(128.0)};
+    const PetscReal B[3] = {RC(1.0) / RC(3.0), RC(15.0) / RC(16.0), RC(8.0) / RC(15.0)};
+    PetscCall(TSRKRegisterLowStorage(TSRK3LS, 3, 3, A, B));
+  }
+  {
+    const PetscReal A[5] = {0, RC(-567301805773.0) / RC(1357537059087.0), RC(-2404267990393.0) / RC(2016746695238.0), RC(-3550918686646.0) / RC(2091501179385.0), RC(-1275806237668.0) / RC(842570457699.0)};
+    const PetscReal B[5] = {RC(1432997174477.0) / RC(9575080441755.0), RC(5161836677717.0) / RC(13612068292357.0), RC(1720146321549.0) / RC(2090206949498.0), RC(3134564353537.0) / RC(4481467310338.0), RC(2277821191437.0) / RC(14882151754819.0)};
+    PetscCall(TSRKRegisterLowStorage(TSRK4LS, 4, 5, A, B));
+  }
 #undef RC
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -365,6 +400,7 @@ PetscErrorCode TSRKRegisterDestroy(void)
     PetscCall(PetscFree3(t->A, t->b, t->c));
     PetscCall(PetscFree(t->bembed));
     PetscCall(PetscFree(t->binterp));
+    PetscCall(PetscFree2(t->lsA, t->lsB));
     PetscCall(PetscFree(t->name));
     PetscCall(PetscFree(link));
   }
@@ -482,6 +518,70 @@ PetscErrorCode TSRKRegister(TSRKType name, PetscInt order, PetscInt s, const Pet
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@C
+  TSRKRegisterLowStorage - register a low-storage `TSRK` scheme of the 2N form of Williamson
+
+  Not Collective, but the same schemes should be registered on all processes on which they will be used, No Fortran Support
+
+  Input Parameters:
++ name  - identifier for method
+. order - approximation order of method
+. s     - number of stages
+. A     - coefficients of the register update (dimension s, the first one must be 0)
+- B     - coefficients of the solution update (dimension s)
+
+  Level: advanced
+
+  Notes:
+  The step from u_0 to u_s with the step size h and the registers du and u is
+.vb
+  du = A_i du + h f(t + c_i h, u)
+  u  = u + B_i du
+.ve
+  for i = 1, ..., s. The equivalent Butcher tableau is registered with `TSRKRegister()`, it is used instead of the low-storage
+  formula when the stage values must be stored, for instance for the adjoint and the forward sensitivity analysis.
+
+  The low-storage formula applies both updates in a single pass over the vectors. A step uses three vectors, u, du and the
+  right-hand side, which cannot be evaluated in place, whereas the Butcher form allocates 2s vectors. It is disabled with
+  `-ts_rk_low_storage 0`.
+
+.seealso: [](ch_ts), `TSRK`, `TSRKRegister()`, `TSRK3LS`, `TSRK4LS`
+@*/
+PetscErrorCode TSRKRegisterLowStorage(TSRKType name, PetscInt order, PetscInt s, const PetscReal A[], const PetscReal B[])
+{
+  PetscReal *Abt, *bbt, *D;
+  RKTableau  t;
+
+  PetscFunctionBegin;
+  PetscAssertPointer(name, 1);
+  PetscAssertPointer(A, 4);
+  PetscAssertPointer(B, 5);
+  PetscCheck(s >= 1, PETSC_COMM_SELF, PETSC_ERR_ARG_OUTOFRANGE, "Expected number of stages s %" PetscInt_FMT " >= 1", s);
+  PetscCheck(A[0] == 0, PETSC_COMM_SELF, PETSC_ERR_ARG_OUTOFRANGE, "The first register coefficient must be 0");
+  /* D[j*s+k] = A_{k+1} ... A_j is the weight of h f(Y_k) in du after the update j */
+  PetscCall(PetscCalloc3(s * s, &Abt, s, &bbt, s * s, &D));
+  for (PetscInt k = 0; k < s; k++) {
+    D[k * s + k] = 1;
+    for (PetscInt j = k + 1; j < s; j++) D[j * s + k] = D[(j - 1) * s + k] * A[j];
+  }
+  for (PetscInt i = 1; i <= s; i++) {
+    for (PetscInt k = 0; k < i; k++) {
+      PetscReal a = 0;
+
+      for (PetscInt j = k; j < i; j++) a += B[j] * D[j * s + k];
+      if (i < s) Abt[i * s + k] = a;
+      else bbt[k] = a;
+    }
+  }
+  PetscCall(TSRKRegister(name, order, s, Abt, bbt, NULL, NULL, 0, NULL));
+  PetscCall(PetscFree3(Abt, bbt, D));
+  t = &RKTableauList->tab;
+  PetscCall(PetscMalloc2(s, &t->lsA, s, &t->lsB));
+  PetscCall(PetscArraycpy(t->lsA, A, s));
+  PetscCall(PetscArraycpy(t->lsB, B, s));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode TSRKGetTableau_RK(TS ts, PetscInt *s, const PetscReal **A, const PetscReal **b, const PetscReal **c, const PetscReal **bembed, PetscInt *p, const PetscReal **binterp, PetscBool *FSAL)
 {
   TS_RK    *rk  = (TS_RK *)ts->data;
@@ -656,6 +756,11 @@ static PetscErrorCode TSRollBack_RK(TS ts)
   default:
     SETERRQ(PetscObjectComm((PetscObject)ts), PETSC_ERR_PLIB, "Invalid TSStepStatus");
   }
+  if (rk->lowstorage) {
+    PetscCheck(rk->X0, PetscObjectComm((PetscObject)ts), PETSC_ERR_SUP, "The low-storage formula of TSRK %s did not keep the initial solution of the step, use -ts_rk_low_storage 0", tab->name);
+    PetscCall(VecCopy(rk->X0, ts->vec_sol));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   for (j = 0; j < s; j++) w[j] = -h * b[j];
   PetscCall(VecMAXPY(ts->vec_sol, s, w, YdotRHS));
   if (quadts && ts->costintegralfwd) {
@@ -772,6 +877,101 @@ static PetscErrorCode TSForwardReset_RK(TS ts)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+  Fused update of the low-storage formula, du = a du + h f and u = u + b du in a single pass over the vectors
+*/
+static PetscErrorCode TSRKLowStorageUpdate(Vec U, Vec dU, Vec F, PetscReal a, PetscReal h, PetscReal b)
+{
+  PetscScalar       *u, *du;
+  const PetscScalar *f;
+  PetscMemType       mu, mdu, mf;
+  PetscInt           n;
+
+  PetscFunctionBegin;
+  PetscCall(VecGetLocalSize(U, &n));
+  PetscCall(VecGetArrayAndMemType(U, &u, &mu));
+  PetscCall(VecGetArrayAndMemType(dU, &du, &mdu));
+  PetscCall(VecGetArrayReadAndMemType(F, &f, &mf));
+  if (PetscMemTypeHost(mu) && PetscMemTypeHost(mdu) && PetscMemTypeHost(mf)) {
+    if (a == 0) {
+      for (PetscInt i = 0; i < n; i++) {
+        du[i] = h * f[i];
+        u[i] += b * du[i];
+      }
+    } else {
+      for (PetscInt i = 0; i < n; i++) {
+        du[i] = a * du[i] + h * f[i];
+        u[i] += b * du[i];
+      }
+    }
+    PetscCall(PetscLogFlops((a == 0 ? 3.0 : 5.0) * n));
+  }
+  PetscCall(VecRestoreArrayReadAndMemType(F, &f));
+  PetscCall(VecRestoreArrayAndMemType(dU, &du));
+  PetscCall(VecRestoreArrayAndMemType(U, &u));
+  if (!PetscMemTypeHost(mu) || !PetscMemTypeHost(mdu) || !PetscMemTypeHost(mf)) {
+    PetscCall(VecAXPBY(dU, h, a, F));
+    PetscCall(VecAXPY(U, b, dU));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+  Step with the low-storage formula of the tableau, the stage values are the successive values of ts->vec_sol
+*/
+static PetscErrorCode TSStep_RK_LowStorage(TS ts)
+{
+  TS_RK           *rk  = (TS_RK *)ts->data;
+  RKTableau        tab = rk->tableau;
+  const PetscInt   s   = tab->s;
+  const PetscReal *lsA = tab->lsA, *lsB = tab->lsB, *c = tab->c;
+  const PetscReal  t = ts->ptime, h = ts->time_step;
+  Vec              U = ts->vec_sol;
+  TSAdapt          adapt;
+  PetscBool        stageok, accept = PETSC_TRUE;
+  PetscReal        next_time_step = ts->time_step;
+
+  PetscFunctionBegin;
+  PetscCheck(!ts->trajectory && !ts->forward_solve && !ts->costintegralfwd, PetscObjectComm((PetscObject)ts), PETSC_ERR_ARG_WRONGSTATE, "The low-storage formula of TSRK %s does not store the stages, call TSSetUp() after setting up the sensitivity analysis or use -ts_rk_low_storage 0", tab->name);
+  /* keep the initial solution only when the step may be rolled back or interpolated */
+  if (ts->event || ts->resizesetup || (ts->exact_final_time == TS_EXACTFINALTIME_INTERPOLATE && t + h > ts->max_time)) {
+    if (!rk->X0) PetscCall(VecDuplicate(U, &rk->X0));
+    PetscCall(VecCopy(U, rk->X0));
+  } else PetscCall(VecDestroy(&rk->X0));
+
+  for (PetscInt i = 0; i < s; i++) rk->Y[i] = U;
+
+  rk->status = TS_STEP_INCOMPLETE;
+  PetscCall(TSGetAdapt(ts, &adapt));
+  for (PetscInt i = 0; i < s; i++) {
+    rk->stage_time = t + h * c[i];
+    PetscCall(TSPreStage(ts, rk->stage_time));
+    PetscCall(TSPostStage(ts, rk->stage_time, i, rk->Y));
+    PetscCall(TSAdaptCheckStage(adapt, ts, rk->stage_time, U, &stageok));
+    if (!stageok) goto reject_step;
+    PetscCall(TSComputeRHSFunction(ts, rk->stage_time, U, rk->F));
+    PetscCall(TSRKLowStorageUpdate(U, rk->dU, rk->F, lsA[i], h, lsB[i]));
+  }
+
+  rk->status = TS_STEP_PENDING;
+  PetscCall(TSAdaptCandidatesClear(adapt));
+  PetscCall(TSAdaptCandidateAdd(adapt, tab->name, tab->order, 1, tab->ccfl, (PetscReal)tab->s, PETSC_TRUE));
+  PetscCall(TSAdaptChoose(adapt, ts, ts->time_step, NULL, &next_time_step, &accept));
+  if (!accept) goto reject_step;
+  rk->status = TS_STEP_COMPLETE;
+  ts->ptime += ts->time_step;
+  ts->time_step = next_time_step;
+  PetscFunctionReturn(PETSC_SUCCESS);
+
+reject_step:
+  /* the step cannot be retried since the initial solution is overwritten, as in TSEULER */
+  rk->status = TS_STEP_INCOMPLETE;
+  if (rk->X0) PetscCall(VecCopy(rk->X0, U));
+  ts->reject++;
+  ts->reason = TS_DIVERGED_STEP_REJECTED;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode TSStep_RK(TS ts)
 {
   TS_RK           *rk  = (TS_RK *)ts->data;
@@ -788,6 +988,10 @@ static PetscErrorCode TSStep_RK(TS ts)
   PetscReal        next_time_step = ts->time_step;
 
   PetscFunctionBegin;
+  if (rk->lowstorage) {
+    PetscCall(TSStep_RK_LowStorage(ts));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   if (ts->steprollback || ts->steprestart) FSAL = PETSC_FALSE;
   if (FSAL) PetscCall(VecCopy(YdotRHS[s - 1], YdotRHS[0]));
   rk->newtableau = PETSC_FALSE;
@@ -1068,6 +1272,12 @@ static PetscErrorCode TSInterpolate_RK(TS ts, PetscReal itime, Vec X)
   default:
     SETERRQ(PetscObjectComm((PetscObject)ts), PETSC_ERR_PLIB, "Invalid TSStepStatus");
   }
+  if (rk->lowstorage) { /* the registered interpolation formula is linear, X = X0 + t (U - X0) */
+    PetscCheck(rk->X0 && rk->status == TS_STEP_COMPLETE && p == 1, PetscObjectComm((PetscObject)ts), PETSC_ERR_SUP, "The low-storage formula of TSRK %s can only interpolate the final step, use -ts_rk_low_storage 0", rk->tableau->name);
+    if (X != ts->vec_sol) PetscCall(VecCopy(ts->vec_sol, X));
+    PetscCall(VecAXPBY(X, 1 - t, t, rk->X0));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   PetscCall(PetscMalloc1(s, &b));
   for (i = 0; i < s; i++) b[i] = 0;
   for (j = 0, tt = t; j < p; j++, tt *= t) {
@@ -1089,6 +1299,13 @@ static PetscErrorCode TSRKTableauReset(TS ts)
   PetscFunctionBegin;
   if (!tab) PetscFunctionReturn(PETSC_SUCCESS);
   PetscCall(PetscFree(rk->work));
+  if (rk->lowstorage) { /* the stages are references to ts->vec_sol */
+    PetscCall(PetscFree(rk->Y));
+    PetscCall(VecDestroy(&rk->dU));
+    PetscCall(VecDestroy(&rk->F));
+    PetscCall(VecDestroy(&rk->X0));
+    rk->lowstorage = PETSC_FALSE;
+  }
   PetscCall(VecDestroyVecs(tab->s, &rk->Y));
   PetscCall(VecDestroyVecs(tab->s, &rk->YdotRHS));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -1103,6 +1320,7 @@ static PetscErrorCode TSReset_RK(TS ts)
   } else {
     PetscTryMethod(ts, "TSReset_RK_MultirateNonsplit_C", (TS), (ts));
   }
+  if (((TS_RK *)ts->data)->lts) PetscCall(TSReset_RK_LTS(ts));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -1137,6 +1355,15 @@ static PetscErrorCode TSRKTableauSetUp(TS ts)
 
   PetscFunctionBegin;
   PetscCall(PetscMalloc1(tab->s, &rk->work));
+  rk->lowstorage = (PetscBool)(tab->lsA && rk->use_lowstorage && !ts->trajectory && !ts->forward_solve && !ts->costintegralfwd && !rk->use_multirate && !rk->lts);
+  if (rk->lowstorage) {
+    PetscCall(PetscMalloc1(tab->s, &rk->Y));
+    for (PetscInt i = 0; i < tab->s; i++) rk->Y[i] = ts->vec_sol;
+    PetscCall(VecDuplicate(ts->vec_sol, &rk->dU));
+    PetscCall(VecDuplicate(ts->vec_sol, &rk->F));
+    rk->newtableau = PETSC_TRUE;
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   PetscCall(VecDuplicateVecs(ts->vec_sol, tab->s, &rk->Y));
   PetscCall(VecDuplicateVecs(ts->vec_sol, tab->s, &rk->YdotRHS));
   rk->newtableau = PETSC_TRUE;
@@ -1163,6 +1390,7 @@ static PetscErrorCode TSSetUp_RK(TS ts)
   } else {
     PetscTryMethod(ts, "TSSetUp_RK_MultirateNonsplit_C", (TS), (ts));
   }
+  if (((TS_RK *)ts->data)->lts) PetscCall(TSSetUp_RK_LTS(ts));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -1186,6 +1414,8 @@ static PetscErrorCode TSSetFromOptions_RK(TS ts, PetscOptionItems PetscOptionsOb
     PetscCall(PetscOptionsEList("-ts_rk_type", "Family of RK method", "TSRKSetType", (const char *const *)namelist, count, rk->tableau->name, &choice, &flg));
     if (flg) PetscCall(TSRKSetType(ts, namelist[choice]));
     PetscCall(PetscFree(namelist));
+    PetscCall(PetscOptionsBool("-ts_rk_low_storage", "Use the low-storage formula of the RK method if it has one", "TSRKRegisterLowStorage", rk->use_lowstorage, &rk->use_lowstorage, NULL));
+    if (rk->lts) PetscCall(TSSetFromOptions_RK_LTS(ts, PetscOptionsObject));
   }
   PetscOptionsHeadEnd();
   PetscOptionsBegin(PetscObjectComm((PetscObject)ts), NULL, "Multirate methods options", "");
@@ -1216,6 +1446,8 @@ static PetscErrorCode TSView_RK(TS ts, PetscViewer viewer)
     PetscCall(PetscViewerASCIIPrintf(viewer, "  FSAL property: %s\n", FSAL ? "yes" : "no"));
     PetscCall(PetscFormatRealArray(buf, sizeof(buf), "% 8.6f", s, c));
     PetscCall(PetscViewerASCIIPrintf(viewer, "  Abscissa c = %s\n", buf));
+    if (tab->lsA) PetscCall(PetscViewerASCIIPrintf(viewer, "  Low-storage formula: %s\n", rk->lowstorage ? "in use" : "not in use"));
+    if (rk->lts) PetscCall(TSView_RK_LTS(ts, viewer));
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1337,7 +1569,7 @@ static PetscErrorCode TSRKSetType_RK(TS ts, TSRKType rktype)
       if (ts->setupcalled) PetscCall(TSRKTableauReset(ts));
       rk->tableau = &link->tab;
       if (ts->setupcalled) PetscCall(TSRKTableauSetUp(ts));
-      ts->default_adapt_type = rk->tableau->bembed ? TSADAPTBASIC : TSADAPTNONE;
+      ts->default_adapt_type = rk->tableau->bembed && !rk->lts ? TSADAPTBASIC : TSADAPTNONE;
       PetscFunctionReturn(PETSC_SUCCESS);
     }
   }
@@ -1349,6 +1581,7 @@ static PetscErrorCode TSGetStages_RK(TS ts, PetscInt *ns, Vec **Y)
   TS_RK *rk = (TS_RK *)ts->data;
 
   PetscFunctionBegin;
+  PetscCheck(!rk->lowstorage, PetscObjectComm((PetscObject)ts), PETSC_ERR_SUP, "The low-storage formula of TSRK %s does not store the stages, use -ts_rk_low_storage 0", rk->tableau->name);
   if (ns) *ns = rk->tableau->s;
   if (Y) *Y = rk->Y;
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -1358,6 +1591,7 @@ static PetscErrorCode TSDestroy_RK(TS ts)
 {
   PetscFunctionBegin;
   PetscCall(TSReset_RK(ts));
+  PetscCall(TSDestroy_RK_LTS(ts));
   if (ts->dm) {
     PetscCall(DMCoarsenHookRemove(ts->dm, DMCoarsenHook_TSRK, DMRestrictHook_TSRK, ts));
     PetscCall(DMSubDomainHookRemove(ts->dm, DMSubDomainHook_TSRK, DMSubDomainRestrictHook_TSRK, ts));
@@ -1369,6 +1603,8 @@ static PetscErrorCode TSDestroy_RK(TS ts)
   PetscCall(PetscObjectComposeFunction((PetscObject)ts, "TSRKGetTableau_C", NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)ts, "TSRKSetMultirate_C", NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)ts, "TSRKGetMultirate_C", NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)ts, "TSRKSetLocalTimeStepping_C", NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)ts, "TSRKGetLocalTimeSteppingLevels_C", NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)ts, "TSSetUp_RK_MultirateSplit_C", NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)ts, "TSReset_RK_MultirateSplit_C", NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)ts, "TSSetUp_RK_MultirateNonsplit_C", NULL));
@@ -1457,6 +1693,69 @@ PetscErrorCode TSRKGetMultirate(TS ts, PetscBool *use_multirate)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@C
+  TSRKSetLocalTimeStepping - Use local time-stepping with the `TSRK` method, the degrees of freedom take steps of size h/2^l
+  on the level l given by their largest stable time step
+
+  Logically Collective
+
+  Input Parameters:
++ ts      - timestepping context
+. dtlocal - function that computes the largest stable time step of each degree of freedom, see `TSRKLocalTimeStepFn`
+. rhs     - [optional] right-hand side restricted to a subset of the rows, see `TSRKLocalRHSFunctionFn`
+- ctx     - [optional] user-defined context for `dtlocal` and `rhs`
+
+  Options Database Keys:
++ -ts_rk_lts_max_levels <8> - maximum number of levels
+- -ts_rk_lts_rebin <1>      - number of steps between two binnings of the degrees of freedom into levels
+
+  Level: advanced
+
+  Notes:
+  The step size h of the `TS` is the step of the coarsest level, the degrees of freedom with a local time step smaller than h/2^l,
+  according to `dtlocal`, take at least 2^(l+1) substeps. A step of level l is followed by two steps of level l+1, the values of the
+  coarser degrees of freedom at the stage times of the finer levels are given by the interpolation formula of the `TSRK` method,
+  so the method must have one, for example `TSRK3BS` or `TSRK5DP`. It is an error for a degree of freedom to need more levels than
+  the maximum number set with `-ts_rk_lts_max_levels`.
+
+  The savings come from computing only the rows of level l and finer during the steps of level l, which requires `rhs`; without it
+  the whole right-hand side given with `TSSetRHSFunction()` is computed for each stage of each level. The step size is not adapted
+  and the coupling between the levels is not conservative: use a step size that is stable for the coarsest degrees of freedom.
+
+.seealso: [](ch_ts), `TSRK`, `TSRKGetLocalTimeSteppingLevels()`, `TSRKSetMultirate()`, `TSRKLocalTimeStepFn`, `TSRKLocalRHSFunctionFn`
+@*/
+PetscErrorCode TSRKSetLocalTimeStepping(TS ts, TSRKLocalTimeStepFn *dtlocal, TSRKLocalRHSFunctionFn *rhs, void *ctx)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(ts, TS_CLASSID, 1);
+  PetscTryMethod(ts, "TSRKSetLocalTimeStepping_C", (TS, TSRKLocalTimeStepFn *, TSRKLocalRHSFunctionFn *, void *), (ts, dtlocal, rhs, ctx));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@C
+  TSRKGetLocalTimeSteppingLevels - Gets the current binning of the degrees of freedom into local time-stepping levels
+
+  Not Collective
+
+  Input Parameter:
+. ts - timestepping context
+
+  Output Parameters:
++ nlevels - the number of levels, 0 before the first step
+- count   - the global number of degrees of freedom on each level, owned by the `TS`
+
+  Level: advanced
+
+.seealso: [](ch_ts), `TSRK`, `TSRKSetLocalTimeStepping()`
+@*/
+PetscErrorCode TSRKGetLocalTimeSteppingLevels(TS ts, PetscInt *nlevels, const PetscInt *count[])
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(ts, TS_CLASSID, 1);
+  PetscUseMethod(ts, "TSRKGetLocalTimeSteppingLevels_C", (TS, PetscInt *, const PetscInt *[]), (ts, nlevels, count));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*MC
       TSRK - ODE and DAE solver using Runge-Kutta schemes
 
@@ -1469,7 +1768,7 @@ PetscErrorCode TSRKGetMultirate(TS ts, PetscBool *use_multirate)
   The default is `TSRK3BS`, it can be changed with `TSRKSetType()` or -ts_rk_type
 
 .seealso: [](ch_ts), `TSCreate()`, `TS`, `TSRK`, `TSSetType()`, `TSRKSetType()`, `TSRKGetType()`, `TSRK2D`, `TSRK2E`, `TSRK3`,
-          `TSRK4`, `TSRK5`, `TSRKPRSSP2`, `TSRKBPR3`, `TSRKType`, `TSRKRegister()`, `TSRKSetMultirate()`, `TSRKGetMultirate()`, `TSType`
+          `TSRK4`, `TSRK5`, `TSRKPRSSP2`, `TSRKBPR3`, `TSRK3LS`, `TSRK4LS`, `TSRKType`, `TSRKRegister()`, `TSRKSetMultirate()`, `TSRKGetMultirate()`, `TSRKSetLocalTimeStepping()`, `TSType`
 M*/
 PETSC_EXTERN PetscErrorCode TSCreate_RK(TS ts)
 {
@@ -1512,8 +1811,11 @@ PETSC_EXTERN PetscErrorCode TSCreate_RK(TS ts)
   PetscCall(PetscObjectComposeFunction((PetscObject)ts, "TSRKGetTableau_C", TSRKGetTableau_RK));
   PetscCall(PetscObjectComposeFunction((PetscObject)ts, "TSRKSetMultirate_C", TSRKSetMultirate_RK));
   PetscCall(PetscObjectComposeFunction((PetscObject)ts, "TSRKGetMultirate_C", TSRKGetMultirate_RK));
+  PetscCall(PetscObjectComposeFunction((PetscObject)ts, "TSRKSetLocalTimeStepping_C", TSRKSetLocalTimeStepping_RK));
+  PetscCall(PetscObjectComposeFunction((PetscObject)ts, "TSRKGetLocalTimeSteppingLevels_C", TSRKGetLocalTimeSteppingLevels_RK));
 
   PetscCall(TSRKSetType(ts, TSRKDefault));
-  rk->dtratio = 1;
+  rk->dtratio        = 1;
+  rk->use_lowstorage = PETSC_TRUE;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
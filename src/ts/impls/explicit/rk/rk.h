@@ -10,6 +10,7 @@ struct _RKTableau {
   PetscReal *bembed;    /* Embedded formula of order one less (order-1)               */
   PetscReal *binterp;   /* Dense output formula                                       */
   PetscReal  ccfl;      /* Placeholder for CFL coefficient relative to forward Euler  */
+  PetscReal *lsA, *lsB; /* Low-storage 2N formula, NULL if not available              */
 };
 typedef struct _RKTableauLink *RKTableauLink;
 struct _RKTableauLink {
@@ -17,10 +18,15 @@ struct _RKTableauLink {
   RKTableauLink     next;
 };
 
+typedef struct _n_TSRK_LTS *TSRK_LTS;
+
 typedef struct {
   RKTableau    tableau;
   PetscBool    newtableau; /* flag to indicate if tableau has changed */
-  Vec          X0;
+  Vec          X0;             /* Solution at the start of the step, kept by the low-storage formula when needed */
+  Vec          dU, F;          /* Registers of the low-storage formula                                         */
+  PetscBool    use_lowstorage; /* flag to use the low-storage formula of the tableau if it has one             */
+  PetscBool    lowstorage;     /* flag indicates the step uses the low-storage formula                         */
   Vec         *Y;            /* States computed during the step                                              */
   Vec         *YdotRHS;      /* Function evaluations for the non-stiff part and contains all components      */
   Vec         *YdotRHS_fast; /* Function evaluations for the non-stiff part and contains fast components     */
@@ -41,6 +47,7 @@ typedef struct {
   IS           is_fast, is_slow;
   TS           subts_fast, subts_slow, subts_current, ts_root;
   PetscBool    use_multirate;
+  TSRK_LTS     lts; /* local time-stepping, see lts.c */
   Mat          MatFwdSensip0;
   Mat         *MatsFwdStageSensip;
   Mat         *MatsFwdSensipTemp;
@@ -0,0 +1,613 @@
+/*
+  Code for timestepping with exponential Rosenbrock methods
+
+  Notes:
+  The general system is written as
+
+  Udot = F(t,U)
+
+  and is split at the beginning of each step as Udot = J U + N(t,U), with J the Jacobian of F at the initial solution of
+  the step, so that the stiff linear part is integrated exactly with the phi-functions of h J. The products of the
+  phi-functions with vectors are approximated in the Krylov subspace of J, whose dimension is chosen adaptively.
+*/
+#include <petsc/private/tsimpl.h> /*I   "petscts.h"   I*/
+#include <petscblaslapack.h>
+
+typedef struct {
+  TSExpRBType  type;
+  PetscInt     order;     /* order of the method, the embedded method is of order order-1 */
+  PetscBool    mf;        /* use a matrix-free Jacobian */
+  PetscInt     maxdim;    /* maximum dimension of the Krylov subspaces */
+  PetscReal    rtol;      /* relative tolerance of the Krylov approximations */
+  PetscInt     nkrylov;   /* total number of Krylov iterations, for the view */
+  Mat          J, Jpre;   /* Jacobian of F, J is owned if matrix-free */
+  PetscReal    stage_time;
+  Vec          X0;        /* initial solution of the step */
+  Vec          F0;        /* F(t,X0) */
+  Vec          W;         /* h phi_1(h J) F0 */
+  Vec          D;         /* nonlinear remainder N(U2) - N(X0) */
+  Vec          Xembed;    /* embedded solution X0 + W */
+  Vec          Z[2];      /* work vectors of the substeps of the phi-functions */
+  Vec         *V;         /* Krylov basis, maxdim + 1 vectors */
+  PetscScalar *H;         /* Hessenberg matrix of the Arnoldi process, (maxdim + 1) x maxdim */
+  PetscScalar *work;      /* augmented matrix, its exponential, and workspace */
+  TSStepStatus status;
+} TS_ExpRB;
+
+static const char *const TSExpRBTypes[] = {TSEXPRBEULER, TSEXPRB32};
+
+/*
+  E = exp(A) for the column-major n x n matrix A with scaling and squaring of the Taylor series, work has 2 n^2 entries
+*/
+static PetscErrorCode TSExpRBExpm_Private(PetscInt n, PetscScalar *A, PetscScalar *E, PetscScalar *work)
+{
+  PetscScalar *T = work, *P = work + n * n, sone = 1, szero = 0;
+  PetscReal    nrm = 0, scale = 1;
+  PetscInt     s   = 0;
+  PetscBLASInt bn;
+
+  PetscFunctionBegin;
+  PetscCall(PetscBLASIntCast(n, &bn));
+  for (PetscInt j = 0; j < n; j++) {
+    PetscReal c = 0;
+
+    for (PetscInt i = 0; i < n; i++) c += PetscAbsScalar(A[i + j * n]);
+    nrm = PetscMax(nrm, c);
+  }
+  while (nrm > 0.5) {
+    nrm /= 2;
+    scale /= 2;
+    s++;
+  }
+  for (PetscInt i = 0; i < n * n; i++) A[i] *= scale;
+  /* Taylor series, the terms decrease at least as 2^-k */
+  PetscCall(PetscArrayzero(E, n * n));
+  PetscCall(PetscArrayzero(T, n * n));
+  for (PetscInt i = 0; i < n; i++) E[i + i * n] = T[i + i * n] = 1;
+  for (PetscInt k = 1; k <= 30; k++) {
+    PetscScalar ik   = 1 / (PetscReal)k;
+    PetscReal   tnrm = 0;
+
+    PetscCallBLAS("BLASgemm", BLASgemm_("N", "N", &bn, &bn, &bn, &ik, T, &bn, A, &bn, &szero, P, &bn));
+    for (PetscInt i = 0; i < n * n; i++) {
+      T[i] = P[i];
+      E[i] += T[i];
+      tnrm = PetscMax(tnrm, PetscAbsScalar(T[i]));
+    }
+    if (tnrm < PETSC_MACHINE_EPSILON) break;
+  }
+  for (PetscInt q = 0; q < s; q++) {
+    PetscCallBLAS("BLASgemm", BLASgemm_("N", "N", &bn, &bn, &bn, &sone, E, &bn, E, &bn, &szero, P, &bn));
+    PetscCall(PetscArraycpy(E, P, n * n));
+  }
+  PetscCall(PetscLogFlops(2.0 * n * n * n * (s + 10)));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+  phi[j*m + i] = (phi_j(h H_m) e_1)_i for j = 0, ..., k + 1, from the exponential of the augmented matrix
+
+    [h H_m  e_1  0 ]
+    [  0     0   I ]
+    [  0     0   0 ]
+
+  of dimension m + k + 1, whose leading block is exp(h H_m) = phi_0(h H_m)
+*/
+static PetscErrorCode TSExpRBPhiHessenberg_Private(TS ts, PetscInt m, PetscInt k, PetscReal h, PetscScalar *phi)
+{
+  TS_ExpRB    *exprb = (TS_ExpRB *)ts->data;
+  PetscInt     n     = m + k + 1, ld = exprb->maxdim + 1;
+  PetscScalar *A = exprb->work, *E = A + n * n, *work = E + n * n;
+
+  PetscFunctionBegin;
+  PetscCall(PetscArrayzero(A, n * n));
+  for (PetscInt j = 0; j < m; j++)
+    for (PetscInt i = 0; i <= PetscMin(j + 1, m - 1); i++) A[i + j * n] = h * exprb->H[i + j * ld];
+  A[0 + m * n] = 1;
+  for (PetscInt j = m; j < n - 1; j++) A[j + (j + 1) * n] = 1;
+  PetscCall(TSExpRBExpm_Private(n, A, E, work));
+  for (PetscInt i = 0; i < m; i++) phi[i] = E[i];
+  for (PetscInt j = 0; j <= k; j++)
+    for (PetscInt i = 0; i < m; i++) phi[(j + 1) * m + i] = E[i + (m + j) * n];
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+  Norm of W = beta V_m sum_j a[j] h^j phi_j(h H_m) e_1 for j = 0, ..., k and the estimate
+  beta h_{m+1,m} h |sum_j a[j] h^j e_m^T phi_{j+1}(h H_m) e_1| of its error, phi holds the phi-functions on exit
+*/
+static PetscErrorCode TSExpRBKrylovError_Private(TS ts, PetscInt m, PetscInt k, PetscReal h, const PetscReal a[], PetscReal beta, PetscReal hnext, PetscScalar *phi, PetscReal *err, PetscReal *nrm)
+{
+  PetscScalar e = 0;
+
+  PetscFunctionBegin;
+  PetscCall(TSExpRBPhiHessenberg_Private(ts, m, k, h, phi));
+  *nrm = 0;
+  for (PetscInt i = 0; i < m; i++) {
+    PetscScalar w = 0;
+
+    for (PetscInt l = 0; l <= k; l++) w += a[l] * PetscPowReal(h, (PetscReal)l) * phi[l * m + i];
+    *nrm += PetscRealPart(w * PetscConj(w));
+  }
+  for (PetscInt l = 0; l <= k; l++) e += a[l] * PetscPowReal(h, (PetscReal)l) * phi[(l + 1) * m + m - 1];
+  *nrm = beta * PetscSqrtReal(*nrm);
+  *err = beta * hnext * h * PetscAbsScalar(e);
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+  W = sum_j a[j] h^j phi_j(h J) B for j = 0, ..., k with the Arnoldi process, the dimension of the Krylov subspace is
+  increased until the error estimate is below rtol ||W||. If it is not within the maximal dimension, h is halved until
+  it is, with the same Krylov subspace.
+*/
+static PetscErrorCode TSExpRBKrylov_Private(TS ts, PetscInt k, PetscReal *h, const PetscReal a[], Vec B, Vec W, PetscBool *converged)
+{
+  TS_ExpRB    *exprb = (TS_ExpRB *)ts->data;
+  PetscInt     ld    = exprb->maxdim + 1, m = 0;
+  PetscScalar *H = exprb->H, *phi, *hcol;
+  Vec         *V = exprb->V;
+  PetscReal    beta, hnext = 0, err = 0, nrm = 0, h0 = *h;
+
+  PetscFunctionBegin;
+  *converged = PETSC_FALSE;
+  PetscCall(VecNorm(B, NORM_2, &beta));
+  if (beta == 0) {
+    PetscCall(VecSet(W, 0));
+    *converged = PETSC_TRUE;
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  PetscCall(PetscMalloc2((k + 2) * exprb->maxdim, &phi, ld, &hcol));
+  PetscCall(VecAXPBY(V[0], 1 / beta, 0, B));
+  for (PetscInt j = 0; j < exprb->maxdim; j++) {
+    PetscCall(MatMult(exprb->J, V[j], V[j + 1]));
+    /* classical Gram-Schmidt with one reorthogonalization */
+    PetscCall(PetscArrayzero(&H[j * ld], ld));
+    for (PetscInt r = 0; r < 2; r++) {
+      PetscCall(VecMDot(V[j + 1], j + 1, V, hcol));
+      for (PetscInt i = 0; i <= j; i++) {
+        H[i + j * ld] += hcol[i];
+        hcol[i] = -hcol[i];
+      }
+      PetscCall(VecMAXPY(V[j + 1], j + 1, hcol, V));
+    }
+    PetscCall(VecNorm(V[j + 1], NORM_2, &hnext));
+    H[j + 1 + j * ld] = hnext;
+    m                 = j + 1;
+    exprb->nkrylov++;
+
+    PetscCall(TSExpRBKrylovError_Private(ts, m, k, *h, a, beta, hnext, phi, &err, &nrm));
+    if (hnext <= PETSC_SMALL * beta || err <= exprb->rtol * nrm) { /* happy breakdown or converged */
+      *converged = PETSC_TRUE;
+      break;
+    }
+    PetscCall(VecScale(V[j + 1], 1 / hnext));
+  }
+  while (!*converged && *h > PETSC_SMALL * h0) {
+    *h /= 2;
+    PetscCall(TSExpRBKrylovError_Private(ts, m, k, *h, a, beta, hnext, phi, &err, &nrm));
+    if (err <= exprb->rtol * nrm) *converged = PETSC_TRUE;
+  }
+  PetscCall(PetscInfo(ts, "Krylov approximation of the phi-functions of %g J, dimension %" PetscInt_FMT ", error estimate %g relative to %g\n", (double)*h, m, (double)err, (double)nrm));
+  if (*converged) {
+    for (PetscInt i = 0; i < m; i++) {
+      hcol[i] = 0;
+      for (PetscInt l = 0; l <= k; l++) hcol[i] += beta * a[l] * PetscPowReal(*h, (PetscReal)l) * phi[l * m + i];
+    }
+    PetscCall(VecSet(W, 0));
+    PetscCall(VecMAXPY(W, m, hcol, V));
+  }
+  PetscCall(PetscFree2(phi, hcol));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+  W = h phi_k(h J) B, for k = 1, ..., 3
+
+  u(tau) = tau^k phi_k(tau J) B solves u' = J u + tau^(k-1) / (k-1)! B with u(0) = 0, so that over a substep
+  [tau, tau + s] of [0, h]
+
+    u(tau + s) = phi_0(s J) u(tau) + sum_j tau^(k-j) / (k-j)! s^j phi_j(s J) B,  j = 1, ..., k
+
+  as in the time-stepping of phipm (Niesen and Wright, 2012). The whole step h is tried first, and the substeps are
+  shortened while the Krylov approximations do not converge within the maximal dimension, so the time step of the TS
+  is kept.
+*/
+static PetscErrorCode TSExpRBPhi_Private(TS ts, PetscInt k, PetscReal h, Vec B, Vec W, PetscBool *converged)
+{
+  TS_ExpRB       *exprb = (TS_ExpRB *)ts->data;
+  const PetscReal one   = 1;
+  PetscReal       tau = 0, s = h, a[4];
+  PetscInt        nsub = 0;
+
+  PetscFunctionBegin;
+  *converged = PETSC_TRUE;
+  PetscCall(VecSet(W, 0));
+  while (tau < h) {
+    PetscReal fact = 1, su;
+
+    s    = PetscMin(s, h - tau);
+    a[0] = 0;
+    for (PetscInt j = k; j >= 1; j--) {
+      a[j] = PetscPowReal(tau, (PetscReal)(k - j)) / fact;
+      fact *= k - j + 1;
+    }
+    PetscCall(TSExpRBKrylov_Private(ts, k, &s, a, B, exprb->Z[0], converged));
+    if (!*converged) break;
+    if (tau > 0) {
+      su = s;
+      PetscCall(TSExpRBKrylov_Private(ts, 0, &su, &one, W, exprb->Z[1], converged));
+      if (!*converged) break;
+      if (su < s) { /* redo the substep with the shorter one of the solution */
+        s = su;
+        continue;
+      }
+      PetscCall(VecAXPY(exprb->Z[0], 1, exprb->Z[1]));
+    }
+    PetscCall(VecCopy(exprb->Z[0], W));
+    tau = (h - tau - s <= PETSC_SMALL * h) ? h : tau + s;
+    nsub++;
+  }
+  if (nsub > 1) PetscCall(PetscInfo(ts, "Phi-function %" PetscInt_FMT " of %g J computed in %" PetscInt_FMT " substeps\n", k, (double)h, nsub));
+  /* W = h phi_k(h J) B = h^(1-k) u(h) */
+  if (*converged) PetscCall(VecScale(W, PetscPowReal(h, (PetscReal)(1 - k))));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode TSExpRBMFFDFunction_Private(void *ctx, Vec X, Vec F)
+{
+  TS        ts    = (TS)ctx;
+  TS_ExpRB *exprb = (TS_ExpRB *)ts->data;
+
+  PetscFunctionBegin;
+  PetscCall(TSComputeRHSFunction(ts, exprb->stage_time, X, F));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+  Computes the Jacobian at the initial solution of the step, or sets the base of the matrix-free one
+*/
+static PetscErrorCode TSExpRBComputeJacobian_Private(TS ts, PetscReal t)
+{
+  TS_ExpRB *exprb = (TS_ExpRB *)ts->data;
+
+  PetscFunctionBegin;
+  exprb->stage_time = t;
+  if (exprb->mf) PetscCall(MatMFFDSetBase(exprb->J, exprb->X0, exprb->F0));
+  else PetscCall(TSComputeRHSJacobian(ts, t, exprb->X0, exprb->J, exprb->Jpre));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode TSStep_ExpRB(TS ts)
+{
+  TS_ExpRB *exprb = (TS_ExpRB *)ts->data;
+  TSAdapt   adapt;
+  PetscInt  rejections = 0;
+  PetscBool converged, stageok, accept = PETSC_TRUE;
+  PetscReal next_time_step = ts->time_step;
+
+  PetscFunctionBegin;
+  PetscCall(TSGetAdapt(ts, &adapt));
+  PetscCall(VecCopy(ts->vec_sol, exprb->X0));
+  PetscCall(TSComputeRHSFunction(ts, ts->ptime, exprb->X0, exprb->F0));
+  PetscCall(TSExpRBComputeJacobian_Private(ts, ts->ptime));
+
+  exprb->status = TS_STEP_INCOMPLETE;
+  while (!ts->reason && exprb->status != TS_STEP_COMPLETE) {
+    const PetscReal t = ts->ptime, h = ts->time_step;
+
+    /* exponential Rosenbrock-Euler stage, U2 = X0 + h phi_1(h J) F0 */
+    PetscCall(TSPreStage(ts, t));
+    PetscCall(TSExpRBPhi_Private(ts, 1, h, exprb->F0, exprb->W, &converged));
+    if (!converged) goto krylov_failed;
+    PetscCall(VecWAXPY(exprb->Xembed, 1, exprb->W, exprb->X0));
+    PetscCall(VecCopy(exprb->Xembed, ts->vec_sol));
+    if (exprb->order > 2) {
+      /* D = N(U2) - N(X0) = F(U2) - F0 - J (U2 - X0), U1 = U2 + 2 h phi_3(h J) D */
+      PetscCall(TSPostStage(ts, t, 0, &exprb->Xembed));
+      PetscCall(TSAdaptCheckStage(adapt, ts, t + h, exprb->Xembed, &stageok));
+      if (!stageok) goto reject_step;
+      PetscCall(TSPreStage(ts, t + h));
+      exprb->stage_time = t;
+      PetscCall(MatMult(exprb->J, exprb->W, exprb->D));
+      PetscCall(VecAXPY(exprb->D, 1, exprb->F0));
+      PetscCall(TSComputeRHSFunction(ts, t + h, exprb->Xembed, ts->vec_sol));
+      PetscCall(VecAYPX(exprb->D, -1, ts->vec_sol));
+      PetscCall(TSExpRBPhi_Private(ts, 3, h, exprb->D, exprb->W, &converged));
+      if (!converged) goto krylov_failed;
+      PetscCall(VecWAXPY(ts->vec_sol, 2, exprb->W, exprb->Xembed));
+      PetscCall(TSPostStage(ts, t + h, 1, &ts->vec_sol));
+    } else PetscCall(TSPostStage(ts, t, 0, &ts->vec_sol));
+    PetscCall(TSAdaptCheckStage(adapt, ts, t + h, ts->vec_sol, &stageok));
+    if (!stageok) goto reject_step;
+
+    exprb->status = TS_STEP_PENDING;
+    PetscCall(TSAdaptCandidatesClear(adapt));
+    PetscCall(TSAdaptCandidateAdd(adapt, exprb->type, exprb->order, 1, 1.0, (PetscReal)exprb->order - 1, PETSC_TRUE));
+    PetscCall(TSAdaptChoose(adapt, ts, ts->time_step, NULL, &next_time_step, &accept));
+    exprb->status = accept ? TS_STEP_COMPLETE : TS_STEP_INCOMPLETE;
+    if (!accept) {
+      PetscCall(VecCopy(exprb->X0, ts->vec_sol));
+      ts->time_step = next_time_step;
+      goto reject_step;
+    }
+    ts->ptime += ts->time_step;
+    ts->time_step = next_time_step;
+    break;
+
+  krylov_failed:
+    PetscCall(PetscInfo(ts, "Step=%" PetscInt_FMT ", Krylov approximation did not converge in %" PetscInt_FMT " iterations even in substeps, halving the time step\n", ts->steps, exprb->maxdim));
+    PetscCall(VecCopy(exprb->X0, ts->vec_sol));
+    ts->time_step /= 2;
+  reject_step:
+    ts->reject++;
+    accept = PETSC_FALSE;
+    if (!ts->reason && ++rejections > ts->max_reject && ts->max_reject >= 0) {
+      ts->reason = TS_DIVERGED_STEP_REJECTED;
+      PetscCall(PetscInfo(ts, "Step=%" PetscInt_FMT ", step rejections %" PetscInt_FMT " greater than current TS allowed, stopping solve\n", ts->steps, rejections));
+    }
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode TSEvaluateStep_ExpRB(TS ts, PetscInt order, Vec X, PetscBool *done)
+{
+  TS_ExpRB *exprb = (TS_ExpRB *)ts->data;
+
+  PetscFunctionBegin;
+  if (order == exprb->order) {
+    PetscCall(VecCopy(ts->vec_sol, X));
+    if (done) *done = PETSC_TRUE;
+  } else if (order == exprb->order - 1 && exprb->order > 2) {
+    PetscCall(VecCopy(exprb->Xembed, X));
+    if (done) *done = PETSC_TRUE;
+  } else if (done) *done = PETSC_FALSE;
+  else SETERRQ(PetscObjectComm((PetscObject)ts), PETSC_ERR_SUP, "TSEXPRB %s of order %" PetscInt_FMT " cannot evaluate step at order %" PetscInt_FMT ". Consider using -ts_adapt_type none or the method %s that has an embedded estimate.", exprb->type, exprb->order, order, TSEXPRB32);
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode TSRollBack_ExpRB(TS ts)
+{
+  TS_ExpRB *exprb = (TS_ExpRB *)ts->data;
+
+  PetscFunctionBegin;
+  PetscCall(VecCopy(exprb->X0, ts->vec_sol));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode TSInterpolate_ExpRB(TS ts, PetscReal t, Vec X)
+{
+  TS_ExpRB *exprb = (TS_ExpRB *)ts->data;
+  PetscReal h     = ts->ptime - ts->ptime_prev, alpha = (ts->ptime - t) / h;
+
+  PetscFunctionBegin;
+  /* linear interpolation, as in TSEULER */
+  if (X != ts->vec_sol) PetscCall(VecCopy(ts->vec_sol, X));
+  PetscCall(VecAXPBY(X, alpha, 1.0 - alpha, exprb->X0));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode TSSetUp_ExpRB(TS ts)
+{
+  TS_ExpRB        *exprb = (TS_ExpRB *)ts->data;
+  TSRHSJacobianFn *rhsjac;
+  PetscInt         n, N, na = exprb->maxdim + 5;
+
+  PetscFunctionBegin;
+  PetscCall(TSCheckImplicitTerm(ts));
+  PetscCall(VecDuplicate(ts->vec_sol, &exprb->X0));
+  PetscCall(VecDuplicate(ts->vec_sol, &exprb->F0));
+  PetscCall(VecDuplicate(ts->vec_sol, &exprb->W));
+  PetscCall(VecDuplicate(ts->vec_sol, &exprb->D));
+  PetscCall(VecDuplicate(ts->vec_sol, &exprb->Xembed));
+  PetscCall(VecDuplicate(ts->vec_sol, &exprb->Z[0]));
+  PetscCall(VecDuplicate(ts->vec_sol, &exprb->Z[1]));
+  PetscCall(VecDuplicateVecs(ts->vec_sol, exprb->maxdim + 1, &exprb->V));
+  PetscCall(PetscMalloc2((exprb->maxdim + 1) * exprb->maxdim, &exprb->H, 4 * na * na, &exprb->work));
+
+  PetscCall(TSGetRHSJacobian(ts, NULL, NULL, &rhsjac, NULL));
+  if (!rhsjac) exprb->mf = PETSC_TRUE;
+  if (exprb->mf) {
+    PetscCall(VecGetLocalSize(ts->vec_sol, &n));
+    PetscCall(VecGetSize(ts->vec_sol, &N));
+    PetscCall(MatCreateMFFD(PetscObjectComm((PetscObject)ts), n, n, N, N, &exprb->J));
+    PetscCall(MatMFFDSetFunction(exprb->J, TSExpRBMFFDFunction_Private, ts));
+    PetscCall(MatSetOptionsPrefix(exprb->J, ((PetscObject)ts)->prefix));
+    PetscCall(MatAppendOptionsPrefix(exprb->J, "ts_exprb_"));
+    PetscCall(MatSetFromOptions(exprb->J));
+  } else {
+    PetscCall(TSGetRHSJacobian(ts, &exprb->J, &exprb->Jpre, NULL, NULL));
+    PetscCall(PetscObjectReference((PetscObject)exprb->J));
+    PetscCall(PetscObjectReference((PetscObject)exprb->Jpre));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode TSReset_ExpRB(TS ts)
+{
+  TS_ExpRB *exprb = (TS_ExpRB *)ts->data;
+
+  PetscFunctionBegin;
+  PetscCall(VecDestroy(&exprb->X0));
+  PetscCall(VecDestroy(&exprb->F0));
+  PetscCall(VecDestroy(&exprb->W));
+  PetscCall(VecDestroy(&exprb->D));
+  PetscCall(VecDestroy(&exprb->Xembed));
+  PetscCall(VecDestroy(&exprb->Z[0]));
+  PetscCall(VecDestroy(&exprb->Z[1]));
+  PetscCall(VecDestroyVecs(exprb->maxdim + 1, &exprb->V));
+  PetscCall(PetscFree2(exprb->H, exprb->work));
+  PetscCall(MatDestroy(&exprb->J));
+  PetscCall(MatDestroy(&exprb->Jpre));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode TSDestroy_ExpRB(TS ts)
+{
+  PetscFunctionBegin;
+  PetscCall(TSReset_ExpRB(ts));
+  PetscCall(PetscFree(ts->data));
+  PetscCall(PetscObjectComposeFunction((PetscObject)ts, "TSExpRBSetType_C", NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)ts, "TSExpRBGetType_C", NULL));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode TSSetFromOptions_ExpRB(TS ts, PetscOptionItems PetscOptionsObject)
+{
+  TS_ExpRB *exprb = (TS_ExpRB *)ts->data;
+  PetscInt  choice;
+  PetscBool flg;
+
+  PetscFunctionBegin;
+  PetscOptionsHeadBegin(PetscOptionsObject, "Exponential Rosenbrock ODE solver options");
+  PetscCall(PetscOptionsEList("-ts_exprb_type", "Exponential Rosenbrock method", "TSExpRBSetType", TSExpRBTypes, PETSC_STATIC_ARRAY_LENGTH(TSExpRBTypes), exprb->type, &choice, &flg));
+  if (flg) PetscCall(TSExpRBSetType(ts, TSExpRBTypes[choice]));
+  PetscCall(PetscOptionsBool("-ts_exprb_mf", "Use a matrix-free Jacobian even if one is provided", "TSEXPRB", exprb->mf, &exprb->mf, NULL));
+  PetscCall(PetscOptionsBoundedInt("-ts_exprb_krylov_maxdim", "Maximum dimension of the Krylov subspaces", "TSEXPRB", exprb->maxdim, &exprb->maxdim, NULL, 1));
+  PetscCall(PetscOptionsReal("-ts_exprb_krylov_rtol", "Relative tolerance of the Krylov approximations of the phi-functions", "TSEXPRB", exprb->rtol, &exprb->rtol, NULL));
+  PetscOptionsHeadEnd();
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode TSView_ExpRB(TS ts, PetscViewer viewer)
+{
+  TS_ExpRB *exprb = (TS_ExpRB *)ts->data;
+  PetscBool iascii;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectTypeCompare((PetscObject)viewer, PETSCVIEWERASCII, &iascii));
+  if (iascii) {
+    PetscCall(PetscViewerASCIIPrintf(viewer, "  Exponential Rosenbrock type %s of order %" PetscInt_FMT "\n", exprb->type, exprb->order));
+    PetscCall(PetscViewerASCIIPrintf(viewer, "  Krylov subspaces of dimension at most %" PetscInt_FMT ", relative tolerance %g, %s Jacobian\n", exprb->maxdim, (double)exprb->rtol, exprb->mf ? "matrix-free" : "assembled"));
+    PetscCall(PetscViewerASCIIPrintf(viewer, "  Total number of Krylov iterations %" PetscInt_FMT "\n", exprb->nkrylov));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode TSExpRBSetType_ExpRB(TS ts, TSExpRBType type)
+{
+  TS_ExpRB *exprb = (TS_ExpRB *)ts->data;
+  PetscBool match;
+
+  PetscFunctionBegin;
+  for (PetscInt i = 0; i < (PetscInt)PETSC_STATIC_ARRAY_LENGTH(TSExpRBTypes); i++) {
+    PetscCall(PetscStrcmp(type, TSExpRBTypes[i], &match));
+    if (match) {
+      exprb->type            = TSExpRBTypes[i];
+      exprb->order           = i + 2;
+      ts->default_adapt_type = exprb->order > 2 ? TSADAPTBASIC : TSADAPTNONE;
+      PetscFunctionReturn(PETSC_SUCCESS);
+    }
+  }
+  SETERRQ(PetscObjectComm((PetscObject)ts), PETSC_ERR_ARG_UNKNOWN_TYPE, "Could not find '%s'", type);
+}
+
+static PetscErrorCode TSExpRBGetType_ExpRB(TS ts, TSExpRBType *type)
+{
+  TS_ExpRB *exprb = (TS_ExpRB *)ts->data;
+
+  PetscFunctionBegin;
+  *type = exprb->type;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+  TSExpRBSetType - Set the type of exponential Rosenbrock scheme
+
+  Logically Collective
+
+  Input Parameters:
++ ts   - timestepping context
+- type - type of scheme, `TSEXPRBEULER` or `TSEXPRB32`
+
+  Options Database Key:
+. -ts_exprb_type <32> - set the scheme
+
+  Level: intermediate
+
+.seealso: [](ch_ts), `TSEXPRB`, `TSExpRBGetType()`, `TSExpRBType`
+@*/
+PetscErrorCode TSExpRBSetType(TS ts, TSExpRBType type)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(ts, TS_CLASSID, 1);
+  PetscAssertPointer(type, 2);
+  PetscTryMethod(ts, "TSExpRBSetType_C", (TS, TSExpRBType), (ts, type));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+  TSExpRBGetType - Get the type of exponential Rosenbrock scheme
+
+  Not Collective
+
+  Input Parameter:
+. ts - timestepping context
+
+  Output Parameter:
+. type - type of scheme
+
+  Level: intermediate
+
+.seealso: [](ch_ts), `TSEXPRB`, `TSExpRBSetType()`, `TSExpRBType`
+@*/
+PetscErrorCode TSExpRBGetType(TS ts, TSExpRBType *type)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(ts, TS_CLASSID, 1);
+  PetscAssertPointer(type, 2);
+  PetscUseMethod(ts, "TSExpRBGetType_C", (TS, TSExpRBType *), (ts, type));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*MC
+  TSEXPRB - ODE solver using exponential Rosenbrock methods
+
+  Options Database Keys:
++ -ts_exprb_type <32>               - `TSEXPRBEULER`, the exponential Rosenbrock-Euler method of order 2, or `TSEXPRB32`, the method of order 3 with an embedded method of order 2
+. -ts_exprb_mf                      - use a matrix-free Jacobian computed by differencing the right-hand side, even if a Jacobian is provided with `TSSetRHSJacobian()`
+. -ts_exprb_krylov_maxdim <30>      - maximum dimension of the Krylov subspaces, the phi-functions are computed in substeps of the time step if they are not approximated within this dimension
+- -ts_exprb_krylov_rtol <1e-8>      - relative tolerance of the Krylov approximations of the phi-functions
+
+  Level: advanced
+
+  Notes:
+  The right-hand side is linearized at the beginning of each step, Udot = J U + N(t, U), and the linear part is integrated exactly with the
+  phi-functions of h J, whose products with vectors are approximated in the Krylov subspaces of J. The methods only need products of the Jacobian
+  with vectors and no preconditioner, so they can take steps far above the stability limit of explicit methods on stiff problems whose
+  stiffness is in the linearization. The Jacobian is the one provided with `TSSetRHSJacobian()`, or a `MATMFFD` matrix-free Jacobian, whose
+  options have the prefix -ts_exprb_.
+
+  The order of `TSEXPRB32` is 3 for autonomous problems; the linearization does not include the time derivative of the right-hand side.
+  `TSEXPRBEULER` has no error estimate and uses `TSADAPTNONE` by default. Only explicit problems given with `TSSetRHSFunction()` are supported.
+
+  References:
+. * - M. Hochbruck, A. Ostermann, and J. Schweitzer, Exponential Rosenbrock-type methods, SIAM J. Numer. Anal., 47, 2009.
+
+.seealso: [](ch_ts), `TSCreate()`, `TS`, `TSSetType()`, `TSExpRBSetType()`, `TSROSW`, `TSType`
+M*/
+PETSC_EXTERN PetscErrorCode TSCreate_ExpRB(TS ts)
+{
+  TS_ExpRB *exprb;
+
+  PetscFunctionBegin;
+  PetscCall(PetscNew(&exprb));
+  ts->data = (void *)exprb;
+
+  ts->ops->reset          = TSReset_ExpRB;
+  ts->ops->destroy        = TSDestroy_ExpRB;
+  ts->ops->view           = TSView_ExpRB;
+  ts->ops->setup          = TSSetUp_ExpRB;
+  ts->ops->step           = TSStep_ExpRB;
+  ts->ops->interpolate    = TSInterpolate_ExpRB;
+  ts->ops->evaluatestep   = TSEvaluateStep_ExpRB;
+  ts->ops->rollback       = TSRollBack_ExpRB;
+  ts->ops->setfromoptions = TSSetFromOptions_ExpRB;
+  ts->usessnes            = PETSC_FALSE;
+
+  exprb->maxdim = 30;
+  exprb->rtol   = 1e-8;
+  PetscCall(PetscObjectComposeFunction((PetscObject)ts, "TSExpRBSetType_C", TSExpRBSetType_ExpRB));
+  PetscCall(PetscObjectComposeFunction((PetscObject)ts, "TSExpRBGetType_C", TSExpRBGetType_ExpRB));
+  PetscCall(TSExpRBSetType(ts, TSEXPRB32));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
@@ -13,6 +13,7 @@ PETSC_EXTERN PetscErrorCode TSCreate_SSP(TS);
 PETSC_EXTERN PetscErrorCode TSCreate_RK(TS);
 PETSC_EXTERN PetscErrorCode TSCreate_ARKIMEX(TS);
 PETSC_EXTERN PetscErrorCode TSCreate_DIRK(TS);
+PETSC_EXTERN PetscErrorCode TSCreate_ExpRB(TS);
 PETSC_EXTERN PetscErrorCode TSCreate_RosW(TS);
 PETSC_EXTERN PetscErrorCode TSCreate_EIMEX(TS);
 PETSC_EXTERN PetscErrorCode TSCreate_Mimex(TS);
@@ -57,6 +58,7 @@ PetscErrorCode TSRegisterAll(void)
   PetscCall(TSRegister(TSGLEE, TSCreate_GLEE));
   PetscCall(TSRegister(TSARKIMEX, TSCreate_ARKIMEX));
   PetscCall(TSRegister(TSDIRK, TSCreate_DIRK));
+  PetscCall(TSRegister(TSEXPRB, TSCreate_ExpRB));
   PetscCall(TSRegister(TSROSW, TSCreate_RosW));
   PetscCall(TSRegister(TSEIMEX, TSCreate_EIMEX));
   PetscCall(TSRegister(TSMIMEX, TSCreate_Mimex));
@@ -0,0 +1,196 @@
+static char help[] = "Tests local time-stepping with TSRK on the advection equation on a nonuniform grid.\n\n";
+
+/*
+  Solves u_t + u_x = 0 with periodic boundary conditions and first order upwind finite volumes. The cells in the
+  middle of the domain are refined by factors of 2 up to 8, so that the stable time step of the finest cells is
+  8 times smaller than the one of the coarse cells. The solution with local time-stepping is compared with the
+  solution of the same TSRK method with the time step of the finest cells everywhere.
+*/
+
+#include <petscts.h>
+#include <petscdmda.h>
+
+typedef struct {
+  DM       da;
+  PetscInt rows; /* local number of right-hand side rows computed */
+} AppCtx;
+
+/* Width of cell i, relative to the coarse cells */
+static PetscReal CellWidth(PetscInt i, PetscInt M)
+{
+  const PetscInt d = PetscAbsInt(2 * i + 1 - M) / 2; /* distance to the center of the domain */
+
+  if (d < 4) return 1.0 / 8;
+  if (d < 6) return 1.0 / 4;
+  if (d < 8) return 1.0 / 2;
+  return 1.0;
+}
+
+static PetscErrorCode ComputeRows(TS ts, PetscReal t, Vec U, PetscInt n, const PetscInt rows[], Vec F, AppCtx *user)
+{
+  Vec          Ul;
+  PetscScalar *u, *f;
+  PetscInt     M;
+
+  PetscFunctionBeginUser;
+  PetscCall(DMDAGetInfo(user->da, NULL, &M, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL));
+  PetscCall(DMGetLocalVector(user->da, &Ul));
+  PetscCall(DMGlobalToLocal(user->da, U, INSERT_VALUES, Ul));
+  PetscCall(DMDAVecGetArrayRead(user->da, Ul, &u));
+  PetscCall(DMDAVecGetArray(user->da, F, &f));
+  for (PetscInt k = 0; k < n; k++) {
+    const PetscInt i = rows[k];
+
+    f[i] = -(u[i] - u[i - 1]) / (CellWidth(i, M) / 52);
+  }
+  PetscCall(DMDAVecRestoreArray(user->da, F, &f));
+  PetscCall(DMDAVecRestoreArrayRead(user->da, Ul, &u));
+  PetscCall(DMRestoreLocalVector(user->da, &Ul));
+  user->rows += n;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode RHSFunction(TS ts, PetscReal t, Vec U, Vec F, void *ctx)
+{
+  AppCtx   *user = (AppCtx *)ctx;
+  PetscInt *rows, xs, xm;
+
+  PetscFunctionBeginUser;
+  PetscCall(DMDAGetCorners(user->da, &xs, NULL, NULL, &xm, NULL, NULL));
+  PetscCall(PetscMalloc1(xm, &rows));
+  for (PetscInt k = 0; k < xm; k++) rows[k] = xs + k;
+  PetscCall(ComputeRows(ts, t, U, xm, rows, F, user));
+  PetscCall(PetscFree(rows));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode RHSFunctionLocal(TS ts, PetscReal t, Vec U, IS is, Vec F, void *ctx)
+{
+  const PetscInt *rows;
+  PetscInt        n;
+
+  PetscFunctionBeginUser;
+  PetscCall(ISGetLocalSize(is, &n));
+  PetscCall(ISGetIndices(is, &rows));
+  PetscCall(ComputeRows(ts, t, U, n, rows, F, (AppCtx *)ctx));
+  PetscCall(ISRestoreIndices(is, &rows));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/* CFL condition of the upwind scheme for unit velocity */
+static PetscErrorCode LocalTimeStep(TS ts, PetscReal t, Vec U, Vec dt, void *ctx)
+{
+  AppCtx      *user = (AppCtx *)ctx;
+  PetscScalar *d;
+  PetscInt     xs, xm, M;
+
+  PetscFunctionBeginUser;
+  PetscCall(DMDAGetInfo(user->da, NULL, &M, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL));
+  PetscCall(DMDAGetCorners(user->da, &xs, NULL, NULL, &xm, NULL, NULL));
+  PetscCall(DMDAVecGetArray(user->da, dt, &d));
+  for (PetscInt i = xs; i < xs + xm; i++) d[i] = CellWidth(i, M) / 52;
+  PetscCall(DMDAVecRestoreArray(user->da, dt, &d));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode Solve(AppCtx *user, PetscBool lts, PetscBool restricted, Vec U)
+{
+  TS           ts;
+  PetscReal    h = 0.8 / 52, x = 0;
+  PetscInt     xs, xm, M, rows;
+  PetscScalar *u;
+
+  PetscFunctionBeginUser;
+  PetscCall(DMDAGetInfo(user->da, NULL, &M, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL));
+  PetscCall(DMDAGetCorners(user->da, &xs, NULL, NULL, &xm, NULL, NULL));
+  for (PetscInt i = 0; i < xs; i++) x += CellWidth(i, M) / 52;
+  PetscCall(DMDAVecGetArray(user->da, U, &u));
+  for (PetscInt i = xs; i < xs + xm; i++) {
+    const PetscReal dx = CellWidth(i, M) / 52;
+
+    u[i] = PetscSinReal(2 * PETSC_PI * (x + dx / 2));
+    x += dx;
+  }
+  PetscCall(DMDAVecRestoreArray(user->da, U, &u));
+
+  PetscCall(TSCreate(PETSC_COMM_WORLD, &ts));
+  PetscCall(TSSetDM(ts, user->da));
+  PetscCall(TSSetType(ts, TSRK));
+  PetscCall(TSRKSetType(ts, TSRK3BS));
+  PetscCall(TSSetRHSFunction(ts, NULL, RHSFunction, user));
+  if (lts) PetscCall(TSRKSetLocalTimeStepping(ts, LocalTimeStep, restricted ? RHSFunctionLocal : NULL, user));
+  else h /= 8;
+  PetscCall(TSSetTimeStep(ts, h));
+  PetscCall(TSSetMaxTime(ts, 10 * 0.8 / 52));
+  PetscCall(TSSetExactFinalTime(ts, TS_EXACTFINALTIME_MATCHSTEP));
+  {
+    TSAdapt adapt;
+
+    PetscCall(TSGetAdapt(ts, &adapt));
+    PetscCall(TSAdaptSetType(adapt, TSADAPTNONE));
+  }
+  if (lts) PetscCall(TSSetOptionsPrefix(ts, "lts_"));
+  PetscCall(TSSetFromOptions(ts));
+  user->rows = 0;
+  PetscCall(TSSolve(ts, U));
+  PetscCallMPI(MPIU_Allreduce(&user->rows, &rows, 1, MPIU_INT, MPI_SUM, PETSC_COMM_WORLD));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD, "%s: right-hand side rows computed %" PetscInt_FMT "\n", lts ? "Local time-stepping" : "Global time step", rows));
+  if (lts) {
+    PetscInt        nlevels;
+    const PetscInt *count;
+
+    PetscCall(TSRKGetLocalTimeSteppingLevels(ts, &nlevels, &count));
+    for (PetscInt l = 0; l < nlevels; l++) PetscCall(PetscPrintf(PETSC_COMM_WORLD, "  Level %" PetscInt_FMT ": %" PetscInt_FMT " cells\n", l, count[l]));
+  }
+  PetscCall(TSDestroy(&ts));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+int main(int argc, char **argv)
+{
+  AppCtx    user;
+  Vec       U, V;
+  PetscBool restricted = PETSC_TRUE;
+  PetscReal err;
+
+  PetscFunctionBeginUser;
+  PetscCall(PetscInitialize(&argc, &argv, NULL, help));
+  PetscCall(PetscOptionsGetBool(NULL, NULL, "-restricted", &restricted, NULL));
+  PetscCall(DMDACreate1d(PETSC_COMM_WORLD, DM_BOUNDARY_PERIODIC, 64, 1, 1, NULL, &user.da));
+  PetscCall(DMSetFromOptions(user.da));
+  PetscCall(DMSetUp(user.da));
+  PetscCall(DMCreateGlobalVector(user.da, &U));
+  PetscCall(VecDuplicate(U, &V));
+
+  PetscCall(Solve(&user, PETSC_FALSE, restricted, U));
+  PetscCall(Solve(&user, PETSC_TRUE, restricted, V));
+  PetscCall(VecAXPY(V, -1.0, U));
+  PetscCall(VecNorm(V, NORM_INFINITY, &err));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD, "Difference from the global time step: %s\n", err < 1.e-2 ? "< 1e-2" : "large"));
+
+  PetscCall(VecDestroy(&U));
+  PetscCall(VecDestroy(&V));
+  PetscCall(DMDestroy(&user.da));
+  PetscCall(PetscFinalize());
+  return 0;
+}
+
+/*TEST
+
+  test:
+    suffix: 0
+    nsize: {{1 2}}
+    output_file: output/ex36_0.out
+
+  test:
+    suffix: unrestricted
+    args: -restricted 0
+    output_file: output/ex36_unrestricted.out
+
+  test:
+    suffix: rebin
+    nsize: 2
+    args: -lts_ts_rk_lts_rebin 4 -lts_ts_rk_lts_max_levels 4
+    output_file: output/ex36_0.out
+
+TEST*/
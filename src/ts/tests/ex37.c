@@ -0,0 +1,105 @@
+static char help[] = "Tests the convergence of the TSRK methods, with and without their low-storage formula.\n\n";
+
+/*
+  The ODE of src/ts/tutorials/ex51.c
+                  u1_t = cos(t),
+                  u2_t = sin(u2)
+  with analytical solution
+                  u1(t) = sin(t),
+                  u2(t) = 2 * atan(exp(t) * tan(0.5))
+  is solved with two time steps to estimate the order of convergence, which is checked against the expected order -order.
+*/
+
+#include <petscts.h>
+
+static PetscErrorCode RHSFunction(TS ts, PetscReal t, Vec U, Vec F, void *ctx)
+{
+  PetscScalar       *f;
+  const PetscScalar *u;
+
+  PetscFunctionBeginUser;
+  PetscCall(VecGetArrayRead(U, &u));
+  PetscCall(VecGetArray(F, &f));
+  f[0] = PetscCosReal(t);
+  f[1] = PetscSinScalar(u[1]);
+  PetscCall(VecRestoreArrayRead(U, &u));
+  PetscCall(VecRestoreArray(F, &f));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode Solve(PetscReal dt, PetscReal *error)
+{
+  TS           ts;
+  Vec          U, Uex;
+  PetscScalar *u;
+  PetscReal    t;
+
+  PetscFunctionBeginUser;
+  PetscCall(VecCreateSeq(PETSC_COMM_SELF, 2, &U));
+  PetscCall(VecGetArray(U, &u));
+  u[0] = 0.0;
+  u[1] = 1.0;
+  PetscCall(VecRestoreArray(U, &u));
+
+  PetscCall(TSCreate(PETSC_COMM_SELF, &ts));
+  PetscCall(TSSetType(ts, TSRK));
+  PetscCall(TSRKSetType(ts, TSRK4LS));
+  PetscCall(TSSetRHSFunction(ts, NULL, RHSFunction, NULL));
+  PetscCall(TSSetMaxTime(ts, 1.0));
+  PetscCall(TSSetExactFinalTime(ts, TS_EXACTFINALTIME_MATCHSTEP));
+  PetscCall(TSSetTimeStep(ts, dt));
+  PetscCall(TSSetFromOptions(ts));
+  PetscCall(TSSolve(ts, U));
+  PetscCall(TSGetSolveTime(ts, &t));
+
+  PetscCall(VecDuplicate(U, &Uex));
+  PetscCall(VecGetArray(Uex, &u));
+  u[0] = PetscSinReal(t);
+  u[1] = 2 * PetscAtanReal(PetscExpReal(t) * PetscTanReal(0.5));
+  PetscCall(VecRestoreArray(Uex, &u));
+  PetscCall(VecAXPY(Uex, -1.0, U));
+  PetscCall(VecNorm(Uex, NORM_2, error));
+
+  PetscCall(VecDestroy(&Uex));
+  PetscCall(VecDestroy(&U));
+  PetscCall(TSDestroy(&ts));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+int main(int argc, char **argv)
+{
+  PetscReal dt = 0.1, order = 4, error[2], minorder;
+
+  PetscFunctionBeginUser;
+  PetscCall(PetscInitialize(&argc, &argv, NULL, help));
+  PetscCall(PetscOptionsGetReal(NULL, NULL, "-dt", &dt, NULL));
+  PetscCall(PetscOptionsGetReal(NULL, NULL, "-order", &order, NULL));
+  PetscCall(Solve(dt, &error[0]));
+  PetscCall(Solve(dt / 2, &error[1]));
+  minorder = order - 0.1;
+  PetscCall(PetscPrintf(PETSC_COMM_SELF, "Observed order %s %.1f\n", PetscLog2Real(error[0] / error[1]) >= minorder ? ">=" : "<", (double)minorder));
+  PetscCall(PetscFinalize());
+  return 0;
+}
+
+/*TEST
+
+  testset:
+    requires: !single
+    args: -ts_rk_low_storage {{0 1}}
+
+    test:
+      suffix: 3ls
+      args: -ts_rk_type 3ls -order 3
+      output_file: output/ex37_3ls.out
+
+    test:
+      suffix: 4ls
+      output_file: output/ex37_4ls.out
+
+    test:
+      suffix: 4ls_interpolate
+      args: -dt 0.3 -ts_exact_final_time interpolate -order 2
+      output_file: output/ex37_4ls_interpolate.out
+
+TEST*/
@@ -0,0 +1,158 @@
+static char help[] = "Tests the convergence of the TSEXPRB methods on a stiff reaction-diffusion equation.\n\n";
+
+/*
+  Solves u_t = u_xx + u (1 - u) on (0, 1) with u = 0 on the boundary and u(0, x) = sin(pi x), discretized with
+  centered finite differences. The time steps are far above the stability limit dx^2 / 2 of explicit methods.
+  The order of convergence is estimated from the solutions with three time steps. With -check_steps, the number of
+  steps taken is checked against the one of the fixed time step, which the method keeps when the phi-functions of the
+  stiffer problems with large -n are not approximated within the maximal dimension of the Krylov subspaces.
+*/
+
+#include <petscts.h>
+
+typedef struct {
+  PetscInt  n; /* number of interior grid points */
+  PetscReal dx;
+} AppCtx;
+
+static PetscErrorCode RHSFunction(TS ts, PetscReal t, Vec U, Vec F, void *ctx)
+{
+  AppCtx            *user = (AppCtx *)ctx;
+  PetscScalar       *f;
+  const PetscScalar *u;
+
+  PetscFunctionBeginUser;
+  PetscCall(VecGetArrayRead(U, &u));
+  PetscCall(VecGetArray(F, &f));
+  for (PetscInt i = 0; i < user->n; i++) {
+    const PetscScalar ul = i > 0 ? u[i - 1] : 0, ur = i < user->n - 1 ? u[i + 1] : 0;
+
+    f[i] = (ul - 2 * u[i] + ur) / (user->dx * user->dx) + u[i] * (1 - u[i]);
+  }
+  PetscCall(VecRestoreArrayRead(U, &u));
+  PetscCall(VecRestoreArray(F, &f));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode RHSJacobian(TS ts, PetscReal t, Vec U, Mat A, Mat B, void *ctx)
+{
+  AppCtx            *user = (AppCtx *)ctx;
+  const PetscScalar *u;
+
+  PetscFunctionBeginUser;
+  PetscCall(VecGetArrayRead(U, &u));
+  for (PetscInt i = 0; i < user->n; i++) {
+    const PetscReal   idx2 = 1 / (user->dx * user->dx);
+    const PetscScalar v[3] = {idx2, -2 * idx2 + 1 - 2 * u[i], idx2};
+    const PetscInt    j[3] = {i - 1, i, i < user->n - 1 ? i + 1 : -1}; /* negative columns are ignored */
+
+    PetscCall(MatSetValues(B, 1, &i, 3, j, v, INSERT_VALUES));
+  }
+  PetscCall(VecRestoreArrayRead(U, &u));
+  PetscCall(MatAssemblyBegin(B, MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(B, MAT_FINAL_ASSEMBLY));
+  if (A != B) {
+    PetscCall(MatAssemblyBegin(A, MAT_FINAL_ASSEMBLY));
+    PetscCall(MatAssemblyEnd(A, MAT_FINAL_ASSEMBLY));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode Solve(AppCtx *user, PetscBool jacobian, PetscReal dt, Vec U, PetscBool *kept)
+{
+  TS           ts;
+  Mat          J;
+  PetscScalar *u;
+  PetscReal    tmax;
+  PetscInt     steps;
+
+  PetscFunctionBeginUser;
+  PetscCall(VecGetArray(U, &u));
+  for (PetscInt i = 0; i < user->n; i++) u[i] = PetscSinReal(PETSC_PI * (i + 1) * user->dx);
+  PetscCall(VecRestoreArray(U, &u));
+
+  PetscCall(TSCreate(PETSC_COMM_SELF, &ts));
+  PetscCall(TSSetType(ts, TSEXPRB));
+  PetscCall(TSSetRHSFunction(ts, NULL, RHSFunction, user));
+  if (jacobian) {
+    PetscCall(MatCreateSeqAIJ(PETSC_COMM_SELF, user->n, user->n, 3, NULL, &J));
+    PetscCall(TSSetRHSJacobian(ts, J, J, RHSJacobian, user));
+    PetscCall(MatDestroy(&J));
+  }
+  PetscCall(TSSetMaxTime(ts, 0.5));
+  PetscCall(TSSetExactFinalTime(ts, TS_EXACTFINALTIME_MATCHSTEP));
+  PetscCall(TSSetTimeStep(ts, dt));
+  PetscCall(TSSetFromOptions(ts));
+  PetscCall(TSSolve(ts, U));
+  PetscCall(TSGetMaxTime(ts, &tmax));
+  PetscCall(TSGetStepNumber(ts, &steps));
+  /* the number of steps of the fixed time step dt */
+  *kept = steps == (PetscInt)PetscCeilReal(tmax / dt - PETSC_SMALL) ? PETSC_TRUE : PETSC_FALSE;
+  PetscCall(TSDestroy(&ts));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+int main(int argc, char **argv)
+{
+  AppCtx    user;
+  Vec       U[3];
+  PetscReal dt = 0.05, e[2];
+  PetscBool jacobian = PETSC_TRUE, check_steps = PETSC_FALSE, kept[3];
+
+  PetscFunctionBeginUser;
+  PetscCall(PetscInitialize(&argc, &argv, NULL, help));
+  user.n = 31;
+  PetscCall(PetscOptionsGetInt(NULL, NULL, "-n", &user.n, NULL));
+  PetscCall(PetscOptionsGetReal(NULL, NULL, "-dt", &dt, NULL));
+  PetscCall(PetscOptionsGetBool(NULL, NULL, "-jacobian", &jacobian, NULL));
+  PetscCall(PetscOptionsGetBool(NULL, NULL, "-check_steps", &check_steps, NULL));
+  user.dx = 1.0 / (user.n + 1);
+  PetscCall(PetscPrintf(PETSC_COMM_SELF, "Time step %g, %g times the explicit stability limit\n", (double)dt, (double)(2 * dt / (user.dx * user.dx))));
+
+  for (PetscInt k = 0; k < 3; k++) {
+    PetscCall(VecCreateSeq(PETSC_COMM_SELF, user.n, &U[k]));
+    PetscCall(Solve(&user, jacobian, dt / (1 << k), U[k], &kept[k]));
+  }
+  if (check_steps) PetscCall(PetscPrintf(PETSC_COMM_SELF, "Time steps %s\n", kept[0] && kept[1] && kept[2] ? "kept" : "changed"));
+  PetscCall(VecAXPY(U[0], -1.0, U[1]));
+  PetscCall(VecAXPY(U[1], -1.0, U[2]));
+  PetscCall(VecNorm(U[0], NORM_INFINITY, &e[0]));
+  PetscCall(VecNorm(U[1], NORM_INFINITY, &e[1]));
+  PetscCall(PetscPrintf(PETSC_COMM_SELF, "Observed order %.1f\n", (double)PetscLog2Real(e[0] / e[1])));
+  for (PetscInt k = 0; k < 3; k++) PetscCall(VecDestroy(&U[k]));
+  PetscCall(PetscFinalize());
+  return 0;
+}
+
+/*TEST
+
+  testset:
+    requires: !single
+    args: -ts_adapt_type none
+
+    test:
+      suffix: 32
+      args: -jacobian {{0 1}}
+      output_file: output/ex38_32.out
+
+    test:
+      suffix: euler
+      args: -ts_exprb_type euler -jacobian {{0 1}}
+      output_file: output/ex38_euler.out
+
+  # the phi-functions are not approximated within the default dimension of the Krylov subspaces and are computed in substeps
+  test:
+    suffix: substeps
+    requires: !single
+    args: -n 127 -ts_max_time 0.1 -ts_adapt_type none -ts_exprb_type {{euler 32}} -check_steps
+    filter: grep -v "Observed order"
+    output_file: output/ex38_substeps.out
+
+  test:
+    suffix: adapt
+    requires: !single
+    args: -dt 0.1 -ts_adapt_monitor
+    filter: grep -v "Observed order"
+    output_file: output/ex38_adapt.out
+
+TEST*/
@@ -450,4 +450,20 @@ int main(int argc, char **argv)
       suffix: 5
       args: -snes_lag_jacobian 20 -snes_lag_jacobian_persists
 
+    test:
+      suffix: 6
+      args: -ts_type arkimex -ksp_type gmres -pc_type jacobi -snes_lag_jacobian_adaptive -ts_view
+      filter: grep "rebuilt"
+
+    test:
+      suffix: 7
+      args: -ts_type arkimex -ksp_type gmres -pc_type jacobi -snes_lag_preconditioner_adaptive -ts_view
+      filter: grep "rebuilt"
+
+    test:
+      # the Jacobian of the last nonlinear solve of a step is reused by the first one of the next step
+      suffix: 8
+      args: -ts_type arkimex -ksp_type gmres -pc_type jacobi -snes_lag_jacobian_adaptive -ts_max_steps 3 -info :snes
+      filter: grep -E "Rebuilding|Reusing" | cut -d, -f1
+
 TEST*/
@@ -1956,6 +1956,164 @@ PetscErrorCode PetscSectionGetFieldPointOffset(PetscSection s, PetscInt point, P
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+  PetscSectionGetDofs - Return the number of degrees of freedom associated with each of a set of points.
+
+  Not Collective
+
+  Input Parameters:
++ s      - the `PetscSection`
+. n      - the number of points
+- points - the points
+
+  Output Parameter:
+. dofs - the number of dof at each point
+
+  Level: intermediate
+
+  Note:
+  This is equivalent to calling `PetscSectionGetDof()` for each point, but validates the arguments only once, which matters in assembly loops over many points
+
+.seealso: [PetscSection](ch_petscsection), `PetscSection`, `PetscSectionGetDof()`, `PetscSectionGetOffsets()`, `PetscSectionGetFieldDofs()`
+@*/
+PetscErrorCode PetscSectionGetDofs(PetscSection s, PetscInt n, const PetscInt points[], PetscInt dofs[])
+{
+  PetscInt pStart, pEnd;
+
+  PetscFunctionBeginHot;
+  PetscValidHeaderSpecific(s, PETSC_SECTION_CLASSID, 1);
+  if (n) {
+    PetscAssertPointer(points, 3);
+    PetscAssertPointer(dofs, 4);
+  }
+  pStart = s->pStart;
+  pEnd   = s->pEnd;
+  for (PetscInt i = 0; i < n; ++i) {
+    PetscAssert(points[i] >= pStart && points[i] < pEnd, PETSC_COMM_SELF, PETSC_ERR_ARG_OUTOFRANGE, "Section point %" PetscInt_FMT " should be in [%" PetscInt_FMT ", %" PetscInt_FMT ")", points[i], pStart, pEnd);
+    dofs[i] = s->atlasDof[points[i] - pStart];
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+  PetscSectionGetOffsets - Return the offset into an array or `Vec` for the dof associated with each of a set of points.
+
+  Not Collective
+
+  Input Parameters:
++ s      - the `PetscSection`
+. n      - the number of points
+- points - the points
+
+  Output Parameter:
+. offsets - the offset of each point
+
+  Level: intermediate
+
+  Note:
+  This is equivalent to calling `PetscSectionGetOffset()` for each point, but validates the arguments only once
+
+.seealso: [PetscSection](ch_petscsection), `PetscSection`, `PetscSectionGetOffset()`, `PetscSectionGetDofs()`, `PetscSectionGetFieldOffsets()`
+@*/
+PetscErrorCode PetscSectionGetOffsets(PetscSection s, PetscInt n, const PetscInt points[], PetscInt offsets[])
+{
+  PetscInt pStart, pEnd;
+
+  PetscFunctionBeginHot;
+  PetscValidHeaderSpecific(s, PETSC_SECTION_CLASSID, 1);
+  if (n) {
+    PetscAssertPointer(points, 3);
+    PetscAssertPointer(offsets, 4);
+  }
+  pStart = s->pStart;
+  pEnd   = s->pEnd;
+  for (PetscInt i = 0; i < n; ++i) {
+    PetscAssert(points[i] >= pStart && points[i] < pEnd, PETSC_COMM_SELF, PETSC_ERR_ARG_OUTOFRANGE, "Section point %" PetscInt_FMT " should be in [%" PetscInt_FMT ", %" PetscInt_FMT ")", points[i], pStart, pEnd);
+    offsets[i] = s->atlasOff[points[i] - pStart];
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+  PetscSectionGetFieldDofs - Return the number of degrees of freedom associated with every field at each of a set of points.
+
+  Not Collective
+
+  Input Parameters:
++ s      - the `PetscSection`
+. n      - the number of points
+- points - the points
+
+  Output Parameter:
+. dofs - the number of dof of each field at each point, so that `dofs[i * Nf + f]` is the count for field `f` at `points[i]`, where `Nf` is given by `PetscSectionGetNumFields()`
+
+  Level: intermediate
+
+.seealso: [PetscSection](ch_petscsection), `PetscSection`, `PetscSectionGetFieldDof()`, `PetscSectionGetDofs()`, `PetscSectionGetFieldOffsets()`
+@*/
+PetscErrorCode PetscSectionGetFieldDofs(PetscSection s, PetscInt n, const PetscInt points[], PetscInt dofs[])
+{
+  PetscInt Nf;
+
+  PetscFunctionBeginHot;
+  PetscValidHeaderSpecific(s, PETSC_SECTION_CLASSID, 1);
+  Nf = s->numFields;
+  if (n && Nf) {
+    PetscAssertPointer(points, 3);
+    PetscAssertPointer(dofs, 4);
+  }
+  for (PetscInt f = 0; f < Nf; ++f) {
+    const PetscSection fs     = s->field[f];
+    const PetscInt     pStart = fs->pStart, pEnd = fs->pEnd;
+
+    for (PetscInt i = 0; i < n; ++i) {
+      PetscAssert(points[i] >= pStart && points[i] < pEnd, PETSC_COMM_SELF, PETSC_ERR_ARG_OUTOFRANGE, "Section point %" PetscInt_FMT " should be in [%" PetscInt_FMT ", %" PetscInt_FMT ")", points[i], pStart, pEnd);
+      dofs[i * Nf + f] = fs->atlasDof[points[i] - pStart];
+    }
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+  PetscSectionGetFieldOffsets - Return the offset into an array or `Vec` for the dof of every field at each of a set of points.
+
+  Not Collective
+
+  Input Parameters:
++ s      - the `PetscSection`
+. n      - the number of points
+- points - the points
+
+  Output Parameter:
+. offsets - the offset of each field at each point, so that `offsets[i * Nf + f]` is the offset for field `f` at `points[i]`, where `Nf` is given by `PetscSectionGetNumFields()`
+
+  Level: intermediate
+
+.seealso: [PetscSection](ch_petscsection), `PetscSection`, `PetscSectionGetFieldOffset()`, `PetscSectionGetOffsets()`, `PetscSectionGetFieldDofs()`
+@*/
+PetscErrorCode PetscSectionGetFieldOffsets(PetscSection s, PetscInt n, const PetscInt points[], PetscInt offsets[])
+{
+  PetscInt Nf;
+
+  PetscFunctionBeginHot;
+  PetscValidHeaderSpecific(s, PETSC_SECTION_CLASSID, 1);
+  Nf = s->numFields;
+  if (n && Nf) {
+    PetscAssertPointer(points, 3);
+    PetscAssertPointer(offsets, 4);
+  }
+  for (PetscInt f = 0; f < Nf; ++f) {
+    const PetscSection fs     = s->field[f];
+    const PetscInt     pStart = fs->pStart, pEnd = fs->pEnd;
+
+    for (PetscInt i = 0; i < n; ++i) {
+      PetscAssert(points[i] >= pStart && points[i] < pEnd, PETSC_COMM_SELF, PETSC_ERR_ARG_OUTOFRANGE, "Section point %" PetscInt_FMT " should be in [%" PetscInt_FMT ", %" PetscInt_FMT ")", points[i], pStart, pEnd);
+      offsets[i * Nf + f] = fs->atlasOff[points[i] - pStart];
+    }
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
   PetscSectionGetOffsetRange - Return the full range of offsets [`start`, `end`) for a `PetscSection`
 
@@ -0,0 +1,388 @@
+#include <../src/vec/is/sf/impls/basic/sfpack.h>
+#include <../src/vec/is/sf/impls/basic/sfbasic.h>
+
+/*
+   Edges of the graph are split by whether the root and the leaf live on the same node. Intra-node edges are served
+   directly by the intra SF. Inter-node edges go through three stages:
+
+     gather:  roots                                      -> outbuf[] on the leader (first rank) of the root's node
+     inter:   outbuf[] on the leader of the root's node  -> inbuf[] on the leader of the leaf's node
+     scatter: inbuf[] on the leader of the leaf's node   -> leaves
+
+   so that only the leaders exchange messages between nodes, one per pair of nodes. Every outbuf[] and inbuf[] slot
+   holds one edge, so the inter and scatter stages are one-to-one and any MPI_Op is only applied at the final stage.
+*/
+
+typedef struct _n_PetscSFNodeLink *PetscSFNodeLink;
+struct _n_PetscSFNodeLink {
+  MPI_Aint        unitbytes;          /* Size of the unit the buffers were allocated for */
+  MPI_Datatype    unit;               /* Unit, root and leaf data of the pending operation */
+  const void     *rootdata, *leafdata;
+  PetscMemType    rootmtype, leafmtype;
+  char           *outbuf, *inbuf;     /* Edges leaving and entering this node, only nonempty on the leaders */
+  PetscBool       inuse;
+  PetscSFNodeLink next;
+};
+
+typedef struct {
+  SFBASICHEADER;
+  PetscInt        nodesize;                      /* Number of consecutive ranks grouped as a node, or 0 to use shared memory nodes */
+  PetscBool       window;                        /* Use shared memory windows for the stages within a node */
+  MPI_Comm        nodecomm;                      /* Ranks on the same node as this rank */
+  PetscMPIInt     nnodes;                        /* Number of nodes */
+  PetscSF         intra, gather, inter, scatter; /* The stages described above */
+  PetscInt        nout, nin;                     /* Number of edges leaving and entering this node, only nonzero on the leaders */
+  PetscSFNodeLink links;
+} PetscSF_Node;
+
+/*===================================================================================*/
+/*              Internal utility routines                                            */
+/*===================================================================================*/
+static PetscErrorCode PetscSFNodeCreateStage(PetscSF sf, MPI_Comm comm, PetscBool window, PetscInt nroots, PetscInt nleaves, PetscInt *ilocal, PetscSFNode *iremote, PetscSF *stage)
+{
+  PetscFunctionBegin;
+  PetscCall(PetscSFCreate(comm, stage));
+#if defined(PETSC_HAVE_MPI_WIN_CREATE)
+  if (window) {
+    PetscCall(PetscSFSetType(*stage, PETSCSFWINDOW));
+    PetscCall(PetscSFWindowSetFlavorType(*stage, PETSCSF_WINDOW_FLAVOR_SHARED));
+  } else
+#endif
+    PetscCall(PetscSFSetType(*stage, PETSCSFBASIC));
+  PetscCall(PetscSFSetReducedPrecision(*stage, sf->reduced_precision));
+  PetscCall(PetscSFSetGraph(*stage, nroots, nleaves, ilocal, PETSC_OWN_POINTER, iremote, PETSC_OWN_POINTER));
+  PetscCall(PetscSFSetUp(*stage));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PetscSFNodeGetLink(PetscSF sf, MPI_Datatype unit, PetscMemType rootmtype, const void *rootdata, PetscMemType leafmtype, const void *leafdata, PetscSFNodeLink *mylink)
+{
+  PetscSF_Node   *dat = (PetscSF_Node *)sf->data;
+  PetscSFNodeLink link;
+  MPI_Aint        bytes;
+
+  PetscFunctionBegin;
+  PetscCall(PetscSFGetDatatypeSize_Internal(PetscObjectComm((PetscObject)sf), unit, &bytes));
+  for (link = dat->links; link; link = link->next) {
+    if (!link->inuse && link->unitbytes == bytes) break;
+  }
+  if (!link) {
+    PetscCall(PetscNew(&link));
+    PetscCall(PetscMalloc2(dat->nout * bytes, &link->outbuf, dat->nin * bytes, &link->inbuf));
+    link->unitbytes = bytes;
+    link->next      = dat->links;
+    dat->links      = link;
+  }
+  link->unit      = unit;
+  link->rootmtype = rootmtype;
+  link->rootdata  = rootdata;
+  link->leafmtype = leafmtype;
+  link->leafdata  = leafdata;
+  link->inuse     = PETSC_TRUE;
+  *mylink         = link;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PetscSFNodeFindLink(PetscSF sf, MPI_Datatype unit, const void *rootdata, const void *leafdata, PetscSFNodeLink *mylink)
+{
+  PetscSF_Node   *dat = (PetscSF_Node *)sf->data;
+  PetscSFNodeLink link;
+
+  PetscFunctionBegin;
+  for (link = dat->links; link; link = link->next) {
+    if (link->inuse && link->unit == unit && link->rootdata == rootdata && link->leafdata == leafdata) break;
+  }
+  PetscCheck(link, PETSC_COMM_SELF, PETSC_ERR_ARG_WRONGSTATE, "Could not find pending operation on rootdata %p and leafdata %p; must match Begin() and End() calls", rootdata, leafdata);
+  *mylink = link;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*===================================================================================*/
+/*              Implementations of SF public APIs                                    */
+/*===================================================================================*/
+static PetscErrorCode PetscSFSetUp_Node(PetscSF sf)
+{
+  PetscSF_Node      *dat = (PetscSF_Node *)sf->data;
+  MPI_Comm           comm;
+  PetscMPIInt        rank, size, noderank, leader, myinfo[2], *info, isleader;
+  PetscInt           nroots, nleaves, nintra = 0, ninter = 0, off = 0, nin = 0, nout, maxleaf, i, j, k;
+  const PetscInt    *ilocal;
+  const PetscSFNode *iremote, *rmulti;
+  PetscInt          *lintra, *linter;
+  PetscSFNode       *rintra, *rinter, *rleader, *rlink, *rgather, *pairs, *inpairs, *outpairs;
+  PetscSF            sfleader, multi;
+
+  PetscFunctionBegin;
+  /* SFNode inherits from Basic, which serves PetscSFFetchAndOp() and the queries of the graph */
+  PetscCall(PetscSFSetUp_Basic(sf));
+  PetscCall(PetscObjectGetComm((PetscObject)sf, &comm));
+  PetscCallMPI(MPI_Comm_rank(comm, &rank));
+  PetscCallMPI(MPI_Comm_size(comm, &size));
+  if (dat->nodesize > 0) {
+    MPI_Comm    raw_comm;
+    PetscMPIInt color;
+
+    PetscCall(PetscMPIIntCast(rank / dat->nodesize, &color));
+    PetscCallMPI(MPI_Comm_split(comm, color, rank, &raw_comm));
+    PetscCall(PetscCommDuplicate(raw_comm, &dat->nodecomm, NULL));
+    PetscCallMPI(MPI_Comm_free(&raw_comm));
+  } else {
+#if defined(PETSC_HAVE_MPI_PROCESS_SHARED_MEMORY)
+    PetscShmComm pshmcomm;
+    MPI_Comm     shmcomm;
+
+    PetscCall(PetscShmCommGet(comm, &pshmcomm));
+    PetscCall(PetscShmCommGetMpiShmComm(pshmcomm, &shmcomm));
+    PetscCall(PetscCommDuplicate(shmcomm, &dat->nodecomm, NULL));
+#else
+    PetscCall(PetscCommDuplicate(PETSC_COMM_SELF, &dat->nodecomm, NULL));
+#endif
+  }
+
+  /* The leader of a node is its first rank; everyone learns the leader and the node rank of every rank */
+  PetscCallMPI(MPI_Comm_rank(dat->nodecomm, &noderank));
+  leader = rank;
+  PetscCallMPI(MPI_Bcast(&leader, 1, MPI_INT, 0, dat->nodecomm));
+  isleader = noderank ? 0 : 1;
+  PetscCallMPI(MPIU_Allreduce(&isleader, &dat->nnodes, 1, MPI_INT, MPI_SUM, comm));
+  myinfo[0] = leader;
+  myinfo[1] = noderank;
+  PetscCall(PetscMalloc1(2 * size, &info));
+  PetscCallMPI(MPI_Allgather(myinfo, 2, MPI_INT, info, 2, MPI_INT, comm));
+
+  PetscCall(PetscSFGetGraph(sf, &nroots, &nleaves, &ilocal, &iremote));
+  for (i = 0; i < nleaves; i++) {
+    if (info[2 * iremote[i].rank] == leader) nintra++;
+    else ninter++;
+  }
+  PetscCallMPI(MPI_Exscan(&ninter, &off, 1, MPIU_INT, MPI_SUM, dat->nodecomm));
+  if (!noderank) off = 0;
+  PetscCallMPI(MPI_Reduce(&ninter, &nin, 1, MPIU_INT, MPI_SUM, 0, dat->nodecomm));
+  PetscCall(PetscMalloc1(nintra, &lintra));
+  PetscCall(PetscMalloc1(nintra, &rintra));
+  PetscCall(PetscMalloc1(ninter, &linter));
+  PetscCall(PetscMalloc1(ninter, &rinter));
+  for (i = 0, j = 0, k = 0; i < nleaves; i++) {
+    const PetscMPIInt q = (PetscMPIInt)iremote[i].rank;
+
+    if (info[2 * q] == leader) {
+      lintra[j]       = ilocal ? ilocal[i] : i;
+      rintra[j].rank  = info[2 * q + 1];
+      rintra[j].index = iremote[i].index;
+      j++;
+    } else {
+      linter[k]       = ilocal ? ilocal[i] : i;
+      rinter[k].rank  = 0;
+      rinter[k].index = off + k;
+      k++;
+    }
+  }
+  PetscCall(PetscSFNodeCreateStage(sf, dat->nodecomm, dat->window, nroots, nintra, lintra, rintra, &dat->intra));
+  PetscCall(PetscSFNodeCreateStage(sf, dat->nodecomm, dat->window, nin, ninter, linter, rinter, &dat->scatter));
+
+  /* The leader of the leaf's node collects the roots of its inter-node edges */
+  PetscCall(PetscSFGetLeafRange(sf, NULL, &maxleaf));
+  PetscCall(PetscMalloc2(maxleaf + 1, &pairs, nin, &inpairs));
+  for (i = 0; i < nleaves; i++) pairs[ilocal ? ilocal[i] : i] = iremote[i];
+  PetscCall(PetscSFReduceBegin(dat->scatter, MPIU_SF_NODE, pairs, inpairs, MPI_REPLACE));
+  PetscCall(PetscSFReduceEnd(dat->scatter, MPIU_SF_NODE, pairs, inpairs, MPI_REPLACE));
+
+  /* Slots on the leader of the root's node are the multi-roots of the graph connecting the leaders */
+  PetscCall(PetscMalloc1(nin, &rleader));
+  for (i = 0; i < nin; i++) {
+    rleader[i].rank  = info[2 * inpairs[i].rank];
+    rleader[i].index = 0;
+  }
+  PetscCall(PetscSFCreate(comm, &sfleader));
+  PetscCall(PetscSFSetType(sfleader, PETSCSFBASIC));
+  PetscCall(PetscSFSetGraph(sfleader, 1, nin, NULL, PETSC_OWN_POINTER, rleader, PETSC_OWN_POINTER));
+  PetscCall(PetscSFGetMultiSF(sfleader, &multi));
+  PetscCall(PetscSFGetGraph(multi, &nout, NULL, NULL, &rmulti));
+  PetscCall(PetscMalloc1(nout, &outpairs));
+  PetscCall(PetscSFGatherBegin(sfleader, MPIU_SF_NODE, inpairs, outpairs));
+  PetscCall(PetscSFGatherEnd(sfleader, MPIU_SF_NODE, inpairs, outpairs));
+  PetscCall(PetscMalloc1(nin, &rlink));
+  PetscCall(PetscArraycpy(rlink, rmulti, nin));
+  PetscCall(PetscSFDestroy(&sfleader));
+  PetscCall(PetscSFCreate(comm, &dat->inter));
+  PetscCall(PetscSFSetType(dat->inter, PETSCSFBASIC));
+  PetscCall(PetscSFSetReducedPrecision(dat->inter, sf->reduced_precision));
+  PetscCall(PetscSFSetGraph(dat->inter, nout, nin, NULL, PETSC_OWN_POINTER, rlink, PETSC_OWN_POINTER));
+  PetscCall(PetscSFSetUp(dat->inter));
+
+  PetscCall(PetscMalloc1(nout, &rgather));
+  for (i = 0; i < nout; i++) {
+    rgather[i].rank  = info[2 * outpairs[i].rank + 1];
+    rgather[i].index = outpairs[i].index;
+  }
+  PetscCall(PetscSFNodeCreateStage(sf, dat->nodecomm, dat->window, nroots, nout, NULL, rgather, &dat->gather));
+  dat->nout = nout;
+  dat->nin  = nin;
+  PetscCall(PetscFree2(pairs, inpairs));
+  PetscCall(PetscFree(outpairs));
+  PetscCall(PetscFree(info));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PetscSFSetFromOptions_Node(PetscSF sf, PetscOptionItems PetscOptionsObject)
+{
+  PetscSF_Node *dat = (PetscSF_Node *)sf->data;
+
+  PetscFunctionBegin;
+  PetscOptionsHeadBegin(PetscOptionsObject, "PetscSF Node options");
+  PetscCall(PetscOptionsInt("-sf_node_size", "Number of consecutive ranks treated as a node, 0 to use the ranks sharing memory", "PetscSFSetType", dat->nodesize, &dat->nodesize, NULL));
+#if defined(PETSC_HAVE_MPI_WIN_CREATE)
+  PetscCall(PetscOptionsBool("-sf_node_window", "Communicate within a node through MPI shared memory windows", "PetscSFSetType", dat->window, &dat->window, NULL));
+#endif
+  PetscOptionsHeadEnd();
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PetscSFReset_Node(PetscSF sf)
+{
+  PetscSF_Node   *dat = (PetscSF_Node *)sf->data;
+  PetscSFNodeLink link, next;
+
+  PetscFunctionBegin;
+  for (link = dat->links; link; link = next) {
+    next = link->next;
+    PetscCheck(!link->inuse, PetscObjectComm((PetscObject)sf), PETSC_ERR_ARG_WRONGSTATE, "Outstanding operation has not been completed");
+    PetscCall(PetscFree2(link->outbuf, link->inbuf));
+    PetscCall(PetscFree(link));
+  }
+  dat->links = NULL;
+  dat->nout  = 0;
+  dat->nin   = 0;
+  PetscCall(PetscSFDestroy(&dat->intra));
+  PetscCall(PetscSFDestroy(&dat->gather));
+  PetscCall(PetscSFDestroy(&dat->inter));
+  PetscCall(PetscSFDestroy(&dat->scatter));
+  PetscCall(PetscCommDestroy(&dat->nodecomm));
+  PetscCall(PetscSFReset_Basic(sf)); /* Common part */
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PetscSFDestroy_Node(PetscSF sf)
+{
+  PetscFunctionBegin;
+  PetscCall(PetscSFReset_Node(sf));
+  PetscCall(PetscFree(sf->data));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PetscSFView_Node(PetscSF sf, PetscViewer viewer)
+{
+  PetscSF_Node     *dat = (PetscSF_Node *)sf->data;
+  PetscBool         isascii;
+  PetscViewerFormat format;
+
+  PetscFunctionBegin;
+  PetscCall(PetscSFView_Basic(sf, viewer));
+  PetscCall(PetscObjectTypeCompare((PetscObject)viewer, PETSCVIEWERASCII, &isascii));
+  PetscCall(PetscViewerGetFormat(viewer, &format));
+  if (isascii && format != PETSC_VIEWER_ASCII_MATLAB) {
+    if (sf->setupcalled) PetscCall(PetscViewerASCIIPrintf(viewer, "  inter-node communication through the leaders of %d nodes, within nodes with %s\n", dat->nnodes, dat->window ? "shared memory windows" : "point-to-point messages"));
+    else PetscCall(PetscViewerASCIIPrintf(viewer, "  ranks per node %" PetscInt_FMT "\n", dat->nodesize));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PetscSFDuplicate_Node(PetscSF sf, PetscSFDuplicateOption opt, PetscSF newsf)
+{
+  PetscSF_Node *dat = (PetscSF_Node *)sf->data, *newdat = (PetscSF_Node *)newsf->data;
+
+  PetscFunctionBegin;
+  newdat->nodesize = dat->nodesize;
+  newdat->window   = dat->window;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PetscSFBcastBegin_Node(PetscSF sf, MPI_Datatype unit, PetscMemType rootmtype, const void *rootdata, PetscMemType leafmtype, void *leafdata, MPI_Op op)
+{
+  PetscSF_Node   *dat = (PetscSF_Node *)sf->data;
+  PetscSFNodeLink link;
+
+  PetscFunctionBegin;
+  PetscCall(PetscSFNodeGetLink(sf, unit, rootmtype, rootdata, leafmtype, leafdata, &link));
+  PetscCall(PetscSFBcastWithMemTypeBegin(dat->intra, unit, rootmtype, rootdata, leafmtype, leafdata, op));
+  PetscCall(PetscSFBcastWithMemTypeBegin(dat->gather, unit, rootmtype, rootdata, PETSC_MEMTYPE_HOST, link->outbuf, MPI_REPLACE));
+  PetscCall(PetscSFBcastEnd(dat->gather, unit, rootdata, link->outbuf, MPI_REPLACE));
+  PetscCall(PetscSFBcastWithMemTypeBegin(dat->inter, unit, PETSC_MEMTYPE_HOST, link->outbuf, PETSC_MEMTYPE_HOST, link->inbuf, MPI_REPLACE));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PetscSFBcastEnd_Node(PetscSF sf, MPI_Datatype unit, const void *rootdata, void *leafdata, MPI_Op op)
+{
+  PetscSF_Node   *dat = (PetscSF_Node *)sf->data;
+  PetscSFNodeLink link;
+
+  PetscFunctionBegin;
+  PetscCall(PetscSFNodeFindLink(sf, unit, rootdata, leafdata, &link));
+  PetscCall(PetscSFBcastEnd(dat->inter, unit, link->outbuf, link->inbuf, MPI_REPLACE));
+  PetscCall(PetscSFBcastWithMemTypeBegin(dat->scatter, unit, PETSC_MEMTYPE_HOST, link->inbuf, link->leafmtype, leafdata, op));
+  PetscCall(PetscSFBcastEnd(dat->scatter, unit, link->inbuf, leafdata, op));
+  PetscCall(PetscSFBcastEnd(dat->intra, unit, rootdata, leafdata, op));
+  link->inuse = PETSC_FALSE;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PetscSFReduceBegin_Node(PetscSF sf, MPI_Datatype unit, PetscMemType leafmtype, const void *leafdata, PetscMemType rootmtype, void *rootdata, MPI_Op op)
+{
+  PetscSF_Node   *dat = (PetscSF_Node *)sf->data;
+  PetscSFNodeLink link;
+
+  PetscFunctionBegin;
+  PetscCall(PetscSFNodeGetLink(sf, unit, rootmtype, rootdata, leafmtype, leafdata, &link));
+  PetscCall(PetscSFReduceWithMemTypeBegin(dat->intra, unit, leafmtype, leafdata, rootmtype, rootdata, op));
+  PetscCall(PetscSFReduceWithMemTypeBegin(dat->scatter, unit, leafmtype, leafdata, PETSC_MEMTYPE_HOST, link->inbuf, MPI_REPLACE));
+  PetscCall(PetscSFReduceEnd(dat->scatter, unit, leafdata, link->inbuf, MPI_REPLACE));
+  PetscCall(PetscSFReduceWithMemTypeBegin(dat->inter, unit, PETSC_MEMTYPE_HOST, link->inbuf, PETSC_MEMTYPE_HOST, link->outbuf, MPI_REPLACE));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PetscSFReduceEnd_Node(PetscSF sf, MPI_Datatype unit, const void *leafdata, void *rootdata, MPI_Op op)
+{
+  PetscSF_Node   *dat = (PetscSF_Node *)sf->data;
+  PetscSFNodeLink link;
+
+  PetscFunctionBegin;
+  PetscCall(PetscSFNodeFindLink(sf, unit, rootdata, leafdata, &link));
+  PetscCall(PetscSFReduceEnd(dat->inter, unit, link->inbuf, link->outbuf, MPI_REPLACE));
+  /* The intra and gather stages reduce into the same roots; a window stage works on a copy of the roots between Begin() and End(), so they must not overlap */
+  PetscCall(PetscSFReduceEnd(dat->intra, unit, leafdata, rootdata, op));
+  PetscCall(PetscSFReduceWithMemTypeBegin(dat->gather, unit, PETSC_MEMTYPE_HOST, link->outbuf, link->rootmtype, rootdata, op));
+  PetscCall(PetscSFReduceEnd(dat->gather, unit, link->outbuf, rootdata, op));
+  link->inuse = PETSC_FALSE;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PETSC_INTERN PetscErrorCode PetscSFCreate_Node(PetscSF sf)
+{
+  PetscSF_Node *dat;
+
+  PetscFunctionBegin;
+  sf->ops->CreateEmbeddedRootSF = PetscSFCreateEmbeddedRootSF_Basic;
+  sf->ops->FetchAndOpBegin      = PetscSFFetchAndOpBegin_Basic;
+  sf->ops->FetchAndOpEnd        = PetscSFFetchAndOpEnd_Basic;
+  sf->ops->GetLeafRanks         = PetscSFGetLeafRanks_Basic;
+  sf->ops->SetCommunicationOps  = PetscSFSetCommunicationOps_Basic;
+
+  sf->ops->SetUp          = PetscSFSetUp_Node;
+  sf->ops->SetFromOptions = PetscSFSetFromOptions_Node;
+  sf->ops->Reset          = PetscSFReset_Node;
+  sf->ops->Destroy        = PetscSFDestroy_Node;
+  sf->ops->View           = PetscSFView_Node;
+  sf->ops->Duplicate      = PetscSFDuplicate_Node;
+  sf->ops->BcastBegin     = PetscSFBcastBegin_Node;
+  sf->ops->BcastEnd       = PetscSFBcastEnd_Node;
+  sf->ops->ReduceBegin    = PetscSFReduceBegin_Node;
+  sf->ops->ReduceEnd      = PetscSFReduceEnd_Node;
+
+  sf->persistent = PETSC_TRUE; // FetchAndOp goes through SFBASIC, which uses persistent send/recv
+  sf->collective = PETSC_FALSE;
+
+  PetscCall(PetscNew(&dat));
+  dat->nodecomm = MPI_COMM_NULL;
+  sf->data      = (void *)dat;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
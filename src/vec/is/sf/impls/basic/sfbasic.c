@@ -11,7 +11,7 @@ static PetscErrorCode PetscSFLinkInitMPIRequests_Persistent_Basic(PetscSF sf, Pe
   const PetscInt    *rootoffset, *leafoffset;
   MPI_Aint           disp;
   MPI_Comm           comm          = PetscObjectComm((PetscObject)sf);
-  MPI_Datatype       unit          = link->unit;
+  MPI_Datatype       unit          = link->unit_mpi;
   const PetscMemType rootmtype_mpi = link->rootmtype_mpi, leafmtype_mpi = link->leafmtype_mpi; /* Used to select buffers passed to MPI */
   const PetscInt     rootdirect_mpi = link->rootdirect_mpi, leafdirect_mpi = link->leafdirect_mpi;
 
@@ -20,13 +20,13 @@ static PetscErrorCode PetscSFLinkInitMPIRequests_Persistent_Basic(PetscSF sf, Pe
     PetscCall(PetscSFGetRootInfo_Basic(sf, &nrootranks, &ndrootranks, NULL, &rootoffset, NULL));
     if (direction == PETSCSF_LEAF2ROOT) {
       for (PetscMPIInt i = ndrootranks, j = 0; i < nrootranks; i++, j++) {
-        disp = (rootoffset[i] - rootoffset[ndrootranks]) * link->unitbytes;
+        disp = (rootoffset[i] - rootoffset[ndrootranks]) * link->unitbytes_mpi;
         cnt  = rootoffset[i + 1] - rootoffset[i];
         PetscCallMPI(MPIU_Recv_init(link->rootbuf[PETSCSF_REMOTE][rootmtype_mpi] + disp, cnt, unit, bas->iranks[i], link->tag, comm, link->rootreqs[direction][rootmtype_mpi][rootdirect_mpi] + j));
       }
     } else { /* PETSCSF_ROOT2LEAF */
       for (PetscMPIInt i = ndrootranks, j = 0; i < nrootranks; i++, j++) {
-        disp = (rootoffset[i] - rootoffset[ndrootranks]) * link->unitbytes;
+        disp = (rootoffset[i] - rootoffset[ndrootranks]) * link->unitbytes_mpi;
         cnt  = rootoffset[i + 1] - rootoffset[i];
         PetscCallMPI(MPIU_Send_init(link->rootbuf[PETSCSF_REMOTE][rootmtype_mpi] + disp, cnt, unit, bas->iranks[i], link->tag, comm, link->rootreqs[direction][rootmtype_mpi][rootdirect_mpi] + j));
       }
@@ -38,13 +38,13 @@ static PetscErrorCode PetscSFLinkInitMPIRequests_Persistent_Basic(PetscSF sf, Pe
     PetscCall(PetscSFGetLeafInfo_Basic(sf, &nleafranks, &ndleafranks, NULL, &leafoffset, NULL, NULL));
     if (direction == PETSCSF_LEAF2ROOT) {
       for (PetscMPIInt i = ndleafranks, j = 0; i < nleafranks; i++, j++) {
-        disp = (leafoffset[i] - leafoffset[ndleafranks]) * link->unitbytes;
+        disp = (leafoffset[i] - leafoffset[ndleafranks]) * link->unitbytes_mpi;
         cnt  = leafoffset[i + 1] - leafoffset[i];
         PetscCallMPI(MPIU_Send_init(link->leafbuf[PETSCSF_REMOTE][leafmtype_mpi] + disp, cnt, unit, sf->ranks[i], link->tag, comm, link->leafreqs[direction][leafmtype_mpi][leafdirect_mpi] + j));
       }
     } else { /* PETSCSF_ROOT2LEAF */
       for (PetscMPIInt i = ndleafranks, j = 0; i < nleafranks; i++, j++) {
-        disp = (leafoffset[i] - leafoffset[ndleafranks]) * link->unitbytes;
+        disp = (leafoffset[i] - leafoffset[ndleafranks]) * link->unitbytes_mpi;
         cnt  = leafoffset[i + 1] - leafoffset[i];
         PetscCallMPI(MPIU_Recv_init(link->leafbuf[PETSCSF_REMOTE][leafmtype_mpi] + disp, cnt, unit, sf->ranks[i], link->tag, comm, link->leafreqs[direction][leafmtype_mpi][leafdirect_mpi] + j));
       }
@@ -79,16 +79,18 @@ static PetscErrorCode PetscSFLinkStartCommunication_Persistent_Basic(PetscSF sf,
     if (direction == PETSCSF_ROOT2LEAF) {
       nsreqs = bas->nrootreqs;
       PetscCall(PetscSFLinkCopyRootBufferInCaseNotUseGpuAwareMPI(sf, link, PETSC_TRUE /*device2host before sending */));
+      if (link->reduced) PetscCall(PetscSFLinkDemoteBuffer(link, sbuflen, link->rootbuf[PETSCSF_REMOTE][PETSC_MEMTYPE_HOST]));
       PetscCall(PetscSFLinkGetMPIBuffersAndRequests(sf, link, direction, NULL, NULL, &sreqs, NULL));
     } else { /* leaf to root */
       nsreqs = sf->nleafreqs;
       PetscCall(PetscSFLinkCopyLeafBufferInCaseNotUseGpuAwareMPI(sf, link, PETSC_TRUE));
+      if (link->reduced) PetscCall(PetscSFLinkDemoteBuffer(link, sbuflen, link->leafbuf[PETSCSF_REMOTE][PETSC_MEMTYPE_HOST]));
       PetscCall(PetscSFLinkGetMPIBuffersAndRequests(sf, link, direction, NULL, NULL, NULL, &sreqs));
     }
   }
   PetscCall(PetscSFLinkSyncStreamBeforeCallMPI(sf, link)); // need to sync the stream to make BOTH sendbuf and recvbuf ready
-  if (rbuflen) PetscCallMPI(MPI_Startall_irecv(rbuflen, link->unit, nrreqs, rreqs));
-  if (sbuflen) PetscCallMPI(MPI_Startall_isend(sbuflen, link->unit, nsreqs, sreqs));
+  if (rbuflen) PetscCallMPI(MPI_Startall_irecv(rbuflen, link->unit_mpi, nrreqs, rreqs));
+  if (sbuflen) PetscCallMPI(MPI_Startall_isend(sbuflen, link->unit_mpi, nsreqs, sreqs));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -158,7 +160,7 @@ static PetscErrorCode PetscSFLinkFinishCommunication_MPIX_Stream(PetscSF sf, Pet
 }
 #endif
 
-static PetscErrorCode PetscSFSetCommunicationOps_Basic(PetscSF sf, PetscSFLink link)
+PETSC_INTERN PetscErrorCode PetscSFSetCommunicationOps_Basic(PetscSF sf, PetscSFLink link)
 {
   PetscFunctionBegin;
   link->InitMPIRequests    = PetscSFLinkInitMPIRequests_Persistent_Basic;
@@ -20,13 +20,13 @@ static PetscErrorCode PetscSFLinkFinishCommunication_Default(PetscSF sf, PetscSF
     PetscCallMPI(MPI_Comm_rank(PetscObjectComm((PetscObject)sf), &rank));
 
     for (PetscMPIInt i = 0; i < bas->nrootreqs; i++) {
-      size_t size = (bas->ioffset[i + bas->ndiranks + 1] - bas->ioffset[i + bas->ndiranks]) * link->unitbytes;
+      size_t size = (bas->ioffset[i + bas->ndiranks + 1] - bas->ioffset[i + bas->ndiranks]) * link->unitbytes_mpi;
       PetscCall(PetscPrintf(PETSC_COMM_SELF, "Rank %6d %s Rank %6d (%16zu bytes) with MPI tag %10d ... ", rank, rootaction, bas->iranks[i + bas->ndiranks], size, link->tag));
       PetscCallMPI(MPI_Wait(link->rootreqs[direction][rootmtype_mpi][rootdirect_mpi] + i, MPI_STATUS_IGNORE));
       PetscCall(PetscPrintf(PETSC_COMM_SELF, "DONE\n"));
     }
     for (PetscMPIInt i = 0; i < sf->nleafreqs; i++) {
-      size_t size = (sf->roffset[i + sf->ndranks + 1] - sf->roffset[i + sf->ndranks]) * link->unitbytes;
+      size_t size = (sf->roffset[i + sf->ndranks + 1] - sf->roffset[i + sf->ndranks]) * link->unitbytes_mpi;
       PetscCall(PetscPrintf(PETSC_COMM_SELF, "Rank %6d %s Rank %6d (%16zu bytes) with MPI tag %10d ... ", rank, leafaction, sf->ranks[i + sf->ndranks], size, link->tag));
       PetscCallMPI(MPI_Wait(link->leafreqs[direction][leafmtype_mpi][leafdirect_mpi] + i, MPI_STATUS_IGNORE));
       PetscCall(PetscPrintf(PETSC_COMM_SELF, "DONE\n"));
@@ -37,6 +37,10 @@ static PetscErrorCode PetscSFLinkFinishCommunication_Default(PetscSF sf, PetscSF
     if (sf->nleafreqs) PetscCallMPI(MPI_Waitall(sf->nleafreqs, link->leafreqs[direction][leafmtype_mpi][leafdirect_mpi], MPI_STATUSES_IGNORE));
   }
 
+  if (link->reduced) {
+    if (direction == PETSCSF_ROOT2LEAF) PetscCall(PetscSFLinkPromoteBuffer(link, sf->leafbuflen[PETSCSF_REMOTE], link->leafbuf[PETSCSF_REMOTE][PETSC_MEMTYPE_HOST]));
+    else PetscCall(PetscSFLinkPromoteBuffer(link, bas->rootbuflen[PETSCSF_REMOTE], link->rootbuf[PETSCSF_REMOTE][PETSC_MEMTYPE_HOST]));
+  }
   if (direction == PETSCSF_ROOT2LEAF) {
     PetscCall(PetscSFLinkCopyLeafBufferInCaseNotUseGpuAwareMPI(sf, link, PETSC_FALSE /* host2device after recving */));
   } else {
@@ -68,7 +72,7 @@ PetscErrorCode PetscSFLinkCreate_MPI(PetscSF sf, MPI_Datatype unit, PetscMemType
   PetscSFLink     *p, link;
   PetscSFDirection direction;
   MPI_Request     *reqs = NULL;
-  PetscBool        match, rootdirect[2], leafdirect[2];
+  PetscBool        match, rootdirect[2], leafdirect[2], reduced = PETSC_FALSE;
   PetscMemType     rootmtype = PetscMemTypeHost(xrootmtype) ? PETSC_MEMTYPE_HOST : PETSC_MEMTYPE_DEVICE; /* Convert to 0/1 as we will use it in subscript */
   PetscMemType     leafmtype = PetscMemTypeHost(xleafmtype) ? PETSC_MEMTYPE_HOST : PETSC_MEMTYPE_DEVICE;
   PetscMemType     rootmtype_mpi, leafmtype_mpi;   /* mtypes seen by MPI */
@@ -106,6 +110,27 @@ PetscErrorCode PetscSFLinkCreate_MPI(PetscSF sf, MPI_Datatype unit, PetscMemType
   } else {
     rootmtype_mpi = leafmtype_mpi = PETSC_MEMTYPE_HOST;
   }
+
+#if defined(PETSC_USE_REAL_DOUBLE)
+  /* Remote data is sent in single precision by converting host buffers in place, so they have to be separate from root/leafdata */
+  if (sf->reduced_precision && sfop != PETSCSF_FETCH && PetscMemTypeHost(rootmtype_mpi) && PetscMemTypeHost(leafmtype_mpi)) {
+    PetscBool isbasic;
+    PetscInt  nreal = 0, ncomplex = 0;
+
+    PetscCall(PetscObjectTypeCompare((PetscObject)sf, PETSCSFBASIC, &isbasic));
+    if (isbasic) {
+      PetscCall(MPIPetsc_Type_compare_contig(unit, MPIU_REAL, &nreal));
+  #if defined(PETSC_HAVE_COMPLEX)
+      PetscCall(MPIPetsc_Type_compare_contig(unit, MPIU_COMPLEX, &ncomplex));
+  #endif
+    }
+    if (nreal || ncomplex) {
+      reduced                    = PETSC_TRUE;
+      rootdirect[PETSCSF_REMOTE] = PETSC_FALSE;
+      leafdirect[PETSCSF_REMOTE] = PETSC_FALSE;
+    }
+  }
+#endif
   /* Will root/leafdata be directly accessed by MPI?  Without use_gpu_aware_mpi, device data is buffered on host and then passed to MPI */
   rootdirect_mpi = rootdirect[PETSCSF_REMOTE] && (rootmtype_mpi == rootmtype) ? 1 : 0;
   leafdirect_mpi = leafdirect[PETSCSF_REMOTE] && (leafmtype_mpi == leafmtype) ? 1 : 0;
@@ -118,7 +143,7 @@ PetscErrorCode PetscSFLinkCreate_MPI(PetscSF sf, MPI_Datatype unit, PetscMemType
   for (p = &bas->avail; (link = *p); p = &link->next) {
     if (!link->use_nvshmem) { /* Only check with MPI links */
       PetscCall(MPIPetsc_Type_compare(unit, link->unit, &match));
-      if (match) {
+      if (match && link->reduced == reduced) {
         /* If root/leafdata will be directly passed to MPI, test if the data used to initialized the MPI requests matches with the current.
            If not, free old requests. New requests will be lazily init'ed until one calls PetscSFLinkGetMPIBuffersAndRequests() with the same tag.
         */
@@ -144,6 +169,17 @@ PetscErrorCode PetscSFLinkCreate_MPI(PetscSF sf, MPI_Datatype unit, PetscMemType
 
   PetscCall(PetscNew(&link));
   PetscCall(PetscSFLinkSetUp_Host(sf, link, unit));
+  link->unit_mpi      = link->unit;
+  link->unitbytes_mpi = link->unitbytes;
+  if (reduced) {
+    PetscMPIInt nfloat;
+
+    PetscCall(PetscMPIIntCast(link->unitbytes / sizeof(double), &nfloat));
+    PetscCallMPI(MPI_Type_contiguous(nfloat, MPI_FLOAT, &link->unit_mpi));
+    PetscCallMPI(MPI_Type_commit(&link->unit_mpi));
+    link->unitbytes_mpi = nfloat * sizeof(float);
+    link->reduced       = PETSC_TRUE;
+  }
   PetscCall(PetscCommGetNewTag(PetscObjectComm((PetscObject)sf), &link->tag)); /* One tag per link */
 
   nreqs = (nrootreqs + nleafreqs) * 8;
@@ -403,6 +403,7 @@ DEF_DumbType(DumbInt, 1, 1) DEF_DumbType(DumbInt, 2, 1) DEF_DumbType(DumbInt, 4,
 
   /* Destroy host related fields */
   if (!link->isbuiltin) PetscCallMPI(MPI_Type_free(&link->unit));
+  if (link->reduced) PetscCallMPI(MPI_Type_free(&link->unit_mpi));
   if (!link->use_nvshmem) {
     for (i = 0; i < nreqs; i++) { /* Persistent reqs must be freed. */
       if (link->reqs[i] != MPI_REQUEST_NULL) PetscCallMPI(MPI_Request_free(&link->reqs[i]));
@@ -1079,6 +1080,42 @@ PetscErrorCode PetscSFLinkFetchAndOpRemote(PetscSF sf, PetscSFLink link, void *r
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/* With PetscSFSetReducedPrecision(), a packed remote buffer of <count> units made of doubles is converted in place to floats before
+   sending, and the received floats are converted back in place before unpacking. memcpy() keeps the in place conversions free of
+   aliasing issues, and demotion runs front to back and promotion back to front so that no value is overwritten before it is read.
+*/
+PetscErrorCode PetscSFLinkDemoteBuffer(PetscSFLink link, PetscInt count, char *buf)
+{
+  const PetscInt n = count * (PetscInt)(link->unitbytes / sizeof(double));
+
+  PetscFunctionBegin;
+  for (PetscInt i = 0; i < n; i++) {
+    double d;
+    float  f;
+
+    memcpy(&d, buf + i * sizeof(double), sizeof(double));
+    f = (float)d;
+    memcpy(buf + i * sizeof(float), &f, sizeof(float));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PetscErrorCode PetscSFLinkPromoteBuffer(PetscSFLink link, PetscInt count, char *buf)
+{
+  const PetscInt n = count * (PetscInt)(link->unitbytes / sizeof(double));
+
+  PetscFunctionBegin;
+  for (PetscInt i = n - 1; i >= 0; i--) {
+    double d;
+    float  f;
+
+    memcpy(&f, buf + i * sizeof(float), sizeof(float));
+    d = (double)f;
+    memcpy(buf + i * sizeof(double), &d, sizeof(double));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 PetscErrorCode PetscSFLinkScatterLocal(PetscSF sf, PetscSFLink link, PetscSFDirection direction, void *rootdata, void *leafdata, MPI_Op op)
 {
   const PetscInt *rootindices = NULL, *leafindices = NULL;
@@ -174,6 +174,9 @@ struct _n_PetscSFLink {
   PetscBool    isbuiltin;            /* Is unit an MPI/PETSc builtin datatype? If it is true, then bs=1 and basicunit is equivalent to unit */
   size_t       unitbytes;            /* Number of bytes in a unit */
   PetscInt     bs;                   /* Number of basic units in a unit */
+  PetscBool    reduced;              /* Are remote buffers sent in single precision? See PetscSFSetReducedPrecision() */
+  MPI_Datatype unit_mpi;             /* The MPI datatype of a unit in remote buffers passed to MPI, which is unit unless reduced */
+  size_t       unitbytes_mpi;        /* Number of bytes in a unit_mpi */
   const void  *rootdata, *leafdata;  /* rootdata and leafdata the link is working on. They are used as keys for pending links. */
   PetscMemType rootmtype, leafmtype; /* root/leafdata's memory type */
 
@@ -238,6 +241,8 @@ PETSC_INTERN PetscErrorCode PetscSFLinkPackLeafData(PetscSF, PetscSFLink, PetscS
 PETSC_INTERN PetscErrorCode PetscSFLinkUnpackRootData(PetscSF, PetscSFLink, PetscSFScope, void *, MPI_Op);
 PETSC_INTERN PetscErrorCode PetscSFLinkUnpackLeafData(PetscSF, PetscSFLink, PetscSFScope, void *, MPI_Op);
 PETSC_INTERN PetscErrorCode PetscSFLinkFetchAndOpRemote(PetscSF, PetscSFLink, void *, MPI_Op);
+PETSC_INTERN PetscErrorCode PetscSFLinkDemoteBuffer(PetscSFLink, PetscInt, char *);
+PETSC_INTERN PetscErrorCode PetscSFLinkPromoteBuffer(PetscSFLink, PetscInt, char *);
 
 PETSC_INTERN PetscErrorCode PetscSFLinkScatterLocal(PetscSF, PetscSFLink, PetscSFDirection, void *, void *, MPI_Op);
 PETSC_INTERN PetscErrorCode PetscSFLinkFetchAndOpLocal(PetscSF, PetscSFLink, void *, const void *, void *, MPI_Op);
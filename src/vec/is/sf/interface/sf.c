@@ -156,6 +156,7 @@ PetscErrorCode PetscSFReset(PetscSF sf)
 .vb
     PETSCSFWINDOW - MPI-2/3 one-sided
     PETSCSFBASIC - basic implementation using MPI-1 two-sided
+    PETSCSFNODE - two-level implementation that aggregates the messages between nodes through one rank per node
 .ve
 
   Options Database Key:
@@ -166,6 +167,11 @@ PetscErrorCode PetscSFReset(PetscSF sf)
   Notes:
   See `PetscSFType` for possible values
 
+  With `PETSCSFNODE` only the first rank of each node sends and receives messages to and from other nodes, one per pair
+  of nodes, collecting and distributing the data of the other ranks on its node. Nodes are the ranks sharing memory,
+  or groups of `-sf_node_size` consecutive ranks. Use `-sf_node_window` to move the data within a node with MPI shared
+  memory windows.
+
 .seealso: `PetscSF`, `PetscSFType`, `PetscSFCreate()`
 @*/
 PetscErrorCode PetscSFSetType(PetscSF sf, PetscSFType type)
@@ -356,6 +362,7 @@ PetscErrorCode PetscSFSetFromOptions(PetscSF sf)
   PetscCall(PetscSFSetType(sf, flg ? type : deft));
   PetscCall(PetscOptionsBool("-sf_rank_order", "sort composite points for gathers and scatters in rank order, gathers are non-deterministic otherwise", "PetscSFSetRankOrder", sf->rankorder, &sf->rankorder, NULL));
   PetscCall(PetscOptionsBool("-sf_monitor", "monitor the MPI communication in sf", NULL, sf->monitor, &sf->monitor, NULL));
+  PetscCall(PetscOptionsBool("-sf_reduced_precision", "send double precision data to other ranks in single precision", "PetscSFSetReducedPrecision", sf->reduced_precision, &sf->reduced_precision, NULL));
 #if defined(PETSC_HAVE_DEVICE)
   {
     char      backendstr[32] = {0};
@@ -418,6 +425,65 @@ PetscErrorCode PetscSFSetRankOrder(PetscSF sf, PetscBool flg)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+  PetscSFSetReducedPrecision - communicate double precision data between ranks in single precision
+
+  Logically Collective
+
+  Input Parameters:
++ sf  - star forest
+- flg - `PETSC_TRUE` to send remote data in single precision
+
+  Options Database Key:
+. -sf_reduced_precision <bool> - send double precision data to other ranks in single precision
+
+  Level: advanced
+
+  Notes:
+  Only the data exchanged with other ranks is affected. Units made of double precision `MPIU_REAL` or `MPIU_SCALAR` are converted to single precision
+  after packing and back to double precision before unpacking, halving the communication volume, while data on the same rank is copied
+  at full precision. Other data types and `PetscSFFetchAndOpBegin()` are not affected.
+
+  Currently only `PETSCSFBASIC` supports this, and only when the buffers passed to MPI are on the host.
+
+  This is meant for communication whose accuracy matters little, such as the ghost updates in smoothers or coarse grid transfers of a
+  preconditioner. For a `VecScatter` use an options prefix to enable it for that scatter only.
+
+.seealso: `PetscSF`, `PetscSFGetReducedPrecision()`, `PetscSFBcastBegin()`, `PetscSFReduceBegin()`, `VecScatterSetFromOptions()`
+@*/
+PetscErrorCode PetscSFSetReducedPrecision(PetscSF sf, PetscBool flg)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(sf, PETSCSF_CLASSID, 1);
+  PetscValidLogicalCollectiveBool(sf, flg, 2);
+  sf->reduced_precision = flg;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+  PetscSFGetReducedPrecision - get whether double precision data is communicated between ranks in single precision
+
+  Not Collective
+
+  Input Parameter:
+. sf - star forest
+
+  Output Parameter:
+. flg - `PETSC_TRUE` if remote data is sent in single precision
+
+  Level: advanced
+
+.seealso: `PetscSF`, `PetscSFSetReducedPrecision()`
+@*/
+PetscErrorCode PetscSFGetReducedPrecision(PetscSF sf, PetscBool *flg)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(sf, PETSCSF_CLASSID, 1);
+  PetscAssertPointer(flg, 2);
+  *flg = sf->reduced_precision;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
   PetscSFSetGraph - Set a parallel star forest
 
@@ -747,6 +813,7 @@ PetscErrorCode PetscSFDuplicate(PetscSF sf, PetscSFDuplicateOption opt, PetscSF
   PetscCall(PetscSFGetType(sf, &type));
   if (type) PetscCall(PetscSFSetType(*newsf, type));
   (*newsf)->allow_multi_leaves = sf->allow_multi_leaves; /* Dup this flag earlier since PetscSFSetGraph() below checks on this flag */
+  (*newsf)->reduced_precision  = sf->reduced_precision;
   if (opt == PETSCSF_DUPLICATE_GRAPH) {
     PetscSFCheckGraphSet(sf, 1);
     if (sf->pattern == PETSCSF_PATTERN_GENERAL) {
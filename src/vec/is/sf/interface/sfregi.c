@@ -9,6 +9,7 @@ PETSC_INTERN PetscErrorCode PetscSFCreate_Allgather(PetscSF);
 PETSC_INTERN PetscErrorCode PetscSFCreate_Gatherv(PetscSF);
 PETSC_INTERN PetscErrorCode PetscSFCreate_Gather(PetscSF);
 PETSC_INTERN PetscErrorCode PetscSFCreate_Alltoall(PetscSF);
+PETSC_INTERN PetscErrorCode PetscSFCreate_Node(PetscSF);
 #if defined(PETSC_HAVE_MPI_NEIGHBORHOOD_COLLECTIVES)
 PETSC_INTERN PetscErrorCode PetscSFCreate_Neighbor(PetscSF);
 #endif
@@ -39,6 +40,7 @@ PetscErrorCode PetscSFRegisterAll(void)
   PetscCall(PetscSFRegister(PETSCSFGATHERV, PetscSFCreate_Gatherv));
   PetscCall(PetscSFRegister(PETSCSFGATHER, PetscSFCreate_Gather));
   PetscCall(PetscSFRegister(PETSCSFALLTOALL, PetscSFCreate_Alltoall));
+  PetscCall(PetscSFRegister(PETSCSFNODE, PetscSFCreate_Node));
 #if defined(PETSC_HAVE_MPI_NEIGHBORHOOD_COLLECTIVES)
   PetscCall(PetscSFRegister(PETSCSFNEIGHBOR, PetscSFCreate_Neighbor));
 #endif
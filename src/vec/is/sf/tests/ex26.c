@@ -0,0 +1,93 @@
+static const char help[] = "Tests the reduced precision remote communication of PetscSF against a full precision exchange.\n\n";
+
+#include <petscvec.h>
+#include <petscsf.h>
+
+/* Relative difference of u from the reference v, printed as a check that does not depend on the exact rounding */
+static PetscErrorCode CheckDifference(const char name[], Vec u, Vec v, PetscBool reduced)
+{
+  Vec       w;
+  PetscReal nrm, err;
+
+  PetscFunctionBeginUser;
+  PetscCall(VecDuplicate(u, &w));
+  PetscCall(VecWAXPY(w, -1.0, v, u));
+  PetscCall(VecNorm(w, NORM_INFINITY, &err));
+  PetscCall(VecNorm(v, NORM_INFINITY, &nrm));
+  err /= nrm;
+  if (reduced) PetscCall(PetscPrintf(PETSC_COMM_WORLD, "%s in reduced precision: error %s\n", name, err == 0 ? "== 0" : (err < 1.e-6 ? "> 0 and < 1e-6" : ">= 1e-6")));
+  else PetscCall(PetscPrintf(PETSC_COMM_WORLD, "%s in full precision: error %s\n", name, err == 0 ? "== 0" : "> 0"));
+  PetscCall(VecDestroy(&w));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+int main(int argc, char **argv)
+{
+  Vec          x, y, yref, z, zref;
+  VecScatter   scatter, rscatter;
+  IS           ix;
+  PetscInt     N = 40, rstart, rend;
+  PetscScalar *a;
+
+  PetscFunctionBeginUser;
+  PetscCall(PetscInitialize(&argc, &argv, NULL, help));
+  PetscCall(PetscOptionsGetInt(NULL, NULL, "-n", &N, NULL));
+  PetscCall(VecCreateFromOptions(PETSC_COMM_WORLD, NULL, 1, PETSC_DECIDE, N, &x));
+  PetscCall(VecDuplicate(x, &y));
+  PetscCall(VecDuplicate(x, &yref));
+  PetscCall(VecDuplicate(x, &z));
+  PetscCall(VecDuplicate(x, &zref));
+
+  /* values that single precision cannot represent exactly */
+  PetscCall(VecGetOwnershipRange(x, &rstart, &rend));
+  PetscCall(VecGetArrayWrite(x, &a));
+  for (PetscInt i = rstart; i < rend; i++) a[i - rstart] = 1.0 / 3.0 + (PetscReal)i / 7.0;
+  PetscCall(VecRestoreArrayWrite(x, &a));
+
+  /* reverse the vector, so that most entries move to another process */
+  PetscCall(ISCreateStride(PETSC_COMM_WORLD, rend - rstart, N - 1 - rstart, -1, &ix));
+  PetscCall(VecScatterCreate(x, ix, y, NULL, &scatter));
+  PetscCall(VecScatterCreate(x, ix, y, NULL, &rscatter));
+  PetscCall(PetscSFSetReducedPrecision(rscatter, PETSC_TRUE));
+  PetscCall(ISDestroy(&ix));
+
+  /* the full precision exchange is the reference, it is checked against the values computed directly */
+  PetscCall(VecScatterBegin(scatter, x, yref, INSERT_VALUES, SCATTER_FORWARD));
+  PetscCall(VecScatterEnd(scatter, x, yref, INSERT_VALUES, SCATTER_FORWARD));
+  PetscCall(VecGetArrayWrite(y, &a));
+  for (PetscInt i = rstart; i < rend; i++) a[i - rstart] = 1.0 / 3.0 + (PetscReal)(N - 1 - i) / 7.0;
+  PetscCall(VecRestoreArrayWrite(y, &a));
+  PetscCall(CheckDifference("Forward scatter", yref, y, PETSC_FALSE));
+
+  PetscCall(VecScatterBegin(rscatter, x, y, INSERT_VALUES, SCATTER_FORWARD));
+  PetscCall(VecScatterEnd(rscatter, x, y, INSERT_VALUES, SCATTER_FORWARD));
+  PetscCall(CheckDifference("Forward scatter", y, yref, PETSC_TRUE));
+
+  /* the reverse scatter adds, it goes through the reduction of PetscSF */
+  PetscCall(VecCopy(x, zref));
+  PetscCall(VecCopy(x, z));
+  PetscCall(VecScatterBegin(scatter, yref, zref, ADD_VALUES, SCATTER_REVERSE));
+  PetscCall(VecScatterEnd(scatter, yref, zref, ADD_VALUES, SCATTER_REVERSE));
+  PetscCall(VecScatterBegin(rscatter, yref, z, ADD_VALUES, SCATTER_REVERSE));
+  PetscCall(VecScatterEnd(rscatter, yref, z, ADD_VALUES, SCATTER_REVERSE));
+  PetscCall(CheckDifference("Reverse scatter", z, zref, PETSC_TRUE));
+
+  PetscCall(VecScatterDestroy(&scatter));
+  PetscCall(VecScatterDestroy(&rscatter));
+  PetscCall(VecDestroy(&x));
+  PetscCall(VecDestroy(&y));
+  PetscCall(VecDestroy(&yref));
+  PetscCall(VecDestroy(&z));
+  PetscCall(VecDestroy(&zref));
+  PetscCall(PetscFinalize());
+  return 0;
+}
+
+/*TEST
+
+   test:
+     requires: double
+     nsize: {{2 3}}
+     output_file: output/ex26_1.out
+
+TEST*/
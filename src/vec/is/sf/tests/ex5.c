@@ -269,4 +269,19 @@ int main(int argc, char **argv)
      args: -view -nl 5 -explicit_inverse {{0 1}} -sf_type window -sf_window_sync {{fence lock active}} -sf_window_flavor shared
      requires: defined(PETSC_HAVE_MPI_PROCESS_SHARED_MEMORY) !defined(PETSC_HAVE_MPICH) defined(PETSC_HAVE_MPI_ONE_SIDED)
 
+   test:
+     nsize: 7
+     suffix: 2_node
+     filter: grep -v "type" | grep -v "sort" | grep -v "nodes"
+     output_file: output/ex5_2.out
+     args: -view -nl 5 -explicit_inverse {{0 1}} -sf_type node -sf_node_size {{1 3}}
+
+   test:
+     nsize: 7
+     suffix: 2_node_window
+     filter: grep -v "type" | grep -v "sort" | grep -v "nodes"
+     output_file: output/ex5_2.out
+     args: -view -nl 5 -explicit_inverse {{0 1}} -sf_type node -sf_node_size {{1 3}} -sf_node_window
+     requires: defined(PETSC_HAVE_MPI_PROCESS_SHARED_MEMORY) !defined(PETSC_HAVE_MPICH) defined(PETSC_HAVE_MPI_ONE_SIDED)
+
 TEST*/
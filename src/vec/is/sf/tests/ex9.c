@@ -495,4 +495,30 @@ int main(int argc, char **argv)
        requires: defined(PETSC_HAVE_MPI_PERSISTENT_NEIGHBORHOOD_COLLECTIVES)
        args: -sf_neighbor_persistent
 
+   testset:
+     nsize: 7
+     args: -sf_type node -sf_node_size 3
+
+     test:
+       suffix: 91
+       args: -world2sub
+       output_file: output/ex9_1.out
+
+     test:
+       suffix: 93
+       args: -world2subs
+       output_file: output/ex9_3.out
+
+     test:
+       suffix: 92
+       args: -world2sub -sf_node_window
+       output_file: output/ex9_1.out
+       requires: defined(PETSC_HAVE_MPI_PROCESS_SHARED_MEMORY) !defined(PETSC_HAVE_MPICH) defined(PETSC_HAVE_MPI_ONE_SIDED)
+
+     test:
+       suffix: 94
+       args: -world2subs -sf_node_window
+       output_file: output/ex9_3.out
+       requires: defined(PETSC_HAVE_MPI_PROCESS_SHARED_MEMORY) !defined(PETSC_HAVE_MPICH) defined(PETSC_HAVE_MPI_ONE_SIDED)
+
 TEST*/
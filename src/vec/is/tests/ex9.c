@@ -0,0 +1,63 @@
+static char help[] = "Tests PetscSectionGetDofs(), PetscSectionGetOffsets(), PetscSectionGetFieldDofs(), and PetscSectionGetFieldOffsets().\n\n";
+
+#include <petscsection.h>
+
+int main(int argc, char **argv)
+{
+  PetscSection   s;
+  const PetscInt Nf = 2, pStart = 2, pEnd = 9;
+  const PetscInt points[] = {8, 2, 5, 5, 3};
+  const PetscInt n        = PETSC_STATIC_ARRAY_LENGTH(points);
+  PetscInt       dofs[5], offs[5], fdofs[10], foffs[10];
+  PetscBool      pointMajor = PETSC_TRUE;
+
+  PetscFunctionBeginUser;
+  PetscCall(PetscInitialize(&argc, &argv, NULL, help));
+  PetscCall(PetscOptionsGetBool(NULL, NULL, "-point_major", &pointMajor, NULL));
+  PetscCall(PetscSectionCreate(PETSC_COMM_SELF, &s));
+  PetscCall(PetscSectionSetNumFields(s, Nf));
+  PetscCall(PetscSectionSetChart(s, pStart, pEnd));
+  PetscCall(PetscSectionSetPointMajor(s, pointMajor));
+  for (PetscInt p = pStart; p < pEnd; ++p) {
+    PetscCall(PetscSectionSetFieldDof(s, p, 0, p % 3));
+    PetscCall(PetscSectionSetFieldDof(s, p, 1, 1));
+    PetscCall(PetscSectionSetDof(s, p, p % 3 + 1));
+  }
+  PetscCall(PetscSectionSetUp(s));
+
+  PetscCall(PetscSectionGetDofs(s, n, points, dofs));
+  PetscCall(PetscSectionGetOffsets(s, n, points, offs));
+  PetscCall(PetscSectionGetFieldDofs(s, n, points, fdofs));
+  PetscCall(PetscSectionGetFieldOffsets(s, n, points, foffs));
+  for (PetscInt i = 0; i < n; ++i) {
+    PetscInt dof, off;
+
+    PetscCall(PetscSectionGetDof(s, points[i], &dof));
+    PetscCall(PetscSectionGetOffset(s, points[i], &off));
+    PetscCheck(dofs[i] == dof, PETSC_COMM_SELF, PETSC_ERR_PLIB, "Point %" PetscInt_FMT " dof %" PetscInt_FMT " != %" PetscInt_FMT, points[i], dofs[i], dof);
+    PetscCheck(offs[i] == off, PETSC_COMM_SELF, PETSC_ERR_PLIB, "Point %" PetscInt_FMT " offset %" PetscInt_FMT " != %" PetscInt_FMT, points[i], offs[i], off);
+    PetscCall(PetscPrintf(PETSC_COMM_SELF, "point %" PetscInt_FMT ": dof %" PetscInt_FMT " off %" PetscInt_FMT, points[i], dofs[i], offs[i]));
+    for (PetscInt f = 0; f < Nf; ++f) {
+      PetscCall(PetscSectionGetFieldDof(s, points[i], f, &dof));
+      PetscCall(PetscSectionGetFieldOffset(s, points[i], f, &off));
+      PetscCheck(fdofs[i * Nf + f] == dof, PETSC_COMM_SELF, PETSC_ERR_PLIB, "Point %" PetscInt_FMT " field %" PetscInt_FMT " dof %" PetscInt_FMT " != %" PetscInt_FMT, points[i], f, fdofs[i * Nf + f], dof);
+      PetscCheck(foffs[i * Nf + f] == off, PETSC_COMM_SELF, PETSC_ERR_PLIB, "Point %" PetscInt_FMT " field %" PetscInt_FMT " offset %" PetscInt_FMT " != %" PetscInt_FMT, points[i], f, foffs[i * Nf + f], off);
+      PetscCall(PetscPrintf(PETSC_COMM_SELF, " (field %" PetscInt_FMT ": dof %" PetscInt_FMT " off %" PetscInt_FMT ")", f, fdofs[i * Nf + f], foffs[i * Nf + f]));
+    }
+    PetscCall(PetscPrintf(PETSC_COMM_SELF, "\n"));
+  }
+  PetscCall(PetscSectionDestroy(&s));
+  PetscCall(PetscFinalize());
+  return 0;
+}
+
+/*TEST
+
+  test:
+    suffix: 0
+
+  test:
+    suffix: 1
+    args: -point_major 0
+
+TEST*/